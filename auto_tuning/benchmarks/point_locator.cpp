@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "Geometry/PointLocator.h"
+#include "Initializer/PointMapper.h"
+#include "tests/Geometry/CubeMesh.h"
+
+/**
+ * Compares the brute force search of findMeshIds with the point locator.
+ * Usage: SeisSol_point_locator_benchmark [cells per dimension] [number of points]
+ */
+int main(int argc, char* argv[]) {
+  const unsigned cellsPerDimension = (argc > 1) ? std::atoi(argv[1]) : 32;
+  const unsigned numPoints = (argc > 2) ? std::atoi(argv[2]) : 10000;
+
+  const seissol::CubeMesh mesh(cellsPerDimension);
+  std::cout << "Mesh with " << mesh.elements.size() << " elements, " << numPoints << " points"
+            << std::endl;
+
+  std::srand(42);
+  std::vector<Eigen::Vector3d> points(numPoints);
+  for (auto& point : points) {
+    point = Eigen::Vector3d(1.1 * std::rand() / RAND_MAX - 0.05,
+                            1.1 * std::rand() / RAND_MAX - 0.05,
+                            1.1 * std::rand() / RAND_MAX - 0.05);
+  }
+
+  std::vector<short> containedBruteForce(numPoints);
+  std::vector<unsigned> meshIdsBruteForce(numPoints, std::numeric_limits<unsigned>::max());
+  std::vector<short> contained(numPoints);
+  std::vector<unsigned> meshIds(numPoints, std::numeric_limits<unsigned>::max());
+
+  using Clock = std::chrono::steady_clock;
+  const auto seconds = [](Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration<double>(end - begin).count();
+  };
+
+  const auto bruteForceBegin = Clock::now();
+  seissol::initializers::findMeshIdsBruteForce(points.data(),
+                                               mesh.vertices,
+                                               mesh.elements,
+                                               numPoints,
+                                               containedBruteForce.data(),
+                                               meshIdsBruteForce.data());
+  const auto bruteForceEnd = Clock::now();
+
+  const auto buildBegin = Clock::now();
+  const seissol::geometry::PointLocator locator(mesh.vertices, mesh.elements);
+  const auto buildEnd = Clock::now();
+  seissol::initializers::findMeshIds(
+      points.data(), locator, numPoints, contained.data(), meshIds.data());
+  const auto queryEnd = Clock::now();
+
+  unsigned mismatches = 0;
+  for (unsigned i = 0; i < numPoints; ++i) {
+    if (contained[i] != containedBruteForce[i] ||
+        (contained[i] != 0 && meshIds[i] != meshIdsBruteForce[i])) {
+      ++mismatches;
+    }
+  }
+
+  std::cout << "Brute force:          " << seconds(bruteForceBegin, bruteForceEnd) << " s"
+            << std::endl;
+  std::cout << "Point locator build:  " << seconds(buildBegin, buildEnd) << " s ("
+            << locator.numberOfNodes() << " nodes)" << std::endl;
+  std::cout << "Point locator query:  " << seconds(buildEnd, queryEnd) << " s" << std::endl;
+  std::cout << "Mismatches:           " << mismatches << std::endl;
+
+  return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
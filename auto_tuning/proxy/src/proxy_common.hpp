@@ -13,7 +13,8 @@ enum Kernel {
   ader,
   localwoader,
   neigh_dr,
-  godunov_dr
+  godunov_dr,
+  neigh_batched
 };
 
 struct ProxyConfig {
@@ -99,7 +100,8 @@ protected:
       {Kernel::ader,        "ader"},
       {Kernel::localwoader, "localwoader"},
       {Kernel::neigh_dr,    "neigh_dr"},
-      {Kernel::godunov_dr,  "godunov_dr"}
+      {Kernel::godunov_dr,  "godunov_dr"},
+      {Kernel::neigh_batched, "neigh_batched"}
   };
 
   inline static std::unordered_map<std::string, Kernel> invMap{
@@ -109,7 +111,8 @@ protected:
       {"ader", Kernel::ader},
       {"localwoader", Kernel::localwoader},
       {"neigh_dr", Kernel::neigh_dr},
-      {"godunov_dr", Kernel::godunov_dr}
+      {"godunov_dr", Kernel::godunov_dr},
+      {"neigh_batched", Kernel::neigh_batched}
   };
 };
 
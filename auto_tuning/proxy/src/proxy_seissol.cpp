@@ -135,6 +135,16 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+    case neigh_batched:
+      for (; t < timesteps; ++t) {
+#ifdef ACL_DEVICE
+        // the device integrators are always batched
+        computeNeighboringIntegration();
+#else
+        computeNeighboringIntegrationBatched();
+#endif
+      }
+      break;
     default:
       break;
   }
@@ -171,6 +181,10 @@ ProxyOutput runProxy(ProxyConfig config) {
   config.cells = initDataStructures(config.cells, enableDynamicRupture);
 #ifdef ACL_DEVICE
   initDataStructuresOnDevice(enableDynamicRupture);
+#else
+  if (config.kernel == neigh_batched) {
+    initBatchedNeighborIntegration();
+  }
 #endif // ACL_DEVICE
 
   if (config.verbose)
@@ -221,6 +235,7 @@ ProxyOutput runProxy(ProxyConfig config) {
       break;
     case neigh:
     case neigh_dr:
+    case neigh_batched:
       flop_fun = &flops_neigh_actual;
       bytes_fun = &bytes_neigh;
       break;
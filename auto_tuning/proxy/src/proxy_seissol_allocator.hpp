@@ -63,11 +63,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Solver/time_stepping/MiniSeisSol.cpp>
 #include <yateto.h>
 #include <unordered_set>
+#include <Initializer/BatchRecorders/Recorders.h>
 
 #ifdef ACL_DEVICE
 #include <device.h>
-#include <unordered_set>
-#include <Initializer/BatchRecorders/Recorders.h>
 #include <Solver/Pipeline/DrPipeline.h>
 #endif
 
@@ -198,7 +197,38 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   return i_cells;
 }
 
-#ifdef ACL_DEVICE
+#ifndef ACL_DEVICE
+void initBatchedNeighborIntegration() {
+  seissol::initializers::Layer& layer = m_ltsTree->child(0).child<Interior>();
+
+  CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+  real *(*faceNeighbors)[4] = layer.var(m_lts.faceNeighbors);
+  std::unordered_set<real *> registry{};
+
+  // scratch memory for the time integrated DOFs of neighbors which provide derivatives
+  unsigned idofsCounter = 0;
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      real *neighbourBuffer = faceNeighbors[cell][face];
+      if (neighbourBuffer != nullptr && registry.find(neighbourBuffer) == registry.end()
+          && cellInformation[cell].faceTypes[face] != FaceType::outflow
+          && cellInformation[cell].faceTypes[face] != FaceType::dynamicRupture) {
+        if (((cellInformation[cell].ltsSetup >> face) % 2) == 1) {
+          ++idofsCounter;
+        }
+        registry.insert(neighbourBuffer);
+      }
+    }
+  }
+
+  layer.setScratchpadSize(m_lts.idofsScratch, idofsCounter * tensor::I::size() * sizeof(real));
+  m_ltsTree->allocateScratchPads();
+
+  seissol::initializers::recording::CompositeRecorder<seissol::initializers::LTS> recorder;
+  recorder.addRecorder(new seissol::initializers::recording::NeighIntegrationRecorder);
+  recorder.record(m_lts, layer);
+}
+#else
 void initDataStructuresOnDevice(bool enableDynamicRupture) {
 
   // estimate sizes required for scratch pads
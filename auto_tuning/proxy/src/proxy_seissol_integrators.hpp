@@ -37,6 +37,7 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
         LIKWID_MARKER_REGISTER("neighboring");
+        LIKWID_MARKER_REGISTER("neighboring_batched");
     }
 }
 
@@ -213,6 +214,23 @@ namespace proxy::cpu {
   #endif
   }
 
+  void computeNeighboringIntegrationBatched() {
+#ifdef USE_ELASTIC
+    auto& layer = m_ltsTree->child(0).child<Interior>();
+    ConditionalBatchTableT& table = layer.getCondBatchTable();
+
+    LIKWID_MARKER_START("neighboring_batched");
+    seissol::kernels::TimeCommon::computeBatchedIntegrals(m_timeKernel,
+                                                          0.0,
+                                                          (double)seissol::miniSeisSolTimeStep,
+                                                          table);
+    m_neighborKernel.computeBatchedNeighborsIntegral(table);
+    LIKWID_MARKER_STOP("neighboring_batched");
+#else
+    logError() << "The batched neighbor integration is only implemented for elastic materials.";
+#endif
+  }
+
   void computeDynRupGodunovState()
   {
     seissol::initializers::Layer& layerData = m_dynRupTree->child(0).child<Interior>();
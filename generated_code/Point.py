@@ -92,6 +92,12 @@ def addKernels(generator, aderdg):
   evaluateDOFSAtPoint = QAtPoint['p'] <= aderdg.Q['kp'] * basisFunctionsAtPoint['k']
   generator.add('evaluateDOFSAtPoint', evaluateDOFSAtPoint)
 
+  # Evaluates the time derivatives at the point. The receiver output at several
+  # sampling times is then a small matrix product with the Taylor coefficients.
+  if hasattr(aderdg, 'dQs'):
+    for i, dQ in enumerate(aderdg.dQs):
+      generator.add(f'evaluateDerivativeAtPoint({i})', QAtPoint['p'] <= dQ['kp'] * basisFunctionsAtPoint['k'])
+
   stpShape = (numberOf3DBasisFunctions, numberOfQuantities, order)
   spaceTimePredictor = OptionalDimTensor('spaceTimePredictor', aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), stpShape, alignStride=True)
   evaluateDOFSAtPointSTP = QAtPoint['p'] <= spaceTimePredictor['kpt'] * basisFunctionsAtPoint['k'] * timeBasisFunctionsAtPoint['t']
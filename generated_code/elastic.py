@@ -38,6 +38,7 @@
 # @section DESCRIPTION
 #
   
+from yateto import Tensor, simpleParameterSpace
 from yateto.input import parseXMLMatrixFile, memoryLayoutFromFile
 
 from aderdg import LinearADERDG
@@ -62,3 +63,21 @@ class ElasticADERDG(LinearADERDG):
 
   def addLocal(self, generator, targets):
     super().addLocal(generator, targets)
+
+  def addNeighbor(self, generator, targets):
+    super().addNeighbor(generator, targets)
+
+    # Batched neighbor flux on CPUs: the face-local part of the flux only depends on
+    # the face relation and is computed for a chunk of cells at once
+    if 'cpu' in targets and not self.Q.hasOptDim():
+      batchSize = 16
+      faceShape = (self.numberOf2DBasisFunctions(), self.numberOfQuantities())
+      IBatch = Tensor('IBatch', (self.numberOf3DBasisFunctions(), self.numberOfQuantities(), batchSize), alignStride=True)
+      fluxBatch = Tensor('fluxBatch', faceShape + (batchSize,), alignStride=True)
+      fluxFace = Tensor('fluxFace', faceShape, alignStride=True)
+
+      neighbourFluxBatch = lambda h,j: fluxBatch['mqc'] <= self.db.fP[h]['mn'] * self.db.rT[j]['nl'] * IBatch['lqc']
+      generator.addFamily('neighboringFluxBatch', simpleParameterSpace(3,4), neighbourFluxBatch)
+
+      neighbourFluxProjection = lambda i: self.Q['kp'] <= self.Q['kp'] + self.db.rDivM[i]['km'] * fluxFace['mq'] * self.AminusT['qp']
+      generator.addFamily('neighboringFluxProjection', simpleParameterSpace(4), neighbourFluxProjection)
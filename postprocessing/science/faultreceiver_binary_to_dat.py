@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+import numpy as np
+
+FILE_MAGIC = b"SSFREC01"
+SEGMENT_MAGIC = b"SSFRSEG1"
+COLUMN_NAME_LENGTH = 16
+RANK_IN_FILE_NAME = 1
+
+
+def read_segment_offsets(file_name, data_offset, values_per_sample):
+    """Returns the offsets of all complete segments, preferably from the index file."""
+    index_file_name = file_name + ".idx"
+    if os.path.exists(index_file_name):
+        index = np.fromfile(
+            index_file_name,
+            dtype=np.dtype(
+                [("offset", "u8"), ("samples", "u8"), ("first", "f8"), ("last", "f8")]
+            ),
+        )
+        return [int(offset) for offset in index["offset"]]
+
+    offsets = []
+    file_size = os.path.getsize(file_name)
+    with open(file_name, "rb") as f:
+        offset = data_offset
+        while offset + 16 <= file_size:
+            f.seek(offset)
+            magic, num_samples = struct.unpack("=8sQ", f.read(16))
+            if magic != SEGMENT_MAGIC:
+                raise ValueError(f"Corrupt segment in {file_name}.")
+            offsets.append(offset)
+            offset += 16 + num_samples * 8 * (1 + values_per_sample)
+    return offsets
+
+
+def read_fault_receivers(file_name):
+    """Reads a binary fault receiver file written with OutputBackend = 'binary'.
+
+    Returns the column names, the global receiver indices, the receiver coordinates,
+    the times, the values (receivers x samples x (columns - 1)), the rank and the flags.
+    """
+    with open(file_name, "rb") as f:
+        magic, num_columns, num_receivers, rank, flags = struct.unpack(
+            "=8sQQQQ", f.read(40)
+        )
+        if magic != FILE_MAGIC:
+            raise ValueError(f"{file_name} is not a binary fault receiver file.")
+        names = [
+            f.read(COLUMN_NAME_LENGTH).split(b"\0", 1)[0].decode()
+            for _ in range(num_columns)
+        ]
+        receiver_ids = np.fromfile(f, dtype=np.uint64, count=num_receivers)
+        coordinates = np.fromfile(f, dtype=np.float64, count=3 * num_receivers).reshape(
+            num_receivers, 3
+        )
+        data_offset = f.tell()
+
+        times = []
+        values = []
+        for offset in read_segment_offsets(
+            file_name, data_offset, num_receivers * (num_columns - 1)
+        ):
+            f.seek(offset)
+            magic, num_samples = struct.unpack("=8sQ", f.read(16))
+            if magic != SEGMENT_MAGIC:
+                raise ValueError(f"Corrupt segment in {file_name}.")
+            times.append(np.fromfile(f, dtype=np.float64, count=num_samples))
+            values.append(
+                np.fromfile(
+                    f, dtype=np.float64, count=num_receivers * num_samples * (num_columns - 1)
+                ).reshape(num_receivers, num_samples, num_columns - 1)
+            )
+
+    if times:
+        times = np.concatenate(times)
+        values = np.concatenate(values, axis=1)
+    else:
+        times = np.empty(0)
+        values = np.empty((num_receivers, 0, num_columns - 1))
+    return names, receiver_ids, coordinates, times, values, rank, flags
+
+
+def legacy_file_name(prefix, receiver_id, rank, rank_in_file_name):
+    name = f"{prefix}-faultreceiver-{receiver_id:05d}"
+    if rank_in_file_name:
+        name += f"-{rank:05d}"
+    return name + ".dat"
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Convert binary fault receiver files to the legacy ASCII fault receiver files."
+    )
+    parser.add_argument(
+        "input", type=str, nargs="+", help="<prefix>-faultreceivers[-<rank>].bin"
+    )
+    parser.add_argument(
+        "--output_prefix",
+        type=str,
+        help="prefix of the generated files (default: prefix of the input file)",
+    )
+    args = parser.parse_args()
+
+    num_files = 0
+    for input_file in args.input:
+        names, receiver_ids, coordinates, times, values, rank, flags = read_fault_receivers(
+            input_file
+        )
+
+        prefix = args.output_prefix
+        if prefix is None:
+            prefix = re.sub(r"-faultreceivers(-\d+)?\.bin$", "", input_file)
+
+        header = "VARIABLES = " + " ,".join(f'"{name}"' for name in names)
+        for receiver, receiver_id in enumerate(receiver_ids):
+            file_name = legacy_file_name(
+                prefix, int(receiver_id), rank, flags & RANK_IN_FILE_NAME
+            )
+            with open(file_name, "w") as f:
+                f.write(
+                    f'TITLE = "Temporal Signal for fault receiver number {int(receiver_id)}"\n'
+                )
+                f.write(header + "\n")
+                for d in range(3):
+                    f.write(f"# x{d + 1}\t{coordinates[receiver, d]:.16e}\n")
+                for sample, time in enumerate(times):
+                    row = [time, *values[receiver, sample]]
+                    f.write("".join(f"{value:.16e}\t" for value in row) + "\n")
+            num_files += 1
+
+    print(f"Wrote {num_files} fault receiver files.", file=sys.stderr)
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import struct
+import sys
+
+import numpy as np
+
+FILE_MAGIC = b"SSRECV01"
+CHUNK_MAGIC = b"SSCHUNK1"
+COLUMN_NAME_LENGTH = 16
+RANK_IN_FILE_NAME = 1
+
+
+def read_receivers(file_name):
+    """Reads a binary receiver file written with ReceiverOutputBackend = 'binary'.
+
+    Returns the column names, the receiver coordinates and a dictionary which maps
+    (point id, rank) to the samples of the receiver (one row per sample).
+    """
+    with open(file_name, "rb") as f:
+        magic, num_columns, num_receivers, flags = struct.unpack("=8sQQQ", f.read(32))
+        if magic != FILE_MAGIC:
+            raise ValueError(f"{file_name} is not a binary receiver file.")
+        names = [
+            f.read(COLUMN_NAME_LENGTH).split(b"\0", 1)[0].decode()
+            for _ in range(num_columns)
+        ]
+        coordinates = np.fromfile(f, dtype=np.float64, count=3 * num_receivers).reshape(
+            num_receivers, 3
+        )
+
+        samples = {}
+        while True:
+            chunk_header = f.read(24)
+            if len(chunk_header) < 24:
+                break
+            magic, _, size = struct.unpack("=8sdQ", chunk_header)
+            if magic != CHUNK_MAGIC:
+                raise ValueError(f"Corrupt chunk in {file_name}.")
+            end = f.tell() + size
+            while f.tell() < end:
+                point_id, rank, num_samples = struct.unpack("=QQQ", f.read(24))
+                data = np.fromfile(
+                    f, dtype=np.float64, count=num_samples * num_columns
+                ).reshape(num_samples, num_columns)
+                samples.setdefault((point_id, rank), []).append(data)
+
+    samples = {key: np.concatenate(value) for key, value in samples.items()}
+    return names, coordinates, samples, flags
+
+
+def legacy_file_name(prefix, point_id, rank, rank_in_file_name):
+    name = f"{prefix}-receiver-{point_id + 1:05d}"
+    if rank_in_file_name:
+        name += f"-{rank:05d}"
+    return name + ".dat"
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Convert a binary receiver file to the legacy ASCII receiver files."
+    )
+    parser.add_argument("input", type=str, help="<prefix>-receivers.bin")
+    parser.add_argument(
+        "--output_prefix",
+        type=str,
+        help="prefix of the generated files (default: prefix of the input file)",
+    )
+    args = parser.parse_args()
+
+    names, coordinates, samples, flags = read_receivers(args.input)
+
+    prefix = args.output_prefix
+    if prefix is None:
+        prefix = args.input
+        if prefix.endswith("-receivers.bin"):
+            prefix = prefix[: -len("-receivers.bin")]
+
+    for (point_id, rank), data in sorted(samples.items()):
+        file_name = legacy_file_name(prefix, point_id, rank, flags & RANK_IN_FILE_NAME)
+        with open(file_name, "w") as f:
+            f.write(f'TITLE = "Temporal Signal for receiver number {point_id + 1:05d}"\n')
+            f.write("VARIABLES = " + ",".join(f'"{name}"' for name in names) + "\n")
+            for d in range(3):
+                f.write(f"# x{d + 1}       {coordinates[point_id, d]:.12e}\n")
+            for row in data:
+                f.write("".join(f"  {value:.15e}" for value in row) + "\n")
+
+    print(f"Wrote {len(samples)} receiver files.", file=sys.stderr)
@@ -48,6 +48,8 @@
 #include "mpio/WavefieldAsync.h"
 #include "mpio/Fault.h"
 #include "mpio/FaultAsync.h"
+#include "compressed/Wavefield.h"
+#include "compressed/Fault.h"
 #ifdef USE_SIONLIB
 #include "sionlib/Fault.h"
 #include "sionlib/Wavefield.h"
@@ -55,26 +57,26 @@
 
 void seissol::checkpoint::createBackend(Backend backend, Wavefield* &waveField, Fault* &fault)
 {
+	waveField = createWavefieldBackend(backend);
+
 	switch (backend) {
 	case POSIX:
-		waveField = new posix::Wavefield();
 		fault = new posix::Fault();
 		break;
 	case HDF5:
-		waveField = new h5::Wavefield();
 		fault = new h5::Fault();
 		break;
 	case MPIO:
-		waveField = new mpio::Wavefield();
 		fault = new mpio::Fault();
 		break;
 	case MPIO_ASYNC:
-		waveField = new mpio::WavefieldAsync();
 		fault = new mpio::FaultAsync();
 		break;
+	case COMPRESSED:
+		fault = new compressed::Fault();
+		break;
 	case SIONLIB:
 #ifdef USE_SIONLIB
-		waveField = new sionlib::Wavefield();
 		fault = new sionlib::Fault();
 		break;
 #else //USE_SIONLIB
@@ -84,4 +86,31 @@ void seissol::checkpoint::createBackend(Backend backend, Wavefield* &waveField,
 	default:
 		logError() << "Unsupported checkpoint backend";
 	}
-}
\ No newline at end of file
+}
+
+seissol::checkpoint::Wavefield* seissol::checkpoint::createWavefieldBackend(Backend backend)
+{
+	switch (backend) {
+	case POSIX:
+		return new posix::Wavefield();
+	case HDF5:
+		return new h5::Wavefield();
+	case MPIO:
+		return new mpio::Wavefield();
+	case MPIO_ASYNC:
+		return new mpio::WavefieldAsync();
+	case COMPRESSED:
+		return new compressed::Wavefield();
+	case SIONLIB:
+#ifdef USE_SIONLIB
+		return new sionlib::Wavefield();
+#else //USE_SIONLIB
+		logError() << "SIONlib checkpoint backend unsupported";
+		break;
+#endif //USE_SIONLIB
+	default:
+		logError() << "Unsupported checkpoint backend";
+	}
+
+	return 0L;
+}
@@ -56,6 +56,7 @@ enum Backend {
 	MPIO,
 	MPIO_ASYNC,
 	SIONLIB,
+	COMPRESSED,
 	DISABLED
 };
 
@@ -64,6 +65,11 @@ enum Backend {
  */
 void createBackend(Backend backend, Wavefield* &waveField, Fault* &fault);
 
+/**
+ * Create only the wave field instance, e.g. for additional per-rank data
+ */
+Wavefield* createWavefieldBackend(Backend backend);
+
 }
 
 }
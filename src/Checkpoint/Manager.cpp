@@ -89,6 +89,10 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		addBuffer(slip2, m_numDRDofs * sizeof(real));
 		addBuffer(state, m_numDRDofs * sizeof(real));
 		addBuffer(strength, m_numDRDofs * sizeof(real));
+		if (hasAuxiliary()) {
+			id = addBuffer(m_auxiliary.data(), m_auxiliary.size() * sizeof(double));
+			assert(id == AUXILIARY);
+		}
 
 		//
 		// Initialization for loading checkpoints
@@ -122,6 +126,33 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		delete waveField;
 		delete fault;
 
+		// The auxiliary data uses the same backend with its own files
+		if (hasAuxiliary()) {
+			Wavefield* auxiliary = createWavefieldBackend(m_backend);
+			auxiliary->setHeader(m_auxiliaryHeader);
+			m_auxiliaryHeader.alloc(utils::Env::get<size_t>("SEISSOL_CHECKPOINT_ALIGNMENT", 0));
+			auxiliary->setFilename((m_filename + "-aux").c_str());
+
+			int auxiliaryExists = auxiliary->init(m_auxiliaryHeader.size(), numAuxiliaryReals(),
+				seissol::SeisSol::main.asyncIO().groupSize());
+#ifdef USE_MPI
+			MPI_Allreduce(MPI_IN_PLACE, &auxiliaryExists, 1, MPI_INT, MPI_LAND, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+			if (exists && auxiliaryExists) {
+				auxiliary->load(reinterpret_cast<real*>(m_auxiliary.data()));
+
+				// Both checkpoints are written with the same header
+				m_auxiliaryLoaded = m_auxiliaryHeader.time() == m_header.time();
+				if (!m_auxiliaryLoaded)
+					logWarning(seissol::MPI::mpi.rank()) << "The auxiliary checkpoint was written at time"
+						<< m_auxiliaryHeader.time() << "but the checkpoint at time" << m_header.time();
+			}
+
+			auxiliary->close();
+			delete auxiliary;
+		}
+
 		sendBuffer(FILENAME,  m_filename.size()+1);
 
 		// Initialize the executor
@@ -129,6 +160,8 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		param.backend = m_backend;
 		param.numBndGP = numBndGP;
 		param.loaded = exists;
+		param.hasAuxiliary = hasAuxiliary();
+		param.auxiliaryLoaded = m_auxiliaryLoaded;
 		callInit(param);
 
 		removeBuffer(FILENAME);
@@ -136,6 +169,21 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		return exists;
 }
 
+void seissol::checkpoint::Manager::setAuxiliarySize(size_t numValues)
+{
+	assert(numValues > 0);
+
+	// The POSIX backend writes complete blocks with SEISSOL_CHECKPOINT_ALIGNMENT
+	size_t size = numValues * sizeof(double);
+	const size_t alignment = utils::Env::get<size_t>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
+	if (alignment) {
+		size = (size + alignment - 1) / alignment;
+		size *= alignment;
+	}
+
+	m_auxiliary.assign((size + sizeof(double) - 1) / sizeof(double), 0.0);
+}
+
 void seissol::checkpoint::Manager::setUp()
 {
   setExecutor(m_executor);
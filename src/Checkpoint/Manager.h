@@ -47,6 +47,7 @@
 #include <cassert>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -85,13 +86,23 @@ private:
 	/** Checkpoint header */
 	WavefieldHeader m_header;
 
+	/** Additional per-rank data, stored in a second wave field checkpoint */
+	std::vector<double> m_auxiliary;
+
+	/** Header of the auxiliary checkpoint (only used for loading) */
+	WavefieldHeader m_auxiliaryHeader;
+
+	/** Was the auxiliary data loaded from the checkpoint */
+	bool m_auxiliaryLoaded;
+
 	/** Stopwatch for checkpointing frontend */
 	Stopwatch m_stopwatch;
 
 public:
 	Manager()
 		: m_backend(DISABLED),
-		  m_numDofs(0), m_numDRDofs(0)
+		  m_numDofs(0), m_numDRDofs(0),
+		  m_auxiliaryLoaded(false)
 	{
 	}
 
@@ -113,6 +124,55 @@ public:
 		m_filename = filename;
 	}
 
+	/**
+	 * @return The filename prefix for checkpointing
+	 */
+	const std::string& filename() const
+	{
+		return m_filename;
+	}
+
+	/**
+	 * @return True if checkpoints are written
+	 */
+	bool isEnabled() const
+	{
+		return m_backend != DISABLED;
+	}
+
+
+	/**
+	 * Reserves additional per-rank data that is stored with each checkpoint.
+	 * The data is written with the same backend to <filename>-aux and loaded
+	 * together with the wave field. Has to be called before init().
+	 *
+	 * @param numValues Number of values on this rank (at least one, on all ranks)
+	 */
+	void setAuxiliarySize(size_t numValues);
+
+	/**
+	 * @return True if auxiliary data is stored with the checkpoints
+	 */
+	bool hasAuxiliary() const
+	{
+		return !m_auxiliary.empty();
+	}
+
+	/**
+	 * The auxiliary data. It has to be updated before each call to write().
+	 */
+	double* auxiliary()
+	{
+		return m_auxiliary.data();
+	}
+
+	/**
+	 * @return True if the auxiliary data was loaded from the checkpoint
+	 */
+	bool isAuxiliaryLoaded() const
+	{
+		return m_auxiliaryLoaded;
+	}
 
 	/**
 	 * This is called on all ranks
@@ -170,6 +230,8 @@ public:
 		sendBuffer(DOFS, m_numDofs * sizeof(real));
 		for (unsigned int i = 0; i < 8; i++)
 			sendBuffer(DR_DOFS0+i, m_numDRDofs * sizeof(real));
+		if (hasAuxiliary())
+			sendBuffer(AUXILIARY, m_auxiliary.size() * sizeof(double));
 
 
 		SCOREP_USER_REGION_DEFINE(r_call);
@@ -211,6 +273,13 @@ public:
 	}
 
 private:
+	/**
+	 * @return The size of the auxiliary data in the basic data type of the backends
+	 */
+	unsigned long numAuxiliaryReals() const
+	{
+		return m_auxiliary.size() * sizeof(double) / sizeof(real);
+	}
 };
 
 }
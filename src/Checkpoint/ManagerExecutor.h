@@ -40,6 +40,8 @@
 #ifndef CHECKPOINT_MANAGER_EXECUTOR_H
 #define CHECKPOINT_MANAGER_EXECUTOR_H
 
+#include <string>
+
 #include "async/ExecInfo.h"
 
 #include "Backend.h"
@@ -56,7 +58,9 @@ enum BufferTags {
 	FILENAME = 0,
 	HEADER = 1,
 	DOFS = 2,
-	DR_DOFS0 = 3
+	DR_DOFS0 = 3,
+	/** Optional, follows the 8 buffers of the dynamic rupture */
+	AUXILIARY = DR_DOFS0 + 8
 };
 
 /**
@@ -67,6 +71,8 @@ struct CheckpointInitParam
 	Backend backend;
 	unsigned int numBndGP;
 	bool loaded;
+	bool hasAuxiliary;
+	bool auxiliaryLoaded;
 };
 
 /**
@@ -87,13 +93,17 @@ private:
 	/** The dynamic rupture checkpoint */
 	Fault *m_fault;
 
+	/** Checkpoint for the additional per-rank data (optional) */
+	Wavefield *m_auxiliary;
+
 	/** Stopwatch for checkpoint backend */
 	Stopwatch m_stopwatch;
 
 public:
 	ManagerExecutor()
 		: m_waveField(0L),
-		  m_fault(0L)
+		  m_fault(0L),
+		  m_auxiliary(0L)
 	{ }
 
 	virtual ~ManagerExecutor()
@@ -127,6 +137,15 @@ public:
 		m_waveField->initLate(dofs);
 		m_fault->initLate(drDofs[0], drDofs[1], drDofs[2], drDofs[3], drDofs[4], drDofs[5],
 			drDofs[6], drDofs[7]);
+
+		if (param.hasAuxiliary) {
+			m_auxiliary = createWavefieldBackend(param.backend);
+			m_auxiliary->setFilename((std::string(filename) + "-aux").c_str());
+			m_auxiliary->init(info.bufferSize(HEADER), info.bufferSize(AUXILIARY) / sizeof(real));
+			if (param.auxiliaryLoaded)
+				m_auxiliary->setLoaded();
+			m_auxiliary->initLate(static_cast<const real*>(info.buffer(AUXILIARY)));
+		}
 	}
 
 	/**
@@ -138,14 +157,20 @@ public:
 
 		m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
 		m_fault->write(param.faultTimeStep);
+		if (m_auxiliary)
+			m_auxiliary->write(info.buffer(HEADER), info.bufferSize(HEADER));
 
-		// Update both links at the "same" time
+		// Update all links at the "same" time
 		m_waveField->updateLink();
 		m_fault->updateLink();
+		if (m_auxiliary)
+			m_auxiliary->updateLink();
 
 		// Prepare next checkpoint (only for async checkpoints)
 		m_waveField->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
 		m_fault->writePrepare(param.faultTimeStep);
+		if (m_auxiliary)
+			m_auxiliary->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
 
 		m_stopwatch.pause();
 	}
@@ -162,6 +187,12 @@ public:
 			m_waveField = 0L;
 			delete m_fault;
 			m_fault = 0L;
+
+			if (m_auxiliary) {
+				m_auxiliary->close();
+				delete m_auxiliary;
+				m_auxiliary = 0L;
+			}
 		}
 	}
 };
@@ -0,0 +1,168 @@
+#include "BlockCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace seissol::checkpoint::compressed {
+
+void shuffle(const void* in, void* out, std::size_t size, std::size_t elementSize) {
+  const auto* src = static_cast<const std::uint8_t*>(in);
+  auto* dest = static_cast<std::uint8_t*>(out);
+
+  const std::size_t numElements = size / elementSize;
+  for (std::size_t byte = 0; byte < elementSize; ++byte) {
+    for (std::size_t i = 0; i < numElements; ++i) {
+      dest[byte * numElements + i] = src[i * elementSize + byte];
+    }
+  }
+  std::memcpy(dest + numElements * elementSize,
+              src + numElements * elementSize,
+              size - numElements * elementSize);
+}
+
+void unshuffle(const void* in, void* out, std::size_t size, std::size_t elementSize) {
+  const auto* src = static_cast<const std::uint8_t*>(in);
+  auto* dest = static_cast<std::uint8_t*>(out);
+
+  const std::size_t numElements = size / elementSize;
+  for (std::size_t byte = 0; byte < elementSize; ++byte) {
+    for (std::size_t i = 0; i < numElements; ++i) {
+      dest[i * elementSize + byte] = src[byte * numElements + i];
+    }
+  }
+  std::memcpy(dest + numElements * elementSize,
+              src + numElements * elementSize,
+              size - numElements * elementSize);
+}
+
+void rleEncode(const std::uint8_t* in, std::size_t size, std::vector<std::uint8_t>& out) {
+  constexpr std::size_t MaxRun = 129;
+  constexpr std::size_t MaxLiterals = 128;
+
+  out.clear();
+  out.reserve(size + size / MaxLiterals + 1);
+
+  std::size_t literalStart = 0;
+  auto flushLiterals = [&](std::size_t end) {
+    while (literalStart < end) {
+      const std::size_t count = std::min(end - literalStart, MaxLiterals);
+      out.push_back(static_cast<std::uint8_t>(count - 1));
+      out.insert(out.end(), in + literalStart, in + literalStart + count);
+      literalStart += count;
+    }
+  };
+
+  std::size_t i = 0;
+  while (i < size) {
+    std::size_t run = 1;
+    while (i + run < size && run < MaxRun && in[i + run] == in[i]) {
+      ++run;
+    }
+    // Runs of 2 bytes are cheaper as part of a literal sequence
+    if (run >= 3) {
+      flushLiterals(i);
+      out.push_back(static_cast<std::uint8_t>(run + 126));
+      out.push_back(in[i]);
+      i += run;
+      literalStart = i;
+    } else {
+      i += run;
+    }
+  }
+  flushLiterals(size);
+}
+
+bool rleDecode(const std::uint8_t* in, std::size_t encodedSize, std::uint8_t* out, std::size_t size) {
+  std::size_t pos = 0;
+  std::size_t written = 0;
+  while (pos < encodedSize) {
+    const std::uint8_t control = in[pos++];
+    if (control < 128) {
+      const std::size_t count = control + 1;
+      if (pos + count > encodedSize || written + count > size) {
+        return false;
+      }
+      std::memcpy(out + written, in + pos, count);
+      pos += count;
+      written += count;
+    } else {
+      const std::size_t count = control - 126;
+      if (pos >= encodedSize || written + count > size) {
+        return false;
+      }
+      std::memset(out + written, in[pos++], count);
+      written += count;
+    }
+  }
+  return written == size;
+}
+
+BlockEncoding compressBlock(const void* data,
+                            std::size_t size,
+                            std::size_t elementSize,
+                            std::vector<std::uint8_t>& compressed) {
+  std::vector<std::uint8_t> shuffled(size);
+  shuffle(data, shuffled.data(), size, elementSize);
+  rleEncode(shuffled.data(), size, compressed);
+
+  if (compressed.size() >= size) {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    compressed.assign(bytes, bytes + size);
+    return BlockEncoding::Raw;
+  }
+  return BlockEncoding::ShuffleRle;
+}
+
+bool decompressBlock(BlockEncoding encoding,
+                     const std::uint8_t* compressed,
+                     std::size_t compressedSize,
+                     std::size_t elementSize,
+                     void* data,
+                     std::size_t size) {
+  switch (encoding) {
+  case BlockEncoding::Raw:
+    if (compressedSize != size) {
+      return false;
+    }
+    std::memcpy(data, compressed, size);
+    return true;
+  case BlockEncoding::ShuffleRle: {
+    std::vector<std::uint8_t> shuffled(size);
+    if (!rleDecode(compressed, compressedSize, shuffled.data(), size)) {
+      return false;
+    }
+    unshuffle(shuffled.data(), data, size, elementSize);
+    return true;
+  }
+  default:
+    return false;
+  }
+}
+
+std::uint64_t hashBlock(const void* data, std::size_t size) {
+  // Word-wise multiply-xorshift hash (64 bit finalizer of MurmurHash3)
+  auto mix = [](std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  };
+
+  const auto* bytes = static_cast<const std::uint8_t*>(data);
+  std::uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+
+  const std::size_t numWords = size / sizeof(std::uint64_t);
+  for (std::size_t i = 0; i < numWords; ++i) {
+    std::uint64_t word;
+    std::memcpy(&word, bytes + i * sizeof(std::uint64_t), sizeof(word));
+    hash = mix(hash ^ word) + i;
+  }
+
+  std::uint64_t tail = 0;
+  std::memcpy(&tail, bytes + numWords * sizeof(std::uint64_t), size - numWords * sizeof(std::uint64_t));
+  return mix(hash ^ tail);
+}
+
+} // namespace seissol::checkpoint::compressed
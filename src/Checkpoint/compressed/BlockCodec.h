@@ -0,0 +1,72 @@
+#ifndef SEISSOL_CHECKPOINT_COMPRESSED_BLOCKCODEC_H
+#define SEISSOL_CHECKPOINT_COMPRESSED_BLOCKCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace seissol::checkpoint::compressed {
+
+/**
+ * Encoding of a block in the checkpoint file
+ */
+enum class BlockEncoding : std::uint32_t {
+  //! Raw bytes (used if the compression does not reduce the size)
+  Raw = 0,
+  //! Byte-shuffled and run-length encoded
+  ShuffleRle = 1
+};
+
+/**
+ * Reorders the bytes such that the i-th byte of all elements are consecutive.
+ * Floating point numbers with similar values (or zeros) then produce long runs of identical bytes.
+ *
+ * @param size Size of the input in bytes (a trailing partial element is copied unchanged)
+ */
+void shuffle(const void* in, void* out, std::size_t size, std::size_t elementSize);
+
+/**
+ * Inverse of shuffle()
+ */
+void unshuffle(const void* in, void* out, std::size_t size, std::size_t elementSize);
+
+/**
+ * Run-length encoding (PackBits variant): A control byte c < 128 is followed by c+1 literal bytes,
+ * a control byte c >= 128 is followed by one byte which is repeated c-126 times.
+ * The output grows by at most one byte per 128 input bytes.
+ */
+void rleEncode(const std::uint8_t* in, std::size_t size, std::vector<std::uint8_t>& out);
+
+/**
+ * @return False if the encoded data is corrupt or does not decode to exactly size bytes
+ */
+bool rleDecode(const std::uint8_t* in, std::size_t encodedSize, std::uint8_t* out, std::size_t size);
+
+/**
+ * Compresses one block. Falls back to BlockEncoding::Raw if the data is not compressible.
+ *
+ * @return The encoding used
+ */
+BlockEncoding compressBlock(const void* data,
+                            std::size_t size,
+                            std::size_t elementSize,
+                            std::vector<std::uint8_t>& compressed);
+
+/**
+ * @return False if the block could not be decompressed
+ */
+bool decompressBlock(BlockEncoding encoding,
+                     const std::uint8_t* compressed,
+                     std::size_t compressedSize,
+                     std::size_t elementSize,
+                     void* data,
+                     std::size_t size);
+
+/**
+ * Fast 64 bit hash of a block, used to detect unchanged blocks
+ */
+std::uint64_t hashBlock(const void* data, std::size_t size);
+
+} // namespace seissol::checkpoint::compressed
+
+#endif // SEISSOL_CHECKPOINT_COMPRESSED_BLOCKCODEC_H
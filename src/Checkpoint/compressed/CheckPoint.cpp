@@ -0,0 +1,381 @@
+#include "CheckPoint.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fcntl.h>
+#include <map>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+#include "utils/env.h"
+#include "utils/path.h"
+#include "utils/stringutils.h"
+
+#include "BlockCodec.h"
+#include "Initializer/preProcessorMacros.fpp"
+#include "Kernels/precision.hpp"
+
+namespace
+{
+
+void writeAll(int file, const void* data, size_t size)
+{
+	const char* buffer = static_cast<const char*>(data);
+	while (size > 0) {
+		const ssize_t written = ::write(file, buffer, size);
+		if (written <= 0)
+			logError() << "Error in the compressed checkpoint module:" << strerror(errno);
+		buffer += written;
+		size -= written;
+	}
+}
+
+void writeAllAt(int file, const void* data, size_t size, off64_t offset)
+{
+	const char* buffer = static_cast<const char*>(data);
+	while (size > 0) {
+		const ssize_t written = pwrite64(file, buffer, size, offset);
+		if (written <= 0)
+			logError() << "Error in the compressed checkpoint module:" << strerror(errno);
+		buffer += written;
+		size -= written;
+		offset += written;
+	}
+}
+
+bool readAll(int file, void* data, size_t size, off64_t offset)
+{
+	char* buffer = static_cast<char*>(data);
+	while (size > 0) {
+		const ssize_t readSize = pread64(file, buffer, size, offset);
+		if (readSize <= 0)
+			return false;
+		buffer += readSize;
+		size -= readSize;
+		offset += readSize;
+	}
+	return true;
+}
+
+}
+
+seissol::checkpoint::compressed::CheckPoint::CheckPoint(unsigned long identifier)
+	: seissol::checkpoint::CheckPoint(identifier),
+	m_generation(0), m_chainStart(0), m_previousChainStart(0), m_writtenGeneration(0),
+	m_rawBytes(0), m_writtenBytes(0)
+{
+	m_blockSize = utils::Env::get<size_t>("SEISSOL_CHECKPOINT_COMPRESSED_BLOCK_SIZE", 1ul << 20);
+	// Blocks must not split a floating point number
+	m_blockSize = std::max(m_blockSize / sizeof(real), static_cast<size_t>(1)) * sizeof(real);
+
+	m_fullInterval = std::max(utils::Env::get<unsigned int>("SEISSOL_CHECKPOINT_FULL_INTERVAL", 1), 1u);
+}
+
+void seissol::checkpoint::compressed::CheckPoint::updateLink()
+{
+#ifdef USE_MPI
+	// All ranks must have finished the generation before it becomes the current checkpoint
+	MPI_Barrier(comm());
+#endif // USE_MPI
+
+	if (rank() == 0) {
+		remove(linkFile());
+		if (symlink(generationName(m_writtenGeneration).c_str(), linkFile()) != 0)
+			logWarning() << "Failed to create symbolic link to current checkpoint.";
+	}
+
+	// The new chain is complete, the previous one is no longer referenced
+	if (m_writtenGeneration == m_chainStart && m_previousChainStart < m_chainStart) {
+		removeGenerations(m_previousChainStart, m_chainStart);
+		m_previousChainStart = m_chainStart;
+	}
+}
+
+bool seissol::checkpoint::compressed::CheckPoint::exists()
+{
+	if (!seissol::checkpoint::CheckPoint::exists())
+		return false;
+
+	const long generation = linkedGeneration();
+	int hasCheckpoint = 0;
+	if (generation >= 0) {
+		FileHeader fileHeader;
+		std::vector<BlockEntry> blocks;
+		hasCheckpoint = readBlockTable(generation, fileHeader, blocks);
+	}
+
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, &hasCheckpoint, 1, MPI_INT, MPI_LAND, comm());
+#endif // USE_MPI
+
+	return hasCheckpoint;
+}
+
+void seissol::checkpoint::compressed::CheckPoint::createFiles()
+{
+	// The files of a generation are created when it is written. Here, we only
+	// determine where the chain continues.
+	const long generation = linkedGeneration();
+
+	m_blocks.clear();
+	if (loaded()) {
+		// Continue the loaded chain (the loaded data matches the block hashes)
+		FileHeader fileHeader;
+		if (!readBlockTable(generation, fileHeader, m_blocks))
+			logError() << "Could not read the loaded checkpoint" << generationFile(generation);
+
+		m_generation = generation + 1;
+		m_chainStart = fileHeader.chainStart;
+		m_previousChainStart = m_chainStart;
+	} else {
+		// Do not overwrite an existing (invalid) checkpoint
+		m_generation = generation + 1;
+		m_chainStart = m_generation;
+
+		// The chain of an existing checkpoint is removed after the first checkpoint
+		FileHeader fileHeader;
+		std::vector<BlockEntry> blocks;
+		if (generation >= 0 && readBlockTable(generation, fileHeader, blocks)
+				&& fileHeader.chainStart <= static_cast<uint64_t>(generation))
+			m_previousChainStart = fileHeader.chainStart;
+		else
+			m_previousChainStart = m_chainStart;
+	}
+}
+
+void seissol::checkpoint::compressed::CheckPoint::writeSegments(const void* header, size_t headerSize,
+	const std::vector<Segment> &segments)
+{
+	EPIK_TRACER("CheckPoint_write");
+	SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	const uint64_t generation = m_generation;
+
+	// Split the segments into blocks
+	std::vector<Segment> blockData;
+	for (const auto& segment : segments) {
+		for (size_t offset = 0; offset < segment.size; offset += m_blockSize) {
+			blockData.push_back({static_cast<char*>(segment.data) + offset,
+				std::min(m_blockSize, segment.size - offset)});
+		}
+	}
+
+	const bool full = m_blocks.size() != blockData.size()
+		|| generation - m_chainStart >= m_fullInterval;
+
+	FileHeader fileHeader;
+	fileHeader.identifier = identifier();
+	fileHeader.generation = generation;
+	fileHeader.chainStart = full ? generation : m_chainStart;
+	fileHeader.numBlocks = blockData.size();
+	fileHeader.userHeaderSize = headerSize;
+
+	const int ret = mkdir(generationDir(generation).c_str(), S_IRWXU | S_IRWXG | S_IRWXO);
+	if (ret < 0 && errno != EEXIST)
+		checkErr(ret);
+
+	const int file = open64(generationFile(generation).c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+		S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+	checkErr(file);
+
+	// The block table is written once the offsets of the compressed blocks are known
+	const off64_t blockTableOffset = sizeof(FileHeader) + headerSize;
+	std::vector<BlockEntry> blocks(blockData.size());
+	writeAll(file, &fileHeader, sizeof(FileHeader));
+	writeAll(file, header, headerSize);
+	writeAll(file, blocks.data(), blocks.size() * sizeof(BlockEntry));
+
+	// Compress and write the blocks that changed since the last generation in batches,
+	// such that only the compressed data of one batch is kept in memory
+#ifdef _OPENMP
+	const size_t batchSize = 4 * omp_get_max_threads();
+#else // _OPENMP
+	const size_t batchSize = 4;
+#endif // _OPENMP
+	std::vector<std::vector<uint8_t>> compressed(std::min(batchSize, blockData.size()));
+	uint64_t offset = blockTableOffset + blocks.size() * sizeof(BlockEntry);
+	m_rawBytes = 0;
+	for (size_t batchStart = 0; batchStart < blockData.size(); batchStart += batchSize) {
+		const size_t batchEnd = std::min(batchStart + batchSize, blockData.size());
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic)
+#endif // _OPENMP
+		for (size_t i = batchStart; i < batchEnd; i++) {
+			const uint64_t hash = hashBlock(blockData[i].data, blockData[i].size);
+			if (!full && m_blocks[i].hash == hash && m_blocks[i].size == blockData[i].size) {
+				blocks[i] = m_blocks[i];
+				continue;
+			}
+
+			std::vector<uint8_t> &data = compressed[i - batchStart];
+			blocks[i].generation = generation;
+			blocks[i].size = blockData[i].size;
+			blocks[i].hash = hash;
+			blocks[i].encoding = static_cast<uint32_t>(
+				compressBlock(blockData[i].data, blockData[i].size, sizeof(real), data));
+			blocks[i].compressedSize = data.size();
+			blocks[i].padding = 0;
+		}
+
+		for (size_t i = batchStart; i < batchEnd; i++) {
+			m_rawBytes += blocks[i].size;
+			if (blocks[i].generation == generation) {
+				blocks[i].offset = offset;
+				offset += blocks[i].compressedSize;
+				writeAll(file, compressed[i - batchStart].data(), compressed[i - batchStart].size());
+			}
+		}
+	}
+	m_writtenBytes = offset;
+
+	writeAllAt(file, blocks.data(), blocks.size() * sizeof(BlockEntry), blockTableOffset);
+
+	checkErr(fsync(file));
+	checkErr(::close(file));
+
+	logInfo(rank()) << "Checkpoint backend: Wrote" << (full ? "full" : "incremental")
+		<< "checkpoint" << generation << "(compression ratio"
+		<< static_cast<double>(m_rawBytes) / m_writtenBytes << ")";
+
+	if (full)
+		m_chainStart = generation;
+	m_blocks = blocks;
+	m_writtenGeneration = generation;
+	m_generation++;
+}
+
+void seissol::checkpoint::compressed::CheckPoint::loadSegments(void* header, size_t headerSize,
+	const std::vector<Segment> &segments)
+{
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	const long generation = linkedGeneration();
+
+	FileHeader fileHeader;
+	std::vector<BlockEntry> blocks;
+	std::vector<char> userHeader;
+	if (!readBlockTable(generation, fileHeader, blocks, &userHeader))
+		logError() << "Could not read checkpoint" << generationFile(generation);
+	if (userHeader.size() != headerSize)
+		logError() << "Unexpected header size in checkpoint" << generationFile(generation);
+	memcpy(header, userHeader.data(), headerSize);
+
+	// Reassemble the blocks from all generations of the chain
+	std::map<uint64_t, int> files;
+	std::vector<uint8_t> compressed;
+	size_t block = 0;
+	for (const auto& segment : segments) {
+		for (size_t offset = 0; offset < segment.size; offset += m_blockSize, block++) {
+			const size_t size = std::min(m_blockSize, segment.size - offset);
+			if (block >= blocks.size() || blocks[block].size != size)
+				logError() << "The checkpoint" << generationFile(generation)
+					<< "does not match the data layout (or block size)";
+
+			const BlockEntry &entry = blocks[block];
+			auto file = files.find(entry.generation);
+			if (file == files.end()) {
+				const int fh = open64(generationFile(entry.generation).c_str(), O_RDONLY);
+				if (fh < 0)
+					logError() << "Missing checkpoint" << generationFile(entry.generation)
+						<< "of the chain";
+				file = files.emplace(entry.generation, fh).first;
+			}
+
+			compressed.resize(entry.compressedSize);
+			char* data = static_cast<char*>(segment.data) + offset;
+			if (!readAll(file->second, compressed.data(), entry.compressedSize, entry.offset)
+					|| !decompressBlock(static_cast<BlockEncoding>(entry.encoding), compressed.data(),
+						entry.compressedSize, sizeof(real), data, size)
+					|| hashBlock(data, size) != entry.hash)
+				logError() << "Corrupt block" << block << "in checkpoint"
+					<< generationFile(entry.generation);
+		}
+	}
+	if (block != blocks.size())
+		logError() << "The checkpoint" << generationFile(generation)
+			<< "does not match the data layout (or block size)";
+
+	for (const auto& file : files)
+		checkErr(::close(file.second));
+}
+
+long seissol::checkpoint::compressed::CheckPoint::linkedGeneration() const
+{
+	char target[4096];
+	const ssize_t size = readlink(linkFile(), target, sizeof(target) - 1);
+	if (size < 0)
+		return -1;
+	target[size] = '\0';
+
+	const std::string prefix = utils::Path(linkFile()).basename() + ".";
+	const std::string name(target);
+	if (name.compare(0, prefix.size(), prefix) != 0 || name.size() == prefix.size())
+		return -1;
+
+	char* end;
+	const long generation = strtol(name.c_str() + prefix.size(), &end, 10);
+	if (*end != '\0' || generation < 0)
+		return -1;
+
+	return generation;
+}
+
+std::string seissol::checkpoint::compressed::CheckPoint::generationName(uint64_t generation) const
+{
+	return utils::Path(linkFile()).basename() + "." + utils::StringUtils::toString(generation);
+}
+
+std::string seissol::checkpoint::compressed::CheckPoint::generationDir(uint64_t generation) const
+{
+	return utils::Path(linkFile()).dir() + utils::Path(generationName(generation));
+}
+
+std::string seissol::checkpoint::compressed::CheckPoint::generationFile(uint64_t generation) const
+{
+	return generationDir(generation) + "/" + fname() + "." + utils::StringUtils::toString(rank());
+}
+
+bool seissol::checkpoint::compressed::CheckPoint::readBlockTable(uint64_t generation,
+	FileHeader &fileHeader, std::vector<BlockEntry> &blocks, std::vector<char>* userHeader) const
+{
+	const int file = open64(generationFile(generation).c_str(), O_RDONLY);
+	if (file < 0) {
+		logWarning() << "Could not open checkpoint file" << generationFile(generation);
+		return false;
+	}
+
+	bool valid = readAll(file, &fileHeader, sizeof(FileHeader), 0);
+	if (valid && (fileHeader.identifier != identifier() || fileHeader.generation != generation)) {
+		logWarning() << "Checkpoint identifier or generation does not match" << fileHeader.identifier
+			<< identifier();
+		valid = false;
+	}
+
+	if (valid && userHeader) {
+		userHeader->resize(fileHeader.userHeaderSize);
+		valid = readAll(file, userHeader->data(), fileHeader.userHeaderSize, sizeof(FileHeader));
+	}
+
+	if (valid) {
+		blocks.resize(fileHeader.numBlocks);
+		valid = readAll(file, blocks.data(), blocks.size() * sizeof(BlockEntry),
+			sizeof(FileHeader) + fileHeader.userHeaderSize);
+	}
+
+	::close(file);
+	return valid;
+}
+
+void seissol::checkpoint::compressed::CheckPoint::removeGenerations(uint64_t first, uint64_t last)
+{
+	for (uint64_t generation = first; generation < last; generation++) {
+		remove(generationFile(generation).c_str());
+		// Only succeeds for the last rank
+		rmdir(generationDir(generation).c_str());
+	}
+}
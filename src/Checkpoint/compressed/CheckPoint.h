@@ -0,0 +1,179 @@
+#ifndef CHECKPOINT_COMPRESSED_CHECK_POINT_H
+#define CHECKPOINT_COMPRESSED_CHECK_POINT_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+
+#include "Checkpoint/CheckPoint.h"
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace compressed
+{
+
+/**
+ * Checkpoints with one file per rank, where the data is split into blocks which are
+ * byte-shuffled and run-length encoded.
+ *
+ * Each checkpoint is a new generation stored in its own directory. An incremental
+ * checkpoint only stores the blocks that changed since the previous generation and
+ * references the unchanged blocks in the older generations. Every
+ * SEISSOL_CHECKPOINT_FULL_INTERVAL checkpoints a full checkpoint starts a new chain,
+ * and the generations of the previous chain are removed.
+ */
+class CheckPoint : virtual public seissol::checkpoint::CheckPoint
+{
+public:
+	/** A contiguous part of the data */
+	struct Segment {
+		void* data;
+		size_t size;
+	};
+
+private:
+	struct FileHeader {
+		unsigned long identifier;
+		uint64_t generation;
+		/** First generation of the chain */
+		uint64_t chainStart;
+		uint64_t numBlocks;
+		uint64_t userHeaderSize;
+	};
+
+	struct BlockEntry {
+		/** Generation of the file which stores the block */
+		uint64_t generation;
+		/** Offset in this file */
+		uint64_t offset;
+		uint64_t compressedSize;
+		uint64_t size;
+		uint64_t hash;
+		uint32_t encoding;
+		uint32_t padding;
+	};
+
+	/** Uncompressed size of the blocks */
+	size_t m_blockSize;
+
+	/** Number of checkpoints until the next full checkpoint (1 = only full checkpoints) */
+	unsigned int m_fullInterval;
+
+	/** Generation of the next checkpoint */
+	uint64_t m_generation;
+
+	/** First generation of the current chain */
+	uint64_t m_chainStart;
+
+	/** First generation of the previous chain (removed after the next full checkpoint) */
+	uint64_t m_previousChainStart;
+
+	/** Generation of the last written checkpoint */
+	uint64_t m_writtenGeneration;
+
+	/** Blocks of the last checkpoint (written or loaded) */
+	std::vector<BlockEntry> m_blocks;
+
+	/** Statistics of the last checkpoint */
+	uint64_t m_rawBytes;
+	uint64_t m_writtenBytes;
+
+public:
+	CheckPoint(unsigned long identifier);
+
+	virtual ~CheckPoint() {}
+
+	void setFilename(const char* filename)
+	{
+		initFilename(filename, 0L);
+	}
+
+	/**
+	 * Points the link to the generation just written and removes the
+	 * previous chain after a full checkpoint
+	 */
+	void updateLink();
+
+	void close()
+	{
+	}
+
+protected:
+	/**
+	 * Validates the latest generation of this rank
+	 */
+	bool exists();
+
+	void createFiles();
+
+	/**
+	 * Writes the next generation
+	 *
+	 * @param header User header, stored uncompressed
+	 * @param segments The data (blocks never span multiple segments)
+	 */
+	void writeSegments(const void* header, size_t headerSize, const std::vector<Segment> &segments);
+
+	/**
+	 * Loads the latest generation and reassembles the data from the chain
+	 */
+	void loadSegments(void* header, size_t headerSize, const std::vector<Segment> &segments);
+
+private:
+	/**
+	 * @return The generation the link points to, or -1 if no link exists
+	 */
+	long linkedGeneration() const;
+
+	std::string generationName(uint64_t generation) const;
+
+	std::string generationDir(uint64_t generation) const;
+
+	std::string generationFile(uint64_t generation) const;
+
+	/**
+	 * Reads the header and the block table of a generation
+	 *
+	 * @return False if the file is missing or not a valid checkpoint
+	 */
+	bool readBlockTable(uint64_t generation, FileHeader &fileHeader,
+		std::vector<BlockEntry> &blocks, std::vector<char>* userHeader = 0L) const;
+
+	/**
+	 * Removes the files of this rank for the generations [first, last)
+	 */
+	void removeGenerations(uint64_t first, uint64_t last);
+
+	template<typename T>
+	static void checkErr(T ret)
+	{
+		if (ret < 0)
+			logError() << "Error in the compressed checkpoint module:" << strerror(errno);
+	}
+
+	template<typename T, typename U>
+	static void checkErr(T ret, U target)
+	{
+		checkErr(ret);
+		if (ret != static_cast<T>(target))
+			logError() << "Error in the compressed checkpoint module:"
+				<< target << "bytes expected;" << ret << "bytes gotten";
+	}
+};
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_COMPRESSED_CHECK_POINT_H
@@ -0,0 +1,46 @@
+#include "Fault.h"
+
+bool seissol::checkpoint::compressed::Fault::init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize)
+{
+	seissol::checkpoint::Fault::init(numSides, numBndGP, groupSize);
+
+	if (numSides == 0)
+		return true;
+
+	return exists();
+}
+
+void seissol::checkpoint::compressed::Fault::load(int &timestepFault, real* mu, real* slipRate1, real* slipRate2,
+	real* slip, real* slip1, real* slip2, real* state, real* strength)
+{
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Loading fault checkpoint";
+
+	real* data[NUM_VARIABLES] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+
+	std::vector<Segment> segments;
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		segments.push_back({data[i], numSides() * numBndGP() * sizeof(real)});
+
+	loadSegments(&timestepFault, sizeof(timestepFault), segments);
+}
+
+void seissol::checkpoint::compressed::Fault::write(int timestepFault)
+{
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault.";
+
+	// The data is only read
+	std::vector<Segment> segments;
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		segments.push_back({const_cast<real*>(data(i)), numSides() * numBndGP() * sizeof(real)});
+
+	writeSegments(&timestepFault, sizeof(timestepFault), segments);
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
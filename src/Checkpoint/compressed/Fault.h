@@ -0,0 +1,55 @@
+#ifndef CHECKPOINT_COMPRESSED_FAULT_H
+#define CHECKPOINT_COMPRESSED_FAULT_H
+
+#include "CheckPoint.h"
+#include "Checkpoint/Fault.h"
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace compressed
+{
+
+class Fault : public CheckPoint, virtual public seissol::checkpoint::Fault
+{
+public:
+	Fault()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Fault(IDENTIFIER),
+		CheckPoint(IDENTIFIER)
+	{}
+
+	bool init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize = 1);
+
+	/**
+	 * @param[out] timestepFault Time step of the fault writer in the checkpoint
+	 *  (if the fault writer was active)
+	 */
+	void load(int &timestepFault, real* mu, real* slipRate1, real* slipRate2,
+		real* slip, real* slip1, real* slip2, real* state, real* strength);
+
+	void write(int timestepFault);
+
+	void updateLink()
+	{
+		if (numSides() == 0)
+			return;
+
+		CheckPoint::updateLink();
+	}
+
+private:
+	static const unsigned long IDENTIFIER = 0x7A1C7;
+};
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_COMPRESSED_FAULT_H
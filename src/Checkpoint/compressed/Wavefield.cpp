@@ -0,0 +1,25 @@
+#include "Wavefield.h"
+
+bool seissol::checkpoint::compressed::Wavefield::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
+{
+	seissol::checkpoint::Wavefield::init(headerSize, numDofs, groupSize);
+
+	return exists();
+}
+
+void seissol::checkpoint::compressed::Wavefield::load(real* dofs)
+{
+	logInfo(rank()) << "Loading wave field checkpoint";
+
+	loadSegments(header().data(), header().size(), {{dofs, numDofs() * sizeof(real)}});
+}
+
+void seissol::checkpoint::compressed::Wavefield::write(const void* header, size_t headerSize)
+{
+	logInfo(rank()) << "Checkpoint backend: Writing.";
+
+	// The data is only read
+	writeSegments(header, headerSize, {{const_cast<real*>(dofs()), numDofs() * sizeof(real)}});
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
@@ -0,0 +1,42 @@
+#ifndef CHECKPOINT_COMPRESSED_WAVEFIELD_H
+#define CHECKPOINT_COMPRESSED_WAVEFIELD_H
+
+#include "CheckPoint.h"
+#include "Checkpoint/Wavefield.h"
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace compressed
+{
+
+class Wavefield : public CheckPoint, virtual public seissol::checkpoint::Wavefield
+{
+public:
+	Wavefield()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		CheckPoint(IDENTIFIER)
+	{
+	}
+
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1);
+
+	void load(real* dofs);
+
+	void write(const void* header, size_t headerSize);
+
+private:
+	static const unsigned long IDENTIFIER = 0x7A5C7;
+};
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_COMPRESSED_WAVEFIELD_H
@@ -1,6 +1,9 @@
 #ifndef SEISSOL_BASEFRICTIONLAW_H
 #define SEISSOL_BASEFRICTIONLAW_H
 
+#include <algorithm>
+#include <array>
+
 #include <yaml-cpp/yaml.h>
 
 #include "DynamicRupture/Misc.h"
@@ -8,6 +11,7 @@
 #include "FrictionSolver.h"
 #include "FrictionSolverCommon.h"
 #include "Monitoring/instrumentation.fpp"
+#include "Parallel/TaskScheduling.h"
 
 namespace seissol::dr::friction_law {
 /**
@@ -29,12 +33,17 @@ class BaseFrictionLaw : public FrictionSolver {
     SCOREP_USER_REGION_DEFINE(myRegionHandle)
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
+    numberOfLockedFaces = 0;
+
+    if constexpr (Derived::useFaceBlocks()) {
+      if (static_cast<Derived*>(this)->isFaceBlockingEnabled()) {
+        evaluateFaceBlocks(layerData.getNumberOfCells(), timeWeights);
+        return;
+      }
+    }
 
     // loop over all dynamic rupture faces, in this LTS layer
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
+    parallel::forEach(layerData.getNumberOfCells(), [&](unsigned ltsFace) {
       alignas(ALIGNMENT) FaultStresses faultStresses{};
       SCOREP_USER_REGION_BEGIN(
           myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
@@ -63,6 +72,9 @@ class BaseFrictionLaw : public FrictionSolver {
       LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
       TractionResults tractionResults = {};
 
+      // faces which stay locked during the whole time step skip the full friction update
+      bool isLocked = static_cast<Derived*>(this)->mayBeLocked(ltsFace);
+
       // loop over sub time steps (i.e. quadrature points in time)
       for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
         common::adjustInitialStress(initialStressInFaultCS[ltsFace],
@@ -71,12 +83,22 @@ class BaseFrictionLaw : public FrictionSolver {
                                     this->drParameters->t0,
                                     this->deltaT[timeIndex]);
 
-        static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
-                                                           tractionResults,
-                                                           stateVariableBuffer,
-                                                           strengthBuffer,
-                                                           ltsFace,
-                                                           timeIndex);
+        if (isLocked) {
+          isLocked = static_cast<Derived*>(this)->updateLockedFace(
+              faultStresses, tractionResults, strengthBuffer, ltsFace, timeIndex);
+        }
+        if (!isLocked) {
+          static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
+                                                             tractionResults,
+                                                             stateVariableBuffer,
+                                                             strengthBuffer,
+                                                             ltsFace,
+                                                             timeIndex);
+        }
+      }
+      if (isLocked) {
+        #pragma omp atomic
+        ++numberOfLockedFaces;
       }
       LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
       SCOREP_USER_REGION_END(myRegionHandle)
@@ -119,7 +141,150 @@ class BaseFrictionLaw : public FrictionSolver {
                                     timeWeights,
                                     spaceWeights,
                                     godunovData[ltsFace]);
-    }
+    });
+  }
+
+  /**
+   * Number of faces which are updated at once by updateFrictionAndSlipBlock.
+   */
+  static constexpr unsigned FaceBlockSize = 8;
+
+  /**
+   * Evaluates the friction law for blocks of FaceBlockSize faces, such that the friction law can
+   * update all faces of a block at once (see updateFrictionAndSlipBlock).
+   */
+  void evaluateFaceBlocks(unsigned numberOfFaces, const double timeWeights[CONVERGENCE_ORDER]) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    const unsigned numberOfBlocks = (numberOfFaces + FaceBlockSize - 1) / FaceBlockSize;
+    parallel::forEach(numberOfBlocks, [&](unsigned block) {
+      const unsigned firstFace = block * FaceBlockSize;
+      const unsigned blockSize = std::min(FaceBlockSize, numberOfFaces - firstFace);
+
+      alignas(ALIGNMENT) std::array<FaultStresses, FaceBlockSize> faultStresses{};
+      SCOREP_USER_REGION_BEGIN(
+          myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
+      LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
+      for (unsigned i = 0; i < blockSize; i++) {
+        const unsigned ltsFace = firstFace + i;
+        common::precomputeStressFromQInterpolated(faultStresses[i],
+                                                  impAndEta[ltsFace],
+                                                  qInterpolatedPlus[ltsFace],
+                                                  qInterpolatedMinus[ltsFace]);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
+      SCOREP_USER_REGION_END(myRegionHandle)
+
+      SCOREP_USER_REGION_BEGIN(
+          myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
+      LIKWID_MARKER_START("computeDynamicRupturePreHook");
+      // define some temporary variables
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> stateVariableBuffer{};
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> strengthBuffer{};
+      for (unsigned i = 0; i < blockSize; i++) {
+        static_cast<Derived*>(this)->preHook(stateVariableBuffer[i], firstFace + i);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
+      SCOREP_USER_REGION_END(myRegionHandle)
+
+      SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                               "computeDynamicRuptureUpdateFrictionAndSlip",
+                               SCOREP_USER_REGION_TYPE_COMMON)
+      LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+      std::array<TractionResults, FaceBlockSize> tractionResults{};
+
+      // loop over sub time steps (i.e. quadrature points in time)
+      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+        for (unsigned i = 0; i < blockSize; i++) {
+          common::adjustInitialStress(initialStressInFaultCS[firstFace + i],
+                                      nucleationStressInFaultCS[firstFace + i],
+                                      this->mFullUpdateTime,
+                                      this->drParameters->t0,
+                                      this->deltaT[timeIndex]);
+        }
+        static_cast<Derived*>(this)->updateFrictionAndSlipBlock(faultStresses,
+                                                                tractionResults,
+                                                                stateVariableBuffer,
+                                                                strengthBuffer,
+                                                                firstFace,
+                                                                blockSize,
+                                                                timeIndex);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
+      SCOREP_USER_REGION_END(myRegionHandle)
+
+      SCOREP_USER_REGION_BEGIN(
+          myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+      LIKWID_MARKER_START("computeDynamicRupturePostHook");
+      for (unsigned i = 0; i < blockSize; i++) {
+        const unsigned ltsFace = firstFace + i;
+        static_cast<Derived*>(this)->postHook(stateVariableBuffer[i], ltsFace);
+
+        common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
+                                       ruptureTime[ltsFace],
+                                       slipRateMagnitude[ltsFace],
+                                       mFullUpdateTime);
+
+        static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+
+        common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+      SCOREP_USER_REGION_END(myRegionHandle)
+
+      SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                               "computeDynamicRupturePostcomputeImposedState",
+                               SCOREP_USER_REGION_TYPE_COMMON)
+      LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
+      for (unsigned i = 0; i < blockSize; i++) {
+        const unsigned ltsFace = firstFace + i;
+        common::postcomputeImposedStateFromNewStress(faultStresses[i],
+                                                     tractionResults[i],
+                                                     impAndEta[ltsFace],
+                                                     imposedStatePlus[ltsFace],
+                                                     imposedStateMinus[ltsFace],
+                                                     qInterpolatedPlus[ltsFace],
+                                                     qInterpolatedMinus[ltsFace],
+                                                     timeWeights);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+      SCOREP_USER_REGION_END(myRegionHandle)
+
+      for (unsigned i = 0; i < blockSize; i++) {
+        const unsigned ltsFace = firstFace + i;
+        common::computeFrictionEnergy(energyData[ltsFace],
+                                      qInterpolatedPlus[ltsFace],
+                                      qInterpolatedMinus[ltsFace],
+                                      impAndEta[ltsFace],
+                                      timeWeights,
+                                      spaceWeights,
+                                      godunovData[ltsFace]);
+      }
+    });
+  }
+
+  /**
+   * Returns true if the friction law implements updateFrictionAndSlipBlock, which updates
+   * FaceBlockSize faces at once. The faces are then evaluated in blocks (see evaluateFaceBlocks).
+   */
+  static constexpr bool useFaceBlocks() { return false; }
+
+  /**
+   * Returns true if the face might stay locked during the whole time step, i.e. if the friction
+   * law only changes through slip. Friction laws without a locked-face fast path return false.
+   */
+  bool mayBeLocked(unsigned int ltsFace) { return false; }
+
+  /**
+   * Updates a locked face at one time point, if the traction stays below the fault strength at
+   * all points. Otherwise, returns false without any side effects and the full friction update
+   * has to be computed for this and the remaining time points.
+   */
+  bool updateLockedFace(FaultStresses const& faultStresses,
+                        TractionResults& tractionResults,
+                        std::array<real, misc::numPaddedPoints>& strengthBuffer,
+                        unsigned int ltsFace,
+                        unsigned int timeIndex) {
+    return false;
   }
 };
 } // namespace seissol::dr::friction_law
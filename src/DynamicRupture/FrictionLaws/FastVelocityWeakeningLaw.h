@@ -11,6 +11,12 @@ class FastVelocityWeakeningLaw
   public:
   using RateAndStateBase<FastVelocityWeakeningLaw, TPMethod>::RateAndStateBase;
 
+  /**
+   * The Newton iteration of the fast velocity weakening law is solved for blocks of faces (see
+   * RateAndStateBase::invertSlipRateBlock).
+   */
+  static constexpr bool UseFaceBlocks = true;
+
   /**
    * Copies all parameters from the DynamicRupture LTS to the local attributes
    */
@@ -84,8 +90,22 @@ class FastVelocityWeakeningLaw
                 unsigned int pointIndex,
                 real localSlipRateMagnitude,
                 real localStateVariable) const {
+    return computeMu(this->a[ltsFace][pointIndex],
+                     this->sl0[ltsFace][pointIndex],
+                     localSlipRateMagnitude,
+                     localStateVariable);
+  }
+
+  /**
+   * Same as updateMu for the parameters of a point, such that the Newton iteration can evaluate the
+   * friction coefficient of several faces at once (see RateAndStateBase::invertSlipRateBlock).
+   */
+  #pragma omp declare simd
+  real computeMu(real localA,
+                 real localSl0,
+                 real localSlipRateMagnitude,
+                 real localStateVariable) const {
     // mu = a * arcsinh ( V / (2*V_0) * exp (psi / a))
-    const real localA = this->a[ltsFace][pointIndex];
     // x in asinh(x) for mu calculation
     const real x = 0.5 / this->drParameters->rsSr0 * std::exp(localStateVariable / localA) *
                    localSlipRateMagnitude;
@@ -105,7 +125,20 @@ class FastVelocityWeakeningLaw
                           unsigned int pointIndex,
                           real localSlipRateMagnitude,
                           real localStateVariable) const {
-    const real localA = this->a[ltsFace][pointIndex];
+    return computeMuDerivative(this->a[ltsFace][pointIndex],
+                               this->sl0[ltsFace][pointIndex],
+                               localSlipRateMagnitude,
+                               localStateVariable);
+  }
+
+  /**
+   * Same as updateMuDerivative for the parameters of a point (see computeMu).
+   */
+  #pragma omp declare simd
+  real computeMuDerivative(real localA,
+                           real localSl0,
+                           real localSlipRateMagnitude,
+                           real localStateVariable) const {
     const real c = 0.5 / this->drParameters->rsSr0 * std::exp(localStateVariable / localA);
     return localA * c / std::sqrt(misc::power<2, double>(localSlipRateMagnitude * c) + 1.0);
   }
@@ -34,6 +34,12 @@ class FrictionSolver {
    */
   void computeDeltaT(const double timePoints[CONVERGENCE_ORDER]);
 
+  /**
+   * Number of faces which stayed locked during the last call of evaluate and hence were updated
+   * with the reduced kernel.
+   */
+  [[nodiscard]] unsigned getNumberOfLockedFaces() const { return numberOfLockedFaces; }
+
   /**
    * copies all common parameters from the DynamicRupture LTS to the local attributes
    */
@@ -47,6 +53,7 @@ class FrictionSolver {
    * For reference, see: https://strike.scec.org/cvws/download/SCEC_validation_slip_law.pdf.
    */
   real deltaT[CONVERGENCE_ORDER] = {};
+  unsigned numberOfLockedFaces = 0;
 
   dr::DRParameters* drParameters;
   ImpedancesAndEta* impAndEta;
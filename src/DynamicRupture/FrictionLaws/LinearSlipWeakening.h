@@ -3,6 +3,8 @@
 
 #include "BaseFrictionLaw.h"
 
+#include <algorithm>
+
 #include "utils/logger.h"
 
 namespace seissol::dr::friction_law {
@@ -100,6 +102,65 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
     }
   }
 
+  /**
+   * Without slip, the friction coefficient only changes through the forced rupture, hence, a face
+   * may stay locked if the forced rupture does not start before the end of the time step.
+   */
+  bool mayBeLocked(unsigned int ltsFace) {
+    if constexpr (SpecializationT::HasSlipIndependentStrength) {
+      const real maxDeltaT = *std::max_element(std::begin(this->deltaT), std::end(this->deltaT));
+      const real maxTime = this->mFullUpdateTime + maxDeltaT;
+      bool forcedRupture = false;
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+        forcedRupture |= maxTime >= forcedRuptureTime[ltsFace][pointIndex];
+      }
+      return !forcedRupture;
+    } else {
+      return false;
+    }
+  }
+
+  /**
+   * If the absolute traction is below the strength at all points, the slip rate vanishes, the
+   * traction equals the fault stresses and slip, state variable and friction coefficient remain
+   * unchanged. This gives the same result as calcSlipRateAndTraction and the hooks.
+   */
+  bool updateLockedFace(FaultStresses const& faultStresses,
+                        TractionResults& tractionResults,
+                        std::array<real, misc::numPaddedPoints>& strength,
+                        unsigned int ltsFace,
+                        unsigned int timeIndex) {
+    this->calcStrengthHook(faultStresses, strength, timeIndex, ltsFace);
+
+    unsigned numberOfSlippingPoints = 0;
+    #pragma omp simd reduction(+ : numberOfSlippingPoints)
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      const real totalTraction1 = this->initialStressInFaultCS[ltsFace][pointIndex][3] +
+                                  faultStresses.traction1[timeIndex][pointIndex];
+      const real totalTraction2 = this->initialStressInFaultCS[ltsFace][pointIndex][5] +
+                                  faultStresses.traction2[timeIndex][pointIndex];
+      const real absoluteTraction = misc::magnitude(totalTraction1, totalTraction2);
+      numberOfSlippingPoints += absoluteTraction >= strength[pointIndex] ? 1 : 0;
+    }
+    if (numberOfSlippingPoints > 0) {
+      return false;
+    }
+
+    #pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      this->slipRateMagnitude[ltsFace][pointIndex] = 0.0;
+      this->slipRate1[ltsFace][pointIndex] = 0.0;
+      this->slipRate2[ltsFace][pointIndex] = 0.0;
+      tractionResults.traction1[timeIndex][pointIndex] =
+          faultStresses.traction1[timeIndex][pointIndex];
+      tractionResults.traction2[timeIndex][pointIndex] =
+          faultStresses.traction2[timeIndex][pointIndex];
+      this->traction1[ltsFace][pointIndex] = tractionResults.traction1[timeIndex][pointIndex];
+      this->traction2[ltsFace][pointIndex] = tractionResults.traction2[timeIndex][pointIndex];
+    }
+    return true;
+  }
+
   void preHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
                unsigned int ltsFace){};
   void postHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
@@ -203,6 +264,9 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
 
 class NoSpecialization {
   public:
+  //! the strength only depends on the current stress and friction coefficient
+  static constexpr bool HasSlipIndependentStrength = true;
+
   explicit NoSpecialization(DRParameters* parameters){};
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
@@ -231,6 +295,9 @@ class NoSpecialization {
  */
 class BiMaterialFault {
   public:
+  //! the regularized strength evolves in time, even without slip
+  static constexpr bool HasSlipIndependentStrength = false;
+
   explicit BiMaterialFault(DRParameters* parameters) : drParameters(parameters){};
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
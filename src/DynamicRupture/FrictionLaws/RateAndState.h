@@ -12,6 +12,9 @@ namespace seissol::dr::friction_law {
 template <class Derived, class TPMethod>
 class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>> {
   public:
+  static constexpr unsigned FaceBlockSize =
+      BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>>::FaceBlockSize;
+
   explicit RateAndStateBase(DRParameters* drParameters)
       : BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>>::BaseFrictionLaw(drParameters),
         tpMethod(TPMethod(drParameters)) {}
@@ -45,6 +48,102 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                                        timeIndex,
                                        ltsFace);
 
+    finalizeFrictionAndSlip(hasConverged,
+                            stateVarReference,
+                            localSlipRate,
+                            stateVariableBuffer,
+                            normalStress,
+                            absoluteShearStress,
+                            faultStresses,
+                            tractionResults,
+                            timeIndex,
+                            ltsFace);
+  }
+
+  /**
+   * Alternative to updateFrictionAndSlip, which solves for the slip rates of a block of faces at
+   * once (see invertSlipRateBlock). Used by the friction laws with UseFaceBlocks.
+   */
+  void updateFrictionAndSlipBlock(
+      std::array<FaultStresses, FaceBlockSize> const& faultStresses,
+      std::array<TractionResults, FaceBlockSize>& tractionResults,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize>& stateVariableBuffer,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize>& strengthBuffer,
+      unsigned int firstFace,
+      unsigned int blockSize,
+      unsigned int timeIndex) {
+    std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> absoluteShearStress;
+    std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> localSlipRate;
+    std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> normalStress;
+    std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> stateVarReference;
+    std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> testSlipRate{};
+    std::array<bool, FaceBlockSize> hasConverged{};
+
+    for (unsigned i = 0; i < blockSize; i++) {
+      auto initialVariables = static_cast<Derived*>(this)->calcInitialVariables(
+          faultStresses[i], stateVariableBuffer[i], timeIndex, firstFace + i);
+      absoluteShearStress[i] = initialVariables.absoluteShearTraction;
+      localSlipRate[i] = initialVariables.localSlipRate;
+      normalStress[i] = initialVariables.normalStress;
+      stateVarReference[i] = initialVariables.stateVarReference;
+    }
+
+    for (unsigned j = 0; j < settings.numberStateVariableUpdates; j++) {
+      for (unsigned i = 0; i < blockSize; i++) {
+        updateStateVariableAndNormalStress(stateVarReference[i],
+                                           localSlipRate[i],
+                                           stateVariableBuffer[i],
+                                           normalStress[i],
+                                           faultStresses[i],
+                                           timeIndex,
+                                           firstFace + i);
+      }
+      invertSlipRateBlock(firstFace,
+                          blockSize,
+                          stateVariableBuffer,
+                          normalStress,
+                          absoluteShearStress,
+                          testSlipRate,
+                          hasConverged);
+      for (unsigned i = 0; i < blockSize; i++) {
+        updateSlipRateAndMu(
+            localSlipRate[i], stateVariableBuffer[i], testSlipRate[i], firstFace + i);
+      }
+    }
+
+    for (unsigned i = 0; i < blockSize; i++) {
+      finalizeFrictionAndSlip(hasConverged[i],
+                              stateVarReference[i],
+                              localSlipRate[i],
+                              stateVariableBuffer[i],
+                              normalStress[i],
+                              absoluteShearStress[i],
+                              faultStresses[i],
+                              tractionResults[i],
+                              timeIndex,
+                              firstFace + i);
+    }
+  }
+
+  static constexpr bool useFaceBlocks() { return Derived::UseFaceBlocks; }
+
+  //! runtime opt-out of the face blocks (RS_NewtonFaceBlocks = 0)
+  bool isFaceBlockingEnabled() const { return this->drParameters->rsNewtonFaceBlocks; }
+
+  /**
+   * Computes the final slip rates and traction from the average of the iterative solution and the
+   * initial guess.
+   */
+  void finalizeFrictionAndSlip(bool hasConverged,
+                               std::array<real, misc::numPaddedPoints> const& stateVarReference,
+                               std::array<real, misc::numPaddedPoints> const& localSlipRate,
+                               std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
+                               std::array<real, misc::numPaddedPoints>& normalStress,
+                               std::array<real, misc::numPaddedPoints> const& absoluteShearStress,
+                               FaultStresses const& faultStresses,
+                               TractionResults& tractionResults,
+                               unsigned int timeIndex,
+                               unsigned int ltsFace) {
     // check for convergence
     if (!hasConverged) {
       static_cast<Derived*>(this)->executeIfNotConverged(stateVariableBuffer, ltsFace);
@@ -87,6 +186,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     stateVariable = layerData.var(concreteLts->stateVariable);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     tpMethod.copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
+    tpMethod.precomputeDecayFactors(this->deltaT);
   }
 
   /**
@@ -149,50 +249,74 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
       unsigned int ltsFace) {
     std::array<real, misc::numPaddedPoints> testSlipRate{0};
     for (unsigned j = 0; j < settings.numberStateVariableUpdates; j++) {
-      #pragma omp simd
-      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-        // fault strength using friction coefficient and fluid pressure from previous
-        // timestep/iteration update state variable using sliprate from the previous time step
-        localStateVariable[pointIndex] =
-            static_cast<Derived*>(this)->updateStateVariable(pointIndex,
-                                                             ltsFace,
-                                                             stateVarReference[pointIndex],
-                                                             this->deltaT[timeIndex],
-                                                             localSlipRate[pointIndex]);
-      }
-      this->tpMethod.calcFluidPressure(normalStress,
-                                       this->mu,
-                                       localSlipRate,
-                                       this->deltaT[timeIndex],
-                                       false,
-                                       timeIndex,
-                                       ltsFace);
-
-      updateNormalStress(normalStress, faultStresses, timeIndex, ltsFace);
+      updateStateVariableAndNormalStress(stateVarReference,
+                                         localSlipRate,
+                                         localStateVariable,
+                                         normalStress,
+                                         faultStresses,
+                                         timeIndex,
+                                         ltsFace);
 
       // solve for new slip rate
       hasConverged = this->invertSlipRateIterative(
           ltsFace, localStateVariable, normalStress, absoluteShearStress, testSlipRate);
 
-      #pragma omp simd
-      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-        // update local slip rate, now using V=(Vnew+Vold)/2
-        // For the next SV update, use the mean slip rate between the initial guess and the one
-        // found (Kaneko 2008, step 6)
-        localSlipRate[pointIndex] = 0.5 * (this->slipRateMagnitude[ltsFace][pointIndex] +
-                                           std::fabs(testSlipRate[pointIndex]));
-
-        // solve again for Vnew
-        this->slipRateMagnitude[ltsFace][pointIndex] = std::fabs(testSlipRate[pointIndex]);
-
-        // update friction coefficient based on new state variable and slip rate
-        this->mu[ltsFace][pointIndex] =
-            static_cast<Derived*>(this)->updateMu(ltsFace,
-                                                  pointIndex,
-                                                  this->slipRateMagnitude[ltsFace][pointIndex],
-                                                  localStateVariable[pointIndex]);
-      } // End of pointIndex-loop
+      updateSlipRateAndMu(localSlipRate, localStateVariable, testSlipRate, ltsFace);
+    }
+  }
+
+  void updateStateVariableAndNormalStress(
+      std::array<real, misc::numPaddedPoints> const& stateVarReference,
+      std::array<real, misc::numPaddedPoints>& localSlipRate,
+      std::array<real, misc::numPaddedPoints>& localStateVariable,
+      std::array<real, misc::numPaddedPoints>& normalStress,
+      FaultStresses const& faultStresses,
+      unsigned int timeIndex,
+      unsigned int ltsFace) {
+    #pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      // fault strength using friction coefficient and fluid pressure from previous
+      // timestep/iteration update state variable using sliprate from the previous time step
+      localStateVariable[pointIndex] =
+          static_cast<Derived*>(this)->updateStateVariable(pointIndex,
+                                                           ltsFace,
+                                                           stateVarReference[pointIndex],
+                                                           this->deltaT[timeIndex],
+                                                           localSlipRate[pointIndex]);
     }
+    this->tpMethod.calcFluidPressure(normalStress,
+                                     this->mu,
+                                     localSlipRate,
+                                     this->deltaT[timeIndex],
+                                     false,
+                                     timeIndex,
+                                     ltsFace);
+
+    updateNormalStress(normalStress, faultStresses, timeIndex, ltsFace);
+  }
+
+  void updateSlipRateAndMu(std::array<real, misc::numPaddedPoints>& localSlipRate,
+                           std::array<real, misc::numPaddedPoints> const& localStateVariable,
+                           std::array<real, misc::numPaddedPoints> const& testSlipRate,
+                           unsigned int ltsFace) {
+    #pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      // update local slip rate, now using V=(Vnew+Vold)/2
+      // For the next SV update, use the mean slip rate between the initial guess and the one
+      // found (Kaneko 2008, step 6)
+      localSlipRate[pointIndex] = 0.5 * (this->slipRateMagnitude[ltsFace][pointIndex] +
+                                         std::fabs(testSlipRate[pointIndex]));
+
+      // solve again for Vnew
+      this->slipRateMagnitude[ltsFace][pointIndex] = std::fabs(testSlipRate[pointIndex]);
+
+      // update friction coefficient based on new state variable and slip rate
+      this->mu[ltsFace][pointIndex] =
+          static_cast<Derived*>(this)->updateMu(ltsFace,
+                                                pointIndex,
+                                                this->slipRateMagnitude[ltsFace][pointIndex],
+                                                localStateVariable[pointIndex]);
+    } // End of pointIndex-loop
   }
 
   void calcSlipRateAndTraction(std::array<real, misc::numPaddedPoints> const& stateVarReference,
@@ -349,6 +473,116 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     return false;
   }
 
+  /**
+   * Same Newton-Raphson algorithm as invertSlipRateIterative for a block of faces.
+   * The points are stored per face ([point][face]), such that each face of the block is a SIMD lane
+   * of the iteration. Each point has a convergence mask: a converged point keeps its slip rate
+   * while the other points of the block iterate, a face has converged once all of its points have
+   * converged and the iteration stops as soon as all faces of the block have converged.
+   * Hence, the slip rates agree with invertSlipRateIterative within the Newton tolerance.
+   * Lanes beyond blockSize repeat the first face and do not iterate.
+   * Requires computeMu and computeMuDerivative of the friction law.
+   * @param firstFace index of the first face of the block
+   * @param blockSize number of faces of the block
+   * @param hasConverged set to true for the faces which have converged
+   */
+  void invertSlipRateBlock(
+      unsigned int firstFace,
+      unsigned int blockSize,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> const& localStateVariable,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> const& normalStress,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize> const& absoluteShearStress,
+      std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize>& slipRateTest,
+      std::array<bool, FaceBlockSize>& hasConverged) {
+    using PointsPerFace = real[misc::numPaddedPoints][FaceBlockSize];
+    alignas(ALIGNMENT) PointsPerFace localA;
+    alignas(ALIGNMENT) PointsPerFace localSl0;
+    alignas(ALIGNMENT) PointsPerFace stateVariableBlock;
+    alignas(ALIGNMENT) PointsPerFace normalStressBlock;
+    alignas(ALIGNMENT) PointsPerFace absoluteShearStressBlock;
+    alignas(ALIGNMENT) PointsPerFace slipRateBlock;
+    // Note that we need double precision here, since single precision led to NaNs.
+    alignas(ALIGNMENT) double g[misc::numPaddedPoints][FaceBlockSize];
+    alignas(ALIGNMENT) double dG[misc::numPaddedPoints][FaceBlockSize];
+    alignas(ALIGNMENT) double invEtaS[FaceBlockSize];
+    // 1 if the point still iterates, 0 once it has converged
+    alignas(ALIGNMENT) PointsPerFace isActive;
+
+    for (unsigned i = 0; i < FaceBlockSize; i++) {
+      const unsigned face = i < blockSize ? i : 0;
+      const unsigned ltsFace = firstFace + face;
+      invEtaS[i] = this->impAndEta[ltsFace].invEtaS;
+      hasConverged[i] = false;
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        isActive[pointIndex][i] = i < blockSize ? 1.0 : 0.0;
+        localA[pointIndex][i] = this->a[ltsFace][pointIndex];
+        localSl0[pointIndex][i] = this->sl0[ltsFace][pointIndex];
+        stateVariableBlock[pointIndex][i] = localStateVariable[face][pointIndex];
+        normalStressBlock[pointIndex][i] = std::fabs(normalStress[face][pointIndex]);
+        absoluteShearStressBlock[pointIndex][i] = absoluteShearStress[face][pointIndex];
+        // first guess = sliprate value of the previous step
+        slipRateBlock[pointIndex][i] = this->slipRateMagnitude[ltsFace][pointIndex];
+      }
+    }
+
+    for (unsigned j = 0; j < settings.maxNumberSlipRateUpdates; j++) {
+      // number of points per face which have not converged yet
+      alignas(ALIGNMENT) unsigned numberOfResiduals[FaceBlockSize] = {0};
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        #pragma omp simd
+        for (unsigned i = 0; i < FaceBlockSize; i++) {
+          // calculate friction coefficient and objective function
+          const double muF =
+              static_cast<Derived*>(this)->computeMu(localA[pointIndex][i],
+                                                     localSl0[pointIndex][i],
+                                                     slipRateBlock[pointIndex][i],
+                                                     stateVariableBlock[pointIndex][i]);
+          const double dMuF =
+              static_cast<Derived*>(this)->computeMuDerivative(localA[pointIndex][i],
+                                                               localSl0[pointIndex][i],
+                                                               slipRateBlock[pointIndex][i],
+                                                               stateVariableBlock[pointIndex][i]);
+          g[pointIndex][i] =
+              -invEtaS[i] * (normalStressBlock[pointIndex][i] * muF -
+                             absoluteShearStressBlock[pointIndex][i]) -
+              slipRateBlock[pointIndex][i];
+          dG[pointIndex][i] = -invEtaS[i] * (normalStressBlock[pointIndex][i] * dMuF) - 1.0;
+          // freeze the point once its g is smaller than newtonTolerance
+          const bool isPointConverged = std::fabs(g[pointIndex][i]) < settings.newtonTolerance;
+          isActive[pointIndex][i] = isPointConverged ? 0.0 : isActive[pointIndex][i];
+          numberOfResiduals[i] += isActive[pointIndex][i] > 0.0 ? 1 : 0;
+        }
+      }
+
+      bool isBlockActive = false;
+      for (unsigned i = 0; i < blockSize; i++) {
+        hasConverged[i] = numberOfResiduals[i] == 0;
+        isBlockActive = isBlockActive || !hasConverged[i];
+      }
+      if (!isBlockActive) {
+        break;
+      }
+
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        #pragma omp simd
+        for (unsigned i = 0; i < FaceBlockSize; i++) {
+          // newton update
+          const real tmp3 = g[pointIndex][i] / dG[pointIndex][i];
+          const real updatedSlipRate =
+              std::max(rs::almostZero(), static_cast<real>(slipRateBlock[pointIndex][i] - tmp3));
+          slipRateBlock[pointIndex][i] =
+              isActive[pointIndex][i] > 0.0 ? updatedSlipRate : slipRateBlock[pointIndex][i];
+        }
+      }
+    }
+
+    for (unsigned i = 0; i < blockSize; i++) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        slipRateTest[i][pointIndex] = slipRateBlock[pointIndex][i];
+      }
+    }
+  }
+
   void updateNormalStress(std::array<real, misc::numPaddedPoints>& normalStress,
                           FaultStresses const& faultStresses,
                           size_t timeIndex,
@@ -10,6 +10,12 @@ class SlowVelocityWeakeningLaw
   public:
   using RateAndStateBase<SlowVelocityWeakeningLaw, TPMethod>::RateAndStateBase;
 
+  /**
+   * The aging and slip laws are reference implementations (see AgingLaw) and keep the Newton
+   * iteration per face.
+   */
+  static constexpr bool UseFaceBlocks = false;
+
   /**
    * copies all parameters from the DynamicRupture LTS to the local attributes
    */
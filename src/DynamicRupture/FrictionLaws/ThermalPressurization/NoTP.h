@@ -10,6 +10,8 @@ class NoTP {
                           seissol::initializers::DynamicRupture const* const dynRup,
                           real fullUpdateTime) {}
 
+  void precomputeDecayFactors(const real deltaT[CONVERGENCE_ORDER]) {}
+
   void calcFluidPressure(std::array<real, misc::numPaddedPoints>& normalStress,
                          real (*mu)[misc::numPaddedPoints],
                          std::array<real, misc::numPaddedPoints>& slipRateMagnitude,
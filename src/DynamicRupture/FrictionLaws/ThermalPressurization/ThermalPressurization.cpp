@@ -1,10 +1,66 @@
 #include "ThermalPressurization.h"
 
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+#include "Parallel/MPI.h"
+#include <utils/logger.h>
+
 namespace seissol::dr::friction_law {
 
-static const GridPoints<misc::numberOfTPGridPoints> tpGridPoints;
-static const InverseFourierCoefficients<misc::numberOfTPGridPoints> tpInverseFourierCoefficients;
-static const GaussianHeatSource<misc::numberOfTPGridPoints> heatSource;
+TPGrid::TPGrid(unsigned numberOfGridPoints) : numberOfGridPoints(numberOfGridPoints) {
+  if (numberOfGridPoints < 2 || numberOfGridPoints > misc::numberOfTPGridPoints) {
+    logError() << "The number of thermal pressurization grid points has to be between 2 and"
+               << misc::numberOfTPGridPoints << ", but is" << numberOfGridPoints;
+  }
+
+  // keep the range of wave numbers of the grid with misc::numberOfTPGridPoints points
+  const real logDz = misc::tpLogDz * (misc::numberOfTPGridPoints - 1) / (numberOfGridPoints - 1);
+  for (unsigned i = 0; i < numberOfGridPoints; ++i) {
+    gridPoints[i] = misc::tpMaxWaveNumber * std::exp(-logDz * (numberOfGridPoints - i - 1));
+  }
+
+  for (unsigned i = 1; i < numberOfGridPoints - 1; ++i) {
+    inverseFourierCoefficients[i] = std::sqrt(2 / M_PI) * gridPoints[i] * logDz;
+  }
+  inverseFourierCoefficients[0] = std::sqrt(2 / M_PI) * gridPoints[0] * (1 + logDz);
+  inverseFourierCoefficients[numberOfGridPoints - 1] =
+      std::sqrt(2 / M_PI) * gridPoints[numberOfGridPoints - 1] * 0.5 * logDz;
+
+  const real factor = 1 / std::sqrt(2.0 * M_PI);
+  for (unsigned i = 0; i < numberOfGridPoints; ++i) {
+    const real heatGeneration = std::exp(-0.5 * misc::power<2>(gridPoints[i]));
+    heatSources[i] = factor * heatGeneration;
+  }
+}
+
+double TPGrid::estimateError() const {
+  double maxError = 0.0;
+  for (const double diffusionTime : {0.0, 1.0e-2, 1.0, 1.0e2, 1.0e4}) {
+    double approximation = 0.0;
+    for (unsigned i = 0; i < numberOfGridPoints; ++i) {
+      approximation += inverseFourierCoefficients[i] *
+                       std::exp(-(0.5 + diffusionTime) * misc::power<2>(gridPoints[i]));
+    }
+    const double exact = 1.0 / std::sqrt(1.0 + 2.0 * diffusionTime);
+    maxError = std::max(maxError, std::fabs(approximation - exact) / exact);
+  }
+  return maxError;
+}
+
+ThermalPressurization::ThermalPressurization(DRParameters* drParameters)
+    : drParameters(drParameters), grid(drParameters->tpGridPoints) {
+  const int rank = seissol::MPI::mpi.rank();
+  const double error = grid.estimateError();
+  logInfo(rank) << "Thermal pressurization with" << grid.size()
+                << "grid points, estimated relative error of the inverse Fourier transform:"
+                << error;
+  if (error > 1.0e-2) {
+    logWarning(rank) << "The thermal pressurization grid is coarse; consider increasing "
+                        "tp_gridPoints.";
+  }
+}
 
 void ThermalPressurization::copyLtsTreeToLocal(
     seissol::initializers::Layer& layerData,
@@ -22,6 +78,76 @@ void ThermalPressurization::copyLtsTreeToLocal(
   faultStrength = layerData.var(concreteLts->faultStrength);
   halfWidthShearZone = layerData.var(concreteLts->halfWidthShearZone);
   hydraulicDiffusivity = layerData.var(concreteLts->hydraulicDiffusivity);
+  hasUniformParameters = checkUniformParameters(layerData.getNumberOfCells());
+}
+
+bool ThermalPressurization::checkUniformParameters(unsigned numberOfFaces) const {
+  if (numberOfFaces == 0) {
+    return false;
+  }
+  for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      if (halfWidthShearZone[ltsFace][pointIndex] != halfWidthShearZone[0][0] ||
+          hydraulicDiffusivity[ltsFace][pointIndex] != hydraulicDiffusivity[0][0]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ThermalPressurization::precomputeDecayFactors(const real deltaT[CONVERGENCE_ORDER]) {
+  decayFactors.fill(nullptr);
+  if (!hasUniformParameters) {
+    return;
+  }
+
+  if (decayFactorCache.size() + CONVERGENCE_ORDER > MaxCachedDecayFactors) {
+    decayFactorCache.clear();
+  }
+  const real uniformHalfWidthShearZone = halfWidthShearZone[0][0];
+  const real uniformHydraulicDiffusivity = hydraulicDiffusivity[0][0];
+  for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+    const std::array<real, 3> key{
+        deltaT[timeIndex], uniformHalfWidthShearZone, uniformHydraulicDiffusivity};
+    auto [entry, isNew] = decayFactorCache.try_emplace(key);
+    if (isNew) {
+      computeDecayFactors(entry->second,
+                          deltaT[timeIndex],
+                          uniformHalfWidthShearZone,
+                          uniformHydraulicDiffusivity);
+    }
+    decayFactors[timeIndex] = &entry->second;
+  }
+}
+
+void ThermalPressurization::computeDecayFactors(TPDecayFactors& factors,
+                                                real deltaT,
+                                                real halfWidthShearZone,
+                                                real hydraulicDiffusivity) const {
+  const real lambdaPrime = drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
+                           (hydraulicDiffusivity - drParameters->thermalDiffusivity);
+
+  for (unsigned tpGridPointIndex = 0; tpGridPointIndex < grid.size(); tpGridPointIndex++) {
+    const real squaredNormalizedTPGrid =
+        misc::power<2>(grid.gridPoint(tpGridPointIndex) / halfWidthShearZone);
+    const real expTheta =
+        std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
+    const real expSigma = std::exp(-hydraulicDiffusivity * deltaT * squaredNormalizedTPGrid);
+
+    factors.expTheta[tpGridPointIndex] = expTheta;
+    factors.expSigma[tpGridPointIndex] = expSigma;
+    factors.thetaGeneration[tpGridPointIndex] =
+        grid.heatSource(tpGridPointIndex) /
+        (drParameters->heatCapacity * squaredNormalizedTPGrid * drParameters->thermalDiffusivity) *
+        (1.0 - expTheta);
+    factors.sigmaGeneration[tpGridPointIndex] =
+        grid.heatSource(tpGridPointIndex) * (drParameters->undrainedTPResponse + lambdaPrime) /
+        (drParameters->heatCapacity * squaredNormalizedTPGrid * hydraulicDiffusivity) *
+        (1.0 - expSigma);
+    factors.scaledInverseFourierCoefficients[tpGridPointIndex] =
+        grid.inverseFourierCoefficient(tpGridPointIndex) / halfWidthShearZone;
+  }
 }
 
 void ThermalPressurization::calcFluidPressure(
@@ -32,97 +158,131 @@ void ThermalPressurization::calcFluidPressure(
     bool saveTPinLTS,
     unsigned int timeIndex,
     unsigned int ltsFace) {
+  #pragma omp simd
   for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
     // compute fault strength
     faultStrength[ltsFace][pointIndex] = -mu[ltsFace][pointIndex] * normalStress[pointIndex];
+  }
 
-    std::copy(&theta[ltsFace][pointIndex][0],
-              &theta[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-              &thetaTmpBuffer[ltsFace][pointIndex][0]);
-    std::copy(&sigma[ltsFace][pointIndex][0],
-              &sigma[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-              &sigmaTmpBuffer[ltsFace][pointIndex][0]);
-
-    // use Theta/Sigma from last timestep
-    updateTemperatureAndPressure(
-        slipRateMagnitude[pointIndex], deltaT, pointIndex, timeIndex, ltsFace);
-
-    // copy back to LTS tree, if necessary
-    if (saveTPinLTS) {
-      std::copy(&thetaTmpBuffer[ltsFace][pointIndex][0],
-                &thetaTmpBuffer[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-                &theta[ltsFace][pointIndex][0]);
-      std::copy(&sigmaTmpBuffer[ltsFace][pointIndex][0],
-                &sigmaTmpBuffer[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-                &sigma[ltsFace][pointIndex][0]);
-    }
+  // use Theta/Sigma from last timestep
+  const unsigned numberOfValues = grid.size() * misc::numPaddedPoints;
+  std::copy_n(&theta[ltsFace][0][0], numberOfValues, &thetaTmpBuffer[ltsFace][0][0]);
+  std::copy_n(&sigma[ltsFace][0][0], numberOfValues, &sigmaTmpBuffer[ltsFace][0][0]);
+
+  updateTemperatureAndPressure(slipRateMagnitude, deltaT, timeIndex, ltsFace);
+
+  // copy back to LTS tree, if necessary
+  if (saveTPinLTS) {
+    std::copy_n(&thetaTmpBuffer[ltsFace][0][0], numberOfValues, &theta[ltsFace][0][0]);
+    std::copy_n(&sigmaTmpBuffer[ltsFace][0][0], numberOfValues, &sigma[ltsFace][0][0]);
   }
 }
 
-void ThermalPressurization::updateTemperatureAndPressure(real slipRateMagnitude,
-                                                         real deltaT,
-                                                         unsigned int pointIndex,
-                                                         unsigned int timeIndex,
-                                                         unsigned int ltsFace) {
-  real temperatureUpdate = 0.0;
-  real pressureUpdate = 0.0;
+void ThermalPressurization::updateTemperatureAndPressure(
+    std::array<real, misc::numPaddedPoints> const& slipRateMagnitude,
+    real deltaT,
+    unsigned int timeIndex,
+    unsigned int ltsFace) {
+  alignas(ALIGNMENT) real tauV[misc::numPaddedPoints];
+  alignas(ALIGNMENT) real lambdaPrime[misc::numPaddedPoints];
+  alignas(ALIGNMENT) real temperatureUpdate[misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real pressureUpdate[misc::numPaddedPoints]{};
+
+  #pragma omp simd
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    tauV[pointIndex] = faultStrength[ltsFace][pointIndex] * slipRateMagnitude[pointIndex];
+    lambdaPrime[pointIndex] =
+        drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
+        (hydraulicDiffusivity[ltsFace][pointIndex] - drParameters->thermalDiffusivity);
+  }
+
+  if (decayFactors[timeIndex] != nullptr) {
+    const TPDecayFactors& factors = *decayFactors[timeIndex];
+    for (unsigned tpGridPointIndex = 0; tpGridPointIndex < grid.size(); tpGridPointIndex++) {
+      #pragma omp simd
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        // This is F(t) exp(-A dt) + B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10)
+        thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] =
+            thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] *
+                factors.expTheta[tpGridPointIndex] +
+            tauV[pointIndex] * factors.thetaGeneration[tpGridPointIndex];
+        sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] =
+            sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] *
+                factors.expSigma[tpGridPointIndex] +
+            tauV[pointIndex] * factors.sigmaGeneration[tpGridPointIndex];
+
+        temperatureUpdate[pointIndex] += factors.scaledInverseFourierCoefficients[tpGridPointIndex] *
+                                         thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex];
+        pressureUpdate[pointIndex] += factors.scaledInverseFourierCoefficients[tpGridPointIndex] *
+                                      sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex];
+      }
+    }
+  } else {
+    for (unsigned tpGridPointIndex = 0; tpGridPointIndex < grid.size(); tpGridPointIndex++) {
+      const real tpGridPoint = grid.gridPoint(tpGridPointIndex);
+      const real heatSource = grid.heatSource(tpGridPointIndex);
+      const real inverseFourierCoefficient = grid.inverseFourierCoefficient(tpGridPointIndex);
+
+      #pragma omp simd
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        // Gaussian shear zone in spectral domain, normalized by w
+        // \hat{l} / w
+        const real squaredNormalizedTPGrid =
+            misc::power<2>(tpGridPoint / halfWidthShearZone[ltsFace][pointIndex]);
+
+        // This is exp(-A dt) in Noda & Lapusta (2010) equation (10)
+        const real expTheta =
+            std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
+        const real expSigma =
+            std::exp(-hydraulicDiffusivity[ltsFace][pointIndex] * deltaT * squaredNormalizedTPGrid);
 
-  const real tauV = faultStrength[ltsFace][pointIndex] * slipRateMagnitude;
-  const real lambdaPrime =
-      drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
-      (hydraulicDiffusivity[ltsFace][pointIndex] - drParameters->thermalDiffusivity);
+        // Temperature and pressure diffusion in spectral domain over timestep
+        // This is + F(t) exp(-A dt) in equation (10)
+        const real thetaDiffusion =
+            thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] * expTheta;
+        const real sigmaDiffusion =
+            sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] * expSigma;
+
+        // Heat generation during timestep
+        // This is B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10)
+        // heatSource stores \exp(-\hat{l}^2 / 2) / \sqrt{2 \pi}
+        const real omega = tauV[pointIndex] * heatSource;
+        const real thetaGeneration = omega /
+                                     (drParameters->heatCapacity * squaredNormalizedTPGrid *
+                                      drParameters->thermalDiffusivity) *
+                                     (1.0 - expTheta);
+        const real sigmaGeneration =
+            omega * (drParameters->undrainedTPResponse + lambdaPrime[pointIndex]) /
+            (drParameters->heatCapacity * squaredNormalizedTPGrid *
+             hydraulicDiffusivity[ltsFace][pointIndex]) *
+            (1.0 - expSigma);
+
+        // Sum both contributions up
+        thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] = thetaDiffusion + thetaGeneration;
+        sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] = sigmaDiffusion + sigmaGeneration;
+
+        // Recover temperature and altered pressure using inverse Fourier transformation from the
+        // new contribution
+        const real scaledInverseFourierCoefficient =
+            inverseFourierCoefficient / halfWidthShearZone[ltsFace][pointIndex];
+        temperatureUpdate[pointIndex] +=
+            scaledInverseFourierCoefficient * thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex];
+        pressureUpdate[pointIndex] +=
+            scaledInverseFourierCoefficient * sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex];
+      }
+    }
+  }
 
   #pragma omp simd
-  for (unsigned int tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
-       tpGridPointIndex++) {
-    // Gaussian shear zone in spectral domain, normalized by w
-    // \hat{l} / w
-    const real squaredNormalizedTPGrid =
-        misc::power<2>(tpGridPoints[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex]);
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    // Update pore pressure change: sigma = pore pressure + lambda' * temperature
+    pressureUpdate[pointIndex] -= lambdaPrime[pointIndex] * temperatureUpdate[pointIndex];
 
-    // This is exp(-A dt) in Noda & Lapusta (2010) equation (10)
-    const real expTheta =
-        std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
-    const real expSigma =
-        std::exp(-hydraulicDiffusivity[ltsFace][pointIndex] * deltaT * squaredNormalizedTPGrid);
-
-    // Temperature and pressure diffusion in spectral domain over timestep
-    // This is + F(t) exp(-A dt) in equation (10)
-    const real thetaDiffusion = thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expTheta;
-    const real sigmaDiffusion = sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expSigma;
-
-    // Heat generation during timestep
-    // This is B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10)
-    // heatSource stores \exp(-\hat{l}^2 / 2) / \sqrt{2 \pi}
-    const real omega = tauV * heatSource[tpGridPointIndex];
-    const real thetaGeneration =
-        omega /
-        (drParameters->heatCapacity * squaredNormalizedTPGrid * drParameters->thermalDiffusivity) *
-        (1.0 - expTheta);
-    const real sigmaGeneration = omega * (drParameters->undrainedTPResponse + lambdaPrime) /
-                                 (drParameters->heatCapacity * squaredNormalizedTPGrid *
-                                  hydraulicDiffusivity[ltsFace][pointIndex]) *
-                                 (1.0 - expSigma);
-
-    // Sum both contributions up
-    thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = thetaDiffusion + thetaGeneration;
-    sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = sigmaDiffusion + sigmaGeneration;
-
-    // Recover temperature and altered pressure using inverse Fourier transformation from the new
-    // contribution
-    const real scaledInverseFourierCoefficient =
-        tpInverseFourierCoefficients[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex];
-    temperatureUpdate +=
-        scaledInverseFourierCoefficient * thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex];
-    pressureUpdate +=
-        scaledInverseFourierCoefficient * sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex];
-  }
-  // Update pore pressure change: sigma = pore pressure + lambda' * temperature
-  pressureUpdate -= lambdaPrime * temperatureUpdate;
-
-  // Temperature and pore pressure change at single GP on the fault + initial values
-  temperature[ltsFace][pointIndex] = temperatureUpdate + drParameters->initialTemperature;
-  pressure[ltsFace][pointIndex] = -pressureUpdate + drParameters->initialPressure;
+    // Temperature and pore pressure change at single GP on the fault + initial values
+    temperature[ltsFace][pointIndex] =
+        temperatureUpdate[pointIndex] + drParameters->initialTemperature;
+    pressure[ltsFace][pointIndex] = -pressureUpdate[pointIndex] + drParameters->initialPressure;
+  }
 }
 
 } // namespace seissol::dr::friction_law
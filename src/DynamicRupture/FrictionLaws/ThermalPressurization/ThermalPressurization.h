@@ -2,6 +2,7 @@
 #define SEISSOL_THERMALPRESSURIZATION_H
 
 #include <array>
+#include <map>
 
 #include "DynamicRupture/Misc.h"
 #include "DynamicRupture/Parameters.h"
@@ -11,64 +12,59 @@
 namespace seissol::dr::friction_law {
 
 /**
- * Logarithmic gridpoints as defined in Noda&Lapusta (14). These are the \f$\hat{l}\f$ for
- * ThermalPressurization.
+ * Logarithmic spectral grid as defined in Noda&Lapusta (14), with a grid size chosen at runtime.
+ * The grid spans the same range of wave numbers for all grid sizes.
  */
-template <size_t N>
-class GridPoints {
+class TPGrid {
   public:
-  GridPoints() {
-    for (size_t i = 0; i < N; ++i) {
-      values[i] =
-          misc::tpMaxWaveNumber * std::exp(-misc::tpLogDz * (misc::numberOfTPGridPoints - i - 1));
-    }
-  }
-  real const& operator[](size_t i) const { return values[i]; };
+  explicit TPGrid(unsigned numberOfGridPoints);
 
-  private:
-  std::array<real, N> values;
-};
+  unsigned size() const { return numberOfGridPoints; }
 
-/**
- * Inverse Fourier coefficients on the logarithmic grid.
- */
-template <size_t N>
-class InverseFourierCoefficients {
-  public:
-  constexpr InverseFourierCoefficients() {
-    GridPoints<N> localGridPoints;
-
-    for (size_t i = 1; i < N - 1; ++i) {
-      values[i] = std::sqrt(2 / M_PI) * localGridPoints[i] * misc::tpLogDz;
-    }
-    values[0] = std::sqrt(2 / M_PI) * localGridPoints[0] * (1 + misc::tpLogDz);
-    values[N - 1] = std::sqrt(2 / M_PI) * localGridPoints[N - 1] * 0.5 * misc::tpLogDz;
-  }
-  real const& operator[](size_t i) const { return values[i]; };
+  /**
+   * The grid points \f$\hat{l}\f$.
+   */
+  real gridPoint(unsigned i) const { return gridPoints[i]; }
+
+  /**
+   * Inverse Fourier coefficients on the logarithmic grid.
+   */
+  real inverseFourierCoefficient(unsigned i) const { return inverseFourierCoefficients[i]; }
+
+  /**
+   * The heat generation (without tauV) \f$\exp\left(\hat{l}^2/2\right) / \sqrt{2 \pi}\f$.
+   */
+  real heatSource(unsigned i) const { return heatSources[i]; }
+
+  /**
+   * Estimates the relative error of the inverse Fourier transform on the grid: the transform of the
+   * Gaussian heat source after a normalized diffusion time \f$s = \alpha t / w^2\f$ is known
+   * analytically (\f$1 / \sqrt{1 + 2s}\f$), and we take the maximal error over several s.
+   */
+  double estimateError() const;
 
   private:
-  std::array<real, N> values;
+  unsigned numberOfGridPoints;
+  std::array<real, misc::numberOfTPGridPoints> gridPoints{};
+  std::array<real, misc::numberOfTPGridPoints> inverseFourierCoefficients{};
+  std::array<real, misc::numberOfTPGridPoints> heatSources{};
 };
 
 /**
- * Stores the heat generation (without tauV) \f$\exp\left(\hat{l}^2/2\right) / \sqrt{2 \pi}\f$.
+ * Factors of the update (10) in Noda&Lapusta (2010) for one time step width, which only depend on
+ * the spectral grid and the TP parameters.
  */
-template <size_t N>
-class GaussianHeatSource {
-  public:
-  constexpr GaussianHeatSource() {
-    GridPoints<N> localGridPoints;
-    real factor = 1 / std::sqrt(2.0 * M_PI);
-
-    for (size_t i = 0; i < N; ++i) {
-      const real heatGeneration = std::exp(-0.5 * misc::power<2>(localGridPoints[i]));
-      values[i] = factor * heatGeneration;
-    }
-  }
-  real const& operator[](size_t i) const { return values[i]; };
-
-  private:
-  std::array<real, N> values;
+struct TPDecayFactors {
+  //! \f$\exp\left(-\left(\hat{l}/w\right)^2\alpha_{th} \Delta t\right)\f$
+  std::array<real, misc::numberOfTPGridPoints> expTheta{};
+  //! \f$\exp\left(-\left(\hat{l}/w\right)^2\alpha_{hy} \Delta t\right)\f$
+  std::array<real, misc::numberOfTPGridPoints> expSigma{};
+  //! heat generation of Theta during the time step divided by tauV
+  std::array<real, misc::numberOfTPGridPoints> thetaGeneration{};
+  //! heat generation of Sigma during the time step divided by tauV
+  std::array<real, misc::numberOfTPGridPoints> sigmaGeneration{};
+  //! inverse Fourier coefficients divided by w
+  std::array<real, misc::numberOfTPGridPoints> scaledInverseFourierCoefficients{};
 };
 
 /**
@@ -97,10 +93,14 @@ class GaussianHeatSource {
  * + \Sigma(t)\exp\left(-\left(\hat{l}/w\right)^2\alpha_{th} \Delta t\right)\\\end{aligned}\f]
  * We then compute the pressure and temperature update with an inverse Fourier transform from
  * \f$\Pi, \Theta\f$.
+ *
+ * Theta and Sigma are stored grid point major, such that the update is vectorized over the points
+ * of a face. If halfWidthShearZone and hydraulicDiffusivity are constant in a layer, the factors
+ * of the update are computed once per time step width and cached.
  */
 class ThermalPressurization {
   public:
-  explicit ThermalPressurization(DRParameters* drParameters) : drParameters(drParameters){};
+  explicit ThermalPressurization(DRParameters* drParameters);
 
   /**
    * copies all parameters from the DynamicRupture LTS to the local attributes
@@ -109,6 +109,12 @@ class ThermalPressurization {
                           seissol::initializers::DynamicRupture const* const dynRup,
                           real fullUpdateTime);
 
+  /**
+   * Looks up the decay factors of the time step widths of the current layer, if the TP parameters
+   * of the layer are constant. Call after copyLtsTreeToLocal.
+   */
+  void precomputeDecayFactors(const real deltaT[CONVERGENCE_ORDER]);
+
   /**
    * Compute thermal pressure according to Noda&Lapusta (2010) at all Gauss Points within one face
    * bool saveTmpInTP is used to save final values for Theta and Sigma in the LTS tree
@@ -125,28 +131,53 @@ class ThermalPressurization {
     return pressure[ltsFace][pointIndex];
   }
 
+  //! true if the decay factors of the current layer are cached (see precomputeDecayFactors)
+  [[nodiscard]] bool hasCachedDecayFactors() const { return hasUniformParameters; }
+
   protected:
   real (*temperature)[misc::numPaddedPoints];
   real (*pressure)[misc::numPaddedPoints];
-  real (*theta)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
-  real (*sigma)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
-  real (*thetaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
-  real (*sigmaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
+  real (*theta)[misc::numberOfTPGridPoints][misc::numPaddedPoints];
+  real (*sigma)[misc::numberOfTPGridPoints][misc::numPaddedPoints];
+  real (*thetaTmpBuffer)[misc::numberOfTPGridPoints][misc::numPaddedPoints];
+  real (*sigmaTmpBuffer)[misc::numberOfTPGridPoints][misc::numPaddedPoints];
   real (*halfWidthShearZone)[misc::numPaddedPoints];
   real (*hydraulicDiffusivity)[misc::numPaddedPoints];
   real (*faultStrength)[misc::numPaddedPoints];
 
+  //! true if halfWidthShearZone and hydraulicDiffusivity are constant in the current layer
+  bool hasUniformParameters{false};
+
+  /**
+   * Checks whether halfWidthShearZone and hydraulicDiffusivity are the same on all faces.
+   */
+  bool checkUniformParameters(unsigned numberOfFaces) const;
+
   private:
   DRParameters* drParameters;
+  TPGrid grid;
+
+  //! upper bound for the size of the cache before it is cleared
+  static constexpr size_t MaxCachedDecayFactors = 256;
+  //! decay factors by (deltaT, halfWidthShearZone, hydraulicDiffusivity)
+  std::map<std::array<real, 3>, TPDecayFactors> decayFactorCache;
+  //! decay factors of the current layer, nullptr if the TP parameters are not constant
+  std::array<TPDecayFactors const*, CONVERGENCE_ORDER> decayFactors{};
+
+  void computeDecayFactors(TPDecayFactors& factors,
+                           real deltaT,
+                           real halfWidthShearZone,
+                           real hydraulicDiffusivity) const;
 
   /**
-   * Compute temperature and pressure update according to Noda&Lapusta (2010) on one Gaus point.
+   * Compute temperature and pressure update according to Noda&Lapusta (2010) on all Gauss points
+   * of one face.
    */
-  void updateTemperatureAndPressure(real slipRateMagnitude,
-                                    real deltaT,
-                                    unsigned int pointIndex,
-                                    unsigned int timeIndex,
-                                    unsigned int ltsFace);
+  void updateTemperatureAndPressure(
+      std::array<real, misc::numPaddedPoints> const& slipRateMagnitude,
+      real deltaT,
+      unsigned int timeIndex,
+      unsigned int ltsFace);
 };
 } // namespace seissol::dr::friction_law
 
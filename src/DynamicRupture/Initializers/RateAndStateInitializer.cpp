@@ -133,11 +133,11 @@ void RateAndStateThermalPressurizationInitializer::initializeFault(
        ++it) {
     real(*temperature)[misc::numPaddedPoints] = it->var(concreteLts->temperature);
     real(*pressure)[misc::numPaddedPoints] = it->var(concreteLts->pressure);
-    real(*theta)[misc::numPaddedPoints][misc::numberOfTPGridPoints] = it->var(concreteLts->theta);
-    real(*sigma)[misc::numPaddedPoints][misc::numberOfTPGridPoints] = it->var(concreteLts->sigma);
-    real(*thetaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
+    real(*theta)[misc::numberOfTPGridPoints][misc::numPaddedPoints] = it->var(concreteLts->theta);
+    real(*sigma)[misc::numberOfTPGridPoints][misc::numPaddedPoints] = it->var(concreteLts->sigma);
+    real(*thetaTmpBuffer)[misc::numberOfTPGridPoints][misc::numPaddedPoints] =
         it->var(concreteLts->thetaTmpBuffer);
-    real(*sigmaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
+    real(*sigmaTmpBuffer)[misc::numberOfTPGridPoints][misc::numPaddedPoints] =
         it->var(concreteLts->sigmaTmpBuffer);
 
     for (unsigned ltsFace = 0; ltsFace < it->getNumberOfCells(); ++ltsFace) {
@@ -146,10 +146,10 @@ void RateAndStateThermalPressurizationInitializer::initializeFault(
         pressure[ltsFace][pointIndex] = drParameters->initialPressure;
         for (unsigned tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
              ++tpGridPointIndex) {
-          theta[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
-          sigma[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
-          thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
-          sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
+          theta[ltsFace][tpGridPointIndex][pointIndex] = 0.0;
+          sigma[ltsFace][tpGridPointIndex][pointIndex] = 0.0;
+          thetaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] = 0.0;
+          sigmaTmpBuffer[ltsFace][tpGridPointIndex][pointIndex] = 0.0;
         }
       }
     }
@@ -30,6 +30,9 @@ static constexpr inline size_t numQuantities = misc::dimSize<init::QInterpolated
 
 /**
  * Constants for Thermal Pressurization
+ * numberOfTPGridPoints is the maximal (and default) size of the spectral grid, the grid size of a
+ * simulation is set with tp_gridPoints. tpLogDz is the spacing of the grid with
+ * numberOfTPGridPoints points.
  */
 static constexpr size_t numberOfTPGridPoints = 60;
 static constexpr real tpLogDz = 0.3;
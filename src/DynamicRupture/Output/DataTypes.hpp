@@ -121,11 +121,19 @@ struct GeneralParams {
   size_t maxIteration{1000000000};
 };
 
+enum class PickpointOutputBackend {
+  //! One ASCII file per receiver, written synchronously
+  Ascii,
+  //! One binary file per rank, written asynchronously
+  Binary
+};
+
 struct PickpointParams {
   std::array<bool, std::tuple_size<DrVarsT>::value> outputMask{true, true, true};
   int printTimeInterval{1};
   int maxPickStore{50};
   std::string ppFileName{};
+  PickpointOutputBackend outputBackend{PickpointOutputBackend::Ascii};
 };
 
 enum class RefinerType { Triple = 1, Quad = 2, Invalid = 3 };
@@ -3,6 +3,7 @@
 #include "Numerical_aux/Quadrature.h"
 #include "Numerical_aux/Transformation.h"
 #include "OutputAux.hpp"
+#include "generated_code/init.h"
 #include <Eigen/Dense>
 #include <ctime>
 #include <filesystem>
@@ -95,6 +96,35 @@ TriangleQuadratureData generateTriangleQuadrature(unsigned polyDegree) {
   return data;
 }
 
+ProjectedGradientCoefficients getProjectedGradientCoefficients(int gaussPointIndex) {
+  constexpr int numPoly = CONVERGENCE_ORDER - 1;
+  constexpr int numDegFr2d = (numPoly + 1) * (numPoly + 2) / 2;
+  constexpr auto numPoints = TriangleQuadratureData::size;
+
+  auto chiTau2dPoints = init::quadpoints::view::create(const_cast<real*>(init::quadpoints::Values));
+  auto weights = init::quadweights::view::create(const_cast<real*>(init::quadweights::Values));
+  auto m2inv = init::M2inv::view::create(const_cast<real*>(init::M2inv::Values));
+
+  std::array<double, 2 * numDegFr2d> gradPhiAtPoint{};
+  basisFunction::tri_dubiner::evaluateGradPolynomials(gradPhiAtPoint.data(),
+                                                      chiTau2dPoints(gaussPointIndex, 0),
+                                                      chiTau2dPoints(gaussPointIndex, 1),
+                                                      numPoly);
+
+  ProjectedGradientCoefficients coefficients{};
+  std::array<double, numDegFr2d> phiAtPoint{};
+  for (size_t point = 0; point < numPoints; ++point) {
+    basisFunction::tri_dubiner::evaluatePolynomials(
+        phiAtPoint.data(), chiTau2dPoints(point, 0), chiTau2dPoints(point, 1), numPoly);
+    for (int d = 0; d < numDegFr2d; ++d) {
+      const double projection = weights(point) * phiAtPoint[d] * m2inv(d, d);
+      coefficients[0][point] += projection * gradPhiAtPoint[2 * d];
+      coefficients[1][point] += projection * gradPhiAtPoint[2 * d + 1];
+    }
+  }
+  return coefficients;
+}
+
 double distance(const double v1[2], const double v2[2]) {
   Eigen::Vector2d vector1(v1[0], v1[1]), vector2(v2[0], v2[1]);
   return (vector1 - vector2).norm();
@@ -34,6 +34,15 @@ struct TriangleQuadratureData {
 
 TriangleQuadratureData generateTriangleQuadrature(unsigned polyDegree);
 
+/**
+ * Maps values at the boundary Gauss points to the derivatives (w.r.t. chi and tau) of their
+ * L2 projection onto the 2d basis, evaluated at one of the boundary Gauss points.
+ */
+using ProjectedGradientCoefficients =
+    std::array<std::array<double, TriangleQuadratureData::size>, 2>;
+
+ProjectedGradientCoefficients getProjectedGradientCoefficients(int gaussPointIndex);
+
 void assignNearestGaussianPoints(ReceiverPoints& geoPoints);
 
 int getClosestInternalStroudGp(int nearestGpIndex, int nPoly);
@@ -2,6 +2,7 @@
 #include "DynamicRupture/Output/ReceiverBasedOutput.hpp"
 #include "ResultWriter/common.hpp"
 #include "SeisSol.h"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <type_traits>
@@ -162,13 +163,12 @@ void OutputManager::initElementwiseOutput() {
 void OutputManager::initPickpointOutput() {
   ppOutputBuilder->build(ppOutputData);
 
-  std::stringstream baseHeader;
-  baseHeader << "VARIABLES = \"Time\"";
+  std::vector<std::string> columnNames{"Time"};
   size_t labelCounter = 0;
-  auto collectVariableNames = [&baseHeader, &labelCounter](auto& var, int) {
+  auto collectVariableNames = [&columnNames, &labelCounter](auto& var, int) {
     if (var.isActive) {
       for (int dim = 0; dim < var.dim(); ++dim) {
-        baseHeader << " ,\"" << writer::FaultWriterExecutor::getLabelName(labelCounter) << '\"';
+        columnNames.emplace_back(writer::FaultWriterExecutor::getLabelName(labelCounter));
         ++labelCounter;
       }
     } else {
@@ -177,6 +177,17 @@ void OutputManager::initPickpointOutput() {
   };
   misc::forEach(ppOutputData->vars, collectVariableNames);
 
+  if (pickpointParams.outputBackend == PickpointOutputBackend::Binary) {
+    initBinaryPickpointOutput(columnNames);
+    return;
+  }
+
+  std::stringstream baseHeader;
+  baseHeader << "VARIABLES = \"" << columnNames[0] << '\"';
+  for (size_t column = 1; column < columnNames.size(); ++column) {
+    baseHeader << " ,\"" << columnNames[column] << '\"';
+  }
+
   auto& outputData = ppOutputData;
   for (const auto& receiver : outputData->receiverPoints) {
     const size_t globalIndex = receiver.globalReceiverIndex + 1;
@@ -208,6 +219,27 @@ void OutputManager::initPickpointOutput() {
   }
 }
 
+void OutputManager::initBinaryPickpointOutput(const std::vector<std::string>& columnNames) {
+  const auto& receiverPoints = ppOutputData->receiverPoints;
+
+  std::vector<std::uint64_t> receiverIds(receiverPoints.size());
+  std::vector<std::array<double, 3>> coordinates(receiverPoints.size());
+  for (size_t pointId = 0; pointId < receiverPoints.size(); ++pointId) {
+    const auto& point = const_cast<ExtVrtxCoords&>(receiverPoints[pointId].global);
+    receiverIds[pointId] = receiverPoints[pointId].globalReceiverIndex + 1;
+    coordinates[pointId] = {point[0], point[1], point[2]};
+  }
+
+  // The receiver cache and the segment of the writer form a ring buffer of two segments:
+  // While one segment is written in the background, the cache is filled again.
+  seissol::SeisSol::main.faultReceiverWriter().init(
+      generalParams.outputFilePrefix,
+      columnNames,
+      receiverIds,
+      coordinates,
+      static_cast<std::uint64_t>(pickpointParams.maxPickStore));
+}
+
 void OutputManager::init() {
   if (ewOutputBuilder) {
     initElementwiseOutput();
@@ -267,6 +299,11 @@ void OutputManager::writePickpointOutput(double time, double dt) {
 }
 
 void OutputManager::flushPickpointDataToFile() {
+  if (pickpointParams.outputBackend == PickpointOutputBackend::Binary) {
+    flushPickpointDataToBinaryFile();
+    return;
+  }
+
   auto& outputData = ppOutputData;
   for (size_t pointId = 0; pointId < outputData->receiverPoints.size(); ++pointId) {
     std::stringstream data;
@@ -298,6 +335,36 @@ void OutputManager::flushPickpointDataToFile() {
   outputData->currentCacheLevel = 0;
 }
 
+void OutputManager::flushPickpointDataToBinaryFile() {
+  auto& outputData = ppOutputData;
+  auto& writer = seissol::SeisSol::main.faultReceiverWriter();
+  // Nothing to do if the writer is already closed
+  if (outputData->currentCacheLevel == 0 || !writer.isEnabled()) {
+    return;
+  }
+
+  const size_t numberOfSamples = outputData->currentCacheLevel;
+  double* segment = writer.segmentBuffer();
+  std::copy_n(outputData->cachedTime.begin(), numberOfSamples, segment);
+
+  double* values = segment + numberOfSamples;
+  for (size_t pointId = 0; pointId < outputData->receiverPoints.size(); ++pointId) {
+    for (size_t level = 0; level < numberOfSamples; ++level) {
+      auto recordResults = [pointId, level, &values](auto& var, int) {
+        if (var.isActive) {
+          for (int dim = 0; dim < var.dim(); ++dim) {
+            *values++ = var(dim, level, pointId);
+          }
+        }
+      };
+      misc::forEach(outputData->vars, recordResults);
+    }
+  }
+
+  writer.sendSegment(numberOfSamples);
+  outputData->currentCacheLevel = 0;
+}
+
 void OutputManager::updateElementwiseOutput() {
   if (this->ewOutputBuilder) {
     impl->calcFaultOutput(OutputType::Elementwise, ewOutputData, generalParams);
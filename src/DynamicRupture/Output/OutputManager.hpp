@@ -31,6 +31,8 @@ class OutputManager {
   bool isAtPickpoint(double time, double dt);
   void initElementwiseOutput();
   void initPickpointOutput();
+  void initBinaryPickpointOutput(const std::vector<std::string>& columnNames);
+  void flushPickpointDataToBinaryFile();
 
   std::unique_ptr<ElementWiseBuilder> ewOutputBuilder{nullptr};
   std::unique_ptr<PickPointBuilder> ppOutputBuilder{nullptr};
@@ -76,6 +76,20 @@ class ParametersInitializer {
     const YAML::Node& ppData = data["pickpoint"];
     ppParams.printTimeInterval = getWithDefault(ppData, "printtimeinterval", 1);
     ppParams.ppFileName = getWithDefault(ppData, "ppfilename", std::string(""));
+    ppParams.maxPickStore = getWithDefault(ppData, "maxpickstore", 50);
+    if (ppParams.maxPickStore < 1) {
+      logError() << "maxPickStore has to be positive, given:" << ppParams.maxPickStore;
+    }
+
+    const auto outputBackend = getWithDefault(ppData, "outputbackend", std::string("ascii"));
+    if (outputBackend == "ascii") {
+      ppParams.outputBackend = PickpointOutputBackend::Ascii;
+    } else if (outputBackend == "binary") {
+      ppParams.outputBackend = PickpointOutputBackend::Binary;
+    } else {
+      logError() << "given pickpoint output backend (" << outputBackend
+                 << ") is not supported. Use ascii or binary.";
+    }
 
     if (ppData["outputmask"]) {
       convertStringToMask(ppData["outputmask"].as<std::string>(), ppParams.outputMask);
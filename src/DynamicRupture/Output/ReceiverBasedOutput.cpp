@@ -1,14 +1,21 @@
 #include "DynamicRupture/Output/OutputAux.hpp"
 #include "Initializer/tree/Layer.hpp"
-#include "Numerical_aux/BasisFunction.h"
 #include "ReceiverBasedOutput.hpp"
 #include "generated_code/kernel.h"
 #include "generated_code/tensor.h"
 #include <unordered_map>
+#include <utility>
 
 using namespace seissol::dr::misc::quantity_indices;
 
 namespace seissol::dr::output {
+ReceiverOutput::ReceiverOutput() {
+  ruptureTimeGradientCoefficients.reserve(misc::numberOfBoundaryGaussPoints);
+  for (size_t point = 0; point < misc::numberOfBoundaryGaussPoints; ++point) {
+    ruptureTimeGradientCoefficients.push_back(getProjectedGradientCoefficients(point));
+  }
+}
+
 void ReceiverOutput::setLtsData(seissol::initializers::LTSTree* userWpTree,
                                 seissol::initializers::LTS* userWpDescr,
                                 seissol::initializers::Lut* userWpLut,
@@ -40,11 +47,48 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
                                      std::shared_ptr<ReceiverOutputData> outputData,
                                      const GeneralParams& generalParams,
                                      double time) {
+  static const auto calcFunctions = makeCalcFaultOutputFunctions(
+      std::make_index_sequence<1U << CompileTimeVariables.size()>{});
+
+  unsigned compactMask = 0;
+  auto collectActiveVariables = [&compactMask](auto& var, int variable) {
+    for (size_t i = 0; i < CompileTimeVariables.size(); ++i) {
+      if (var.isActive && CompileTimeVariables[i] == variable) {
+        compactMask |= 1U << i;
+      }
+    }
+  };
+  misc::forEach(outputData->vars, collectActiveVariables);
 
   const size_t level = (type == OutputType::AtPickpoint) ? outputData->currentCacheLevel : 0;
-  const auto faultInfos = meshReader->getFault();
+  (this->*calcFunctions[compactMask])(level, outputData, generalParams);
 
-  #pragma omp parallel for
+  if (type == OutputType::AtPickpoint) {
+    outputData->cachedTime[outputData->currentCacheLevel] = time;
+    outputData->currentCacheLevel += 1;
+  }
+}
+
+template <unsigned VariableMask>
+void ReceiverOutput::calcFaultOutputAtReceivers(size_t level,
+                                                std::shared_ptr<ReceiverOutputData>& outputData,
+                                                const GeneralParams& generalParams) {
+  constexpr bool writesSlipRate = isSelected(VariableMask, SlipRate);
+  constexpr bool writesTransientTractions = isSelected(VariableMask, TransientTractions);
+  constexpr bool writesNormalVelocity = isSelected(VariableMask, NormalVelocity);
+  constexpr bool writesTotalTractions = isSelected(VariableMask, TotalTractions);
+  constexpr bool writesSlip = isSelected(VariableMask, Slip);
+  constexpr bool writesRuptureVelocity = isSelected(VariableMask, RuptureVelocity);
+
+  // The stresses at the receiver require the DOFs of both adjacent elements
+  constexpr bool needsLocalStresses =
+      writesSlipRate || writesTransientTractions || writesNormalVelocity || writesTotalTractions;
+  constexpr bool needsRotatedStresses =
+      writesSlipRate || writesTransientTractions || writesTotalTractions;
+
+  [[maybe_unused]] const auto& faultInfos = meshReader->getFault();
+
+#pragma omp parallel for
   for (size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
 
     assert(outputData->receiverPoints[i].isInside == true &&
@@ -64,18 +108,6 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
     local.waveSpeedsPlus = &((local.layer->var(drDescr->waveSpeedsPlus))[local.ltsId]);
     local.waveSpeedsMinus = &((local.layer->var(drDescr->waveSpeedsMinus))[local.ltsId]);
 
-    const auto faultInfo = faultInfos[faceIndex];
-
-    real dofsPlus[tensor::Q::size()]{};
-    getDofs(dofsPlus, faultInfo.element);
-
-    real dofsMinus[tensor::Q::size()]{};
-    if (faultInfo.neighborElement >= 0) {
-      getDofs(dofsMinus, faultInfo.neighborElement);
-    } else {
-      getNeighbourDofs(dofsMinus, faultInfo.element, faultInfo.side);
-    }
-
     const auto* initStresses = local.layer->var(drDescr->initialStressInFaultCS);
     const auto* initStress = initStresses[local.ltsId][local.nearestGpIndex];
 
@@ -87,31 +119,11 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
     local.iniNormalTraction = initStress[QuantityIndices::XX];
     local.fluidPressure = this->computeFluidPressure(local);
 
-    const auto& normal = outputData->faultDirections[i].faceNormal;
-    const auto& tangent1 = outputData->faultDirections[i].tangent1;
-    const auto& tangent2 = outputData->faultDirections[i].tangent2;
-    const auto& strike = outputData->faultDirections[i].strike;
-    const auto& dip = outputData->faultDirections[i].dip;
-
-    auto* phiPlusSide = outputData->basisFunctions[i].plusSide.data();
-    auto* phiMinusSide = outputData->basisFunctions[i].minusSide.data();
-
-    seissol::dynamicRupture::kernel::evaluateFaceAlignedDOFSAtPoint kernel;
-    kernel.Tinv = outputData->glbToFaceAlignedData[i].data();
-
-    kernel.Q = dofsPlus;
-    kernel.basisFunctionsAtPoint = phiPlusSide;
-    kernel.QAtPoint = local.faceAlignedValuesPlus;
-    kernel.execute();
-
-    kernel.Q = dofsMinus;
-    kernel.basisFunctionsAtPoint = phiMinusSide;
-    kernel.QAtPoint = local.faceAlignedValuesMinus;
-    kernel.execute();
-
-    this->computeLocalStresses(local);
-    const real strength = this->computeLocalStrength(local);
-    this->updateLocalTractions(local, strength);
+    [[maybe_unused]] const auto& normal = outputData->faultDirections[i].faceNormal;
+    [[maybe_unused]] const auto& tangent1 = outputData->faultDirections[i].tangent1;
+    [[maybe_unused]] const auto& tangent2 = outputData->faultDirections[i].tangent2;
+    [[maybe_unused]] const auto& strike = outputData->faultDirections[i].strike;
+    [[maybe_unused]] const auto& dip = outputData->faultDirections[i].dip;
 
     seissol::dynamicRupture::kernel::rotateInitStress alignAlongDipAndStrikeKernel;
     alignAlongDipAndStrikeKernel.stressRotationMatrix =
@@ -119,53 +131,95 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
     alignAlongDipAndStrikeKernel.reducedFaceAlignedMatrix =
         outputData->stressFaceAlignedToGlb[i].data();
 
-    std::array<real, 6> updatedStress{};
-    updatedStress[QuantityIndices::XX] = local.transientNormalTraction;
-    updatedStress[QuantityIndices::YY] = local.faceAlignedStress22;
-    updatedStress[QuantityIndices::ZZ] = local.faceAlignedStress33;
-    updatedStress[QuantityIndices::XY] = local.updatedTraction1;
-    updatedStress[QuantityIndices::YZ] = local.faceAlignedStress23;
-    updatedStress[QuantityIndices::XZ] = local.updatedTraction2;
-
-    alignAlongDipAndStrikeKernel.initialStress = updatedStress.data();
     std::array<real, 6> rotatedUpdatedStress{};
-    alignAlongDipAndStrikeKernel.rotatedStress = rotatedUpdatedStress.data();
-    alignAlongDipAndStrikeKernel.execute();
-
-    std::array<real, 6> stress{};
-    stress[QuantityIndices::XX] = local.transientNormalTraction;
-    stress[QuantityIndices::YY] = local.faceAlignedStress22;
-    stress[QuantityIndices::ZZ] = local.faceAlignedStress33;
-    stress[QuantityIndices::XY] = local.faceAlignedStress12;
-    stress[QuantityIndices::YZ] = local.faceAlignedStress23;
-    stress[QuantityIndices::XZ] = local.faceAlignedStress13;
-
-    alignAlongDipAndStrikeKernel.initialStress = stress.data();
     std::array<real, 6> rotatedStress{};
-    alignAlongDipAndStrikeKernel.rotatedStress = rotatedStress.data();
-    alignAlongDipAndStrikeKernel.execute();
 
-    switch (generalParams.slipRateOutputType) {
-    case SlipRateOutputType::TractionsAndFailure: {
-      this->computeSlipRate(local, rotatedUpdatedStress, rotatedStress);
-      break;
+    if constexpr (needsLocalStresses) {
+      const auto faultInfo = faultInfos[faceIndex];
+
+      real dofsPlus[tensor::Q::size()]{};
+      getDofs(dofsPlus, faultInfo.element);
+
+      real dofsMinus[tensor::Q::size()]{};
+      if (faultInfo.neighborElement >= 0) {
+        getDofs(dofsMinus, faultInfo.neighborElement);
+      } else {
+        getNeighbourDofs(dofsMinus, faultInfo.element, faultInfo.side);
+      }
+
+      auto* phiPlusSide = outputData->basisFunctions[i].plusSide.data();
+      auto* phiMinusSide = outputData->basisFunctions[i].minusSide.data();
+
+      seissol::dynamicRupture::kernel::evaluateFaceAlignedDOFSAtPoint kernel;
+      kernel.Tinv = outputData->glbToFaceAlignedData[i].data();
+
+      kernel.Q = dofsPlus;
+      kernel.basisFunctionsAtPoint = phiPlusSide;
+      kernel.QAtPoint = local.faceAlignedValuesPlus;
+      kernel.execute();
+
+      kernel.Q = dofsMinus;
+      kernel.basisFunctionsAtPoint = phiMinusSide;
+      kernel.QAtPoint = local.faceAlignedValuesMinus;
+      kernel.execute();
+
+      this->computeLocalStresses(local);
     }
-    case SlipRateOutputType::VelocityDifference: {
-      this->computeSlipRate(local, tangent1, tangent2, strike, dip);
-      break;
+
+    if constexpr (needsRotatedStresses) {
+      const real strength = this->computeLocalStrength(local);
+      this->updateLocalTractions(local, strength);
+
+      std::array<real, 6> updatedStress{};
+      updatedStress[QuantityIndices::XX] = local.transientNormalTraction;
+      updatedStress[QuantityIndices::YY] = local.faceAlignedStress22;
+      updatedStress[QuantityIndices::ZZ] = local.faceAlignedStress33;
+      updatedStress[QuantityIndices::XY] = local.updatedTraction1;
+      updatedStress[QuantityIndices::YZ] = local.faceAlignedStress23;
+      updatedStress[QuantityIndices::XZ] = local.updatedTraction2;
+
+      alignAlongDipAndStrikeKernel.initialStress = updatedStress.data();
+      alignAlongDipAndStrikeKernel.rotatedStress = rotatedUpdatedStress.data();
+      alignAlongDipAndStrikeKernel.execute();
+
+      std::array<real, 6> stress{};
+      stress[QuantityIndices::XX] = local.transientNormalTraction;
+      stress[QuantityIndices::YY] = local.faceAlignedStress22;
+      stress[QuantityIndices::ZZ] = local.faceAlignedStress33;
+      stress[QuantityIndices::XY] = local.faceAlignedStress12;
+      stress[QuantityIndices::YZ] = local.faceAlignedStress23;
+      stress[QuantityIndices::XZ] = local.faceAlignedStress13;
+
+      alignAlongDipAndStrikeKernel.initialStress = stress.data();
+      alignAlongDipAndStrikeKernel.rotatedStress = rotatedStress.data();
+      alignAlongDipAndStrikeKernel.execute();
     }
+
+    if constexpr (writesSlipRate) {
+      switch (generalParams.slipRateOutputType) {
+      case SlipRateOutputType::TractionsAndFailure: {
+        this->computeSlipRate(local, rotatedUpdatedStress, rotatedStress);
+        break;
+      }
+      case SlipRateOutputType::VelocityDifference: {
+        this->computeSlipRate(local, tangent1, tangent2, strike, dip);
+        break;
+      }
+      }
     }
 
-    adjustRotatedUpdatedStress(rotatedUpdatedStress, rotatedStress);
+    if constexpr (needsRotatedStresses) {
+      adjustRotatedUpdatedStress(rotatedUpdatedStress, rotatedStress);
+    }
 
-    auto& slipRate = std::get<VariableID::SlipRate>(outputData->vars);
-    if (slipRate.isActive) {
+    if constexpr (writesSlipRate) {
+      auto& slipRate = std::get<VariableID::SlipRate>(outputData->vars);
       slipRate(DirectionID::Strike, level, i) = local.slipRateStrike;
       slipRate(DirectionID::Dip, level, i) = local.slipRateDip;
     }
 
-    auto& transientTractions = std::get<VariableID::TransientTractions>(outputData->vars);
-    if (transientTractions.isActive) {
+    if constexpr (writesTransientTractions) {
+      auto& transientTractions = std::get<VariableID::TransientTractions>(outputData->vars);
       transientTractions(DirectionID::Strike, level, i) = rotatedUpdatedStress[QuantityIndices::XY];
       transientTractions(DirectionID::Dip, level, i) = rotatedUpdatedStress[QuantityIndices::XZ];
       transientTractions(DirectionID::Normal, level, i) =
@@ -184,8 +238,8 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
       ruptureTime(level, i) = rt[local.ltsId][local.nearestGpIndex];
     }
 
-    auto& normalVelocity = std::get<VariableID::NormalVelocity>(outputData->vars);
-    if (normalVelocity.isActive) {
+    if constexpr (writesNormalVelocity) {
+      auto& normalVelocity = std::get<VariableID::NormalVelocity>(outputData->vars);
       normalVelocity(level, i) = local.faultNormalVelocity;
     }
 
@@ -195,8 +249,8 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
       accumulatedSlip(level, i) = slip[local.ltsId][local.nearestGpIndex];
     }
 
-    auto& totalTractions = std::get<VariableID::TotalTractions>(outputData->vars);
-    if (totalTractions.isActive) {
+    if constexpr (writesTotalTractions) {
+      auto& totalTractions = std::get<VariableID::TotalTractions>(outputData->vars);
       std::array<real, tensor::rotatedStress::size()> rotatedInitStress{};
       alignAlongDipAndStrikeKernel.initialStress = initStress;
       alignAlongDipAndStrikeKernel.rotatedStress = rotatedInitStress.data();
@@ -211,8 +265,8 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
                                                       rotatedInitStress[QuantityIndices::XX];
     }
 
-    auto& ruptureVelocity = std::get<VariableID::RuptureVelocity>(outputData->vars);
-    if (ruptureVelocity.isActive) {
+    if constexpr (writesRuptureVelocity) {
+      auto& ruptureVelocity = std::get<VariableID::RuptureVelocity>(outputData->vars);
       auto& jacobiT2d = outputData->jacobianT2d[i];
       ruptureVelocity(level, i) = this->computeRuptureVelocity(jacobiT2d, local);
     }
@@ -229,8 +283,8 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
       dynamicStressTime(level, i) = dynStressTime[local.ltsId][local.nearestGpIndex];
     }
 
-    auto& slipVectors = std::get<VariableID::Slip>(outputData->vars);
-    if (slipVectors.isActive) {
+    if constexpr (writesSlip) {
+      auto& slipVectors = std::get<VariableID::Slip>(outputData->vars);
       VrtxCoords crossProduct = {0.0, 0.0, 0.0};
       MeshTools::cross(strike.data(), tangent1.data(), crossProduct);
 
@@ -252,11 +306,6 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
     }
     this->outputSpecifics(outputData, local, level, i);
   }
-
-  if (type == OutputType::AtPickpoint) {
-    outputData->cachedTime[outputData->currentCacheLevel] = time;
-    outputData->currentCacheLevel += 1;
-  }
 }
 
 void ReceiverOutput::computeLocalStresses(LocalInfo& local) {
@@ -363,45 +412,13 @@ real ReceiverOutput::computeRuptureVelocity(Eigen::Matrix<real, 2, 2>& jacobiT2d
   }
 
   if (needsUpdate) {
-    constexpr int numPoly = CONVERGENCE_ORDER - 1;
-    constexpr int numDegFr2d = (numPoly + 1) * (numPoly + 2) / 2;
-    std::array<double, numDegFr2d> projectedRT{};
-    projectedRT.fill(0.0);
-
-    std::array<double, 2 * numDegFr2d> phiAtPoint{};
-    phiAtPoint.fill(0.0);
-
-    auto chiTau2dPoints =
-        init::quadpoints::view::create(const_cast<real*>(init::quadpoints::Values));
-    auto weights = init::quadweights::view::create(const_cast<real*>(init::quadweights::Values));
-
-    auto* rt = local.layer->var(drDescr->ruptureTime);
-    for (size_t jBndGP = 0; jBndGP < misc::numberOfBoundaryGaussPoints; ++jBndGP) {
-      real chi = chiTau2dPoints(jBndGP, 0);
-      real tau = chiTau2dPoints(jBndGP, 1);
-      basisFunction::tri_dubiner::evaluatePolynomials(phiAtPoint.data(), chi, tau, numPoly);
-
-      for (size_t d = 0; d < numDegFr2d; ++d) {
-        projectedRT[d] += weights(jBndGP) * rt[local.ltsId][jBndGP] * phiAtPoint[d];
-      }
-    }
-
-    auto m2inv =
-        seissol::init::M2inv::view::create(const_cast<real*>(seissol::init::M2inv::Values));
-    for (size_t d = 0; d < numDegFr2d; ++d) {
-      projectedRT[d] *= m2inv(d, d);
-    }
-
-    const real chi = chiTau2dPoints(local.nearestInternalGpIndex, 0);
-    const real tau = chiTau2dPoints(local.nearestInternalGpIndex, 1);
-
-    basisFunction::tri_dubiner::evaluateGradPolynomials(phiAtPoint.data(), chi, tau, numPoly);
-
-    real dTdChi{0.0};
-    real dTdTau{0.0};
-    for (size_t d = 0; d < numDegFr2d; ++d) {
-      dTdChi += projectedRT[d] * phiAtPoint[2 * d];
-      dTdTau += projectedRT[d] * phiAtPoint[2 * d + 1];
+    // gradient of the rupture time, projected onto the 2d basis of the fault face
+    const auto& coefficients = ruptureTimeGradientCoefficients[local.nearestInternalGpIndex];
+    double dTdChi{0.0};
+    double dTdTau{0.0};
+    for (size_t point = 0; point < misc::numberOfBoundaryGaussPoints; ++point) {
+      dTdChi += coefficients[0][point] * ruptureTime[point];
+      dTdTau += coefficients[1][point] * ruptureTime[point];
     }
     const real dTdX = jacobiT2d(0, 0) * dTdChi + jacobiT2d(0, 1) * dTdTau;
     const real dTdY = jacobiT2d(1, 0) * dTdChi + jacobiT2d(1, 1) * dTdTau;
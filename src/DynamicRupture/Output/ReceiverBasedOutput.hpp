@@ -1,15 +1,18 @@
 #ifndef SEISSOL_DR_RECEIVER_BASED_OUTPUT_HPP
 #define SEISSOL_DR_RECEIVER_BASED_OUTPUT_HPP
 
+#include "DynamicRupture/Output/OutputAux.hpp"
 #include "DynamicRupture/Output/ParametersInitializer.hpp"
 #include "Geometry/MeshReader.h"
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/LTS.h"
 #include "Initializer/tree/Lut.hpp"
+#include <utility>
 
 namespace seissol::dr::output {
 class ReceiverOutput {
   public:
+  ReceiverOutput();
   virtual ~ReceiverOutput() = default;
 
   void setLtsData(seissol::initializers::LTSTree* userWpTree,
@@ -71,6 +74,48 @@ class ReceiverOutput {
     model::IsotropicWaveSpeeds* waveSpeedsMinus{};
   };
 
+  /**
+   * Variables which select an instantiation of calcFaultOutputAtReceivers, such that
+   * the computations they need are skipped at compile time if they are not written.
+   * The remaining variables are only copied from the LTS tree and checked at runtime.
+   */
+  static constexpr std::array<VariableID, 6> CompileTimeVariables{SlipRate,
+                                                                  TransientTractions,
+                                                                  NormalVelocity,
+                                                                  TotalTractions,
+                                                                  Slip,
+                                                                  RuptureVelocity};
+
+  static constexpr unsigned expandVariableMask(unsigned compactMask) {
+    unsigned mask = 0;
+    for (size_t i = 0; i < CompileTimeVariables.size(); ++i) {
+      if ((compactMask >> i) & 1U) {
+        mask |= 1U << CompileTimeVariables[i];
+      }
+    }
+    return mask;
+  }
+
+  static constexpr bool isSelected(unsigned mask, VariableID variable) {
+    return (mask >> variable) & 1U;
+  }
+
+  using CalcFaultOutputFunction = void (ReceiverOutput::*)(size_t,
+                                                           std::shared_ptr<ReceiverOutputData>&,
+                                                           const GeneralParams&);
+
+  template <size_t... CompactMasks>
+  static constexpr auto makeCalcFaultOutputFunctions(std::index_sequence<CompactMasks...>) {
+    return std::array<CalcFaultOutputFunction, sizeof...(CompactMasks)>{
+        &ReceiverOutput::calcFaultOutputAtReceivers<expandVariableMask(CompactMasks)>...};
+  }
+
+  //! @param VariableMask bit v is set if the variable with VariableID v is written
+  template <unsigned VariableMask>
+  void calcFaultOutputAtReceivers(size_t level,
+                                  std::shared_ptr<ReceiverOutputData>& outputData,
+                                  const GeneralParams& generalParams);
+
   void getDofs(real dofs[tensor::Q::size()], int meshId);
   void getNeighbourDofs(real dofs[tensor::Q::size()], int meshId, int side);
   void computeLocalStresses(LocalInfo& local);
@@ -79,6 +124,9 @@ class ReceiverOutput {
   virtual real computeStateVariable(LocalInfo& local) { return 0.0; }
   void updateLocalTractions(LocalInfo& local, real strength);
   real computeRuptureVelocity(Eigen::Matrix<real, 2, 2>& jacobiT2d, const LocalInfo& local);
+
+  //! Gradient of the projected rupture time for every nearestInternalGpIndex
+  std::vector<ProjectedGradientCoefficients> ruptureTimeGradientCoefficients;
   virtual void
       computeSlipRate(LocalInfo& local, const std::array<real, 6>&, const std::array<real, 6>&);
   void computeSlipRate(LocalInfo& local,
@@ -34,11 +34,13 @@ struct DRParameters {
   real rsInitialSlipRate1{0.0};
   real rsInitialSlipRate2{0.0};
   real muW{0.0};
+  bool rsNewtonFaceBlocks{true};
   real thermalDiffusivity{0.0};
   real heatCapacity{0.0};
   real undrainedTPResponse{0.0};
   real initialTemperature{0.0};
   real initialPressure{0.0};
+  unsigned tpGridPoints{misc::numberOfTPGridPoints};
   real vStar{0.0}; // Prakash-Clifton regularization parameter
   real prakashLength{0.0};
   std::string faultFileName{""};
@@ -71,6 +73,7 @@ inline std::unique_ptr<DRParameters> readParametersFromYaml(std::shared_ptr<YAML
     drParameters->rsInitialSlipRate1 = getWithDefault(yamlDrParams, "rs_inisliprate1", 0.0);
     drParameters->rsInitialSlipRate2 = getWithDefault(yamlDrParams, "rs_inisliprate2", 0.0);
     drParameters->muW = getWithDefault(yamlDrParams, "rs_muw", 0.0);
+    drParameters->rsNewtonFaceBlocks = getWithDefault(yamlDrParams, "rs_newtonfaceblocks", 1) != 0;
 
     // Thermal Pressurization parameters
     drParameters->thermalDiffusivity = getWithDefault(yamlDrParams, "tp_thermaldiffusivity", 0.0);
@@ -78,6 +81,8 @@ inline std::unique_ptr<DRParameters> readParametersFromYaml(std::shared_ptr<YAML
     drParameters->undrainedTPResponse = getWithDefault(yamlDrParams, "tp_undrainedtpresponse", 0.0);
     drParameters->initialTemperature = getWithDefault(yamlDrParams, "tp_initemp", 0.0);
     drParameters->initialPressure = getWithDefault(yamlDrParams, "tp_inipressure", 0.0);
+    drParameters->tpGridPoints = getWithDefault(
+        yamlDrParams, "tp_gridpoints", static_cast<unsigned>(misc::numberOfTPGridPoints));
 
     // Prakash-Clifton regularization parameters
     drParameters->vStar = getWithDefault(yamlDrParams, "pc_vstar", 0.0);
@@ -71,8 +71,15 @@
 
 #include "Kernels/Neighbor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <stdint.h>
+#include <utility>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 void seissol::kernels::NeighborBase::checkGlobalData(GlobalData const* global, size_t alignment) {
 #ifndef NDEBUG
@@ -100,6 +107,11 @@ void seissol::kernels::Neighbor::setHostGlobalData(GlobalData const* global) {
   m_nfKrnlPrototype.rT = global->neighbourChangeOfBasisMatricesTransposed;
   m_nfKrnlPrototype.fP = global->neighbourFluxMatrices;
   m_drKrnlPrototype.V3mTo2nTWDivM = global->nodalFluxMatrices;
+#ifndef MULTIPLE_SIMULATIONS
+  m_nfBatchKrnlPrototype.rT = global->neighbourChangeOfBasisMatricesTransposed;
+  m_nfBatchKrnlPrototype.fP = global->neighbourFluxMatrices;
+  m_nfProjectionKrnlPrototype.rDivM = global->changeOfBasisMatrices;
+#endif
 }
 
 void seissol::kernels::Neighbor::setGlobalData(const CompoundGlobalData& global) {
@@ -240,7 +252,155 @@ void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalBatc
     resetDeviceCurrentState(streamCounter);
   }
 #else
-  assert(false && "no implementation provided");
+  // Host execution of the same batches: all cells of a batch share the face and the face relation,
+  // i.e. the flux matrices, such that the kernel is selected once per batch.
+  // The batches are recorded in cell order, i.e. with increasing addresses of the dofs. Each thread
+  // updates the cells in its share of the address range for all faces and batches; hence, the
+  // threads never update the same cell and the faces need no synchronization.
+  kernel::neighboringFlux neighFluxKrnl = m_nfKrnlPrototype;
+  dynamicRupture::kernel::nodalFlux drKrnl = m_drKrnlPrototype;
+#ifndef MULTIPLE_SIMULATIONS
+  // Full chunks of a batch share the face-local part of the flux: the time integrated dofs of the chunk
+  // are packed and multiplied with the flux matrices at once, then projected back to each cell.
+  kernel::neighboringFluxBatch neighFluxBatchKrnl = m_nfBatchKrnlPrototype;
+  kernel::neighboringFluxProjection neighFluxProjectionKrnl = m_nfProjectionKrnlPrototype;
+  constexpr size_t BatchSize = tensor::IBatch::Shape[2];
+  static_assert(tensor::IBatch::size() == BatchSize * tensor::I::size(),
+                "the packed chunk must consist of the time integrated dofs of its cells");
+  static_assert(tensor::fluxBatch::size() == BatchSize * tensor::fluxFace::size(),
+                "the face-local flux of the chunk must consist of the face-local flux of its cells");
+#endif
+
+  real* firstDofs = nullptr;
+  real* lastDofs = nullptr;
+  for (auto& [key, entry] : table) {
+    if (key.kernelId == *KernelNames::NeighborFlux && entry.content[*EntityId::Dofs] != nullptr) {
+      const size_t numElements = (entry.content[*EntityId::Dofs])->getSize();
+      real** dofs = (entry.content[*EntityId::Dofs])->getPointers();
+      assert(std::is_sorted(dofs, dofs + numElements, std::less<real*>()));
+      if (firstDofs == nullptr || std::less<real*>()(dofs[0], firstDofs)) {
+        firstDofs = dofs[0];
+      }
+      if (lastDofs == nullptr || std::less<real*>()(lastDofs, dofs[numElements - 1])) {
+        lastDofs = dofs[numElements - 1];
+      }
+    }
+  }
+  if (firstDofs == nullptr) {
+    return;
+  }
+  const size_t addressRange = static_cast<size_t>(lastDofs - firstDofs) + 1;
+
+#ifdef _OPENMP
+#ifndef MULTIPLE_SIMULATIONS
+  #pragma omp parallel firstprivate(neighFluxKrnl, drKrnl, neighFluxBatchKrnl, neighFluxProjectionKrnl)
+#else
+  #pragma omp parallel firstprivate(neighFluxKrnl, drKrnl)
+#endif
+#endif
+  {
+#ifdef _OPENMP
+    const size_t thread = omp_get_thread_num();
+    const size_t numThreads = omp_get_num_threads();
+#else
+    const size_t thread = 0;
+    const size_t numThreads = 1;
+#endif
+    real* const ownedBegin = firstDofs + (addressRange * thread) / numThreads;
+    real* const ownedEnd = firstDofs + (addressRange * (thread + 1)) / numThreads;
+
+#ifndef MULTIPLE_SIMULATIONS
+    alignas(ALIGNMENT) real iBatch[tensor::IBatch::size()];
+    alignas(ALIGNMENT) real fluxBatch[tensor::fluxBatch::size()];
+    neighFluxBatchKrnl.IBatch = iBatch;
+    neighFluxBatchKrnl.fluxBatch = fluxBatch;
+#endif
+
+    // entries [begin, end) of a batch belong to the cells of this thread
+    auto ownedElements = [&](real** dofs, size_t numElements) {
+      real** begin = std::lower_bound(dofs, dofs + numElements, ownedBegin, std::less<real*>());
+      real** end = std::lower_bound(begin, dofs + numElements, ownedEnd, std::less<real*>());
+      return std::make_pair(static_cast<size_t>(begin - dofs), static_cast<size_t>(end - dofs));
+    };
+
+    for(size_t face = 0; face < 4; face++) {
+      // regular and periodic
+      for (size_t faceRelation = 0; faceRelation < (*FaceRelations::Count); ++faceRelation) {
+
+        ConditionalKey key(*KernelNames::NeighborFlux,
+                           (FaceKinds::Regular || FaceKinds::Periodic),
+                           face,
+                           faceRelation);
+
+        auto found = table.find(key);
+        if(found != table.end()) {
+          BatchTable &entry = found->second;
+
+          real** dofs = (entry.content[*EntityId::Dofs])->getPointers();
+          real** idofs = (entry.content[*EntityId::Idofs])->getPointers();
+          real** aminusT = (entry.content[*EntityId::AminusT])->getPointers();
+          const auto [begin, end] = ownedElements(dofs, (entry.content[*EntityId::Dofs])->getSize());
+          const auto execute = kernel::neighboringFlux::ExecutePtrs[faceRelation];
+
+          size_t element = begin;
+#ifndef MULTIPLE_SIMULATIONS
+          // the face relation is numbered as the neighboringFlux family, i.e. (h, j, face)
+          const auto executeBatch = kernel::neighboringFluxBatch::ExecutePtrs[faceRelation % 12];
+          const auto executeProjection = kernel::neighboringFluxProjection::ExecutePtrs[face];
+          for (; element + BatchSize <= end; element += BatchSize) {
+            for (size_t cell = 0; cell < BatchSize; ++cell) {
+              std::copy_n(idofs[element + cell], tensor::I::size(), iBatch + cell * tensor::I::size());
+            }
+            (neighFluxBatchKrnl.*executeBatch)();
+            for (size_t cell = 0; cell < BatchSize; ++cell) {
+              neighFluxProjectionKrnl.Q = dofs[element + cell];
+              neighFluxProjectionKrnl.fluxFace = fluxBatch + cell * tensor::fluxFace::size();
+              neighFluxProjectionKrnl.AminusT = aminusT[element + cell];
+              (neighFluxProjectionKrnl.*executeProjection)();
+            }
+          }
+#endif
+
+          // remainder of the batch
+          for (; element < end; ++element) {
+            neighFluxKrnl.Q = dofs[element];
+            neighFluxKrnl.I = idofs[element];
+            neighFluxKrnl.AminusT = aminusT[element];
+            neighFluxKrnl._prefetch.I = idofs[element + 1 < end ? element + 1 : element];
+            (neighFluxKrnl.*execute)();
+          }
+        }
+      }
+
+      // dynamic rupture
+      for (unsigned faceRelation = 0; faceRelation < (*DrFaceRelations::Count); ++faceRelation) {
+
+        ConditionalKey key(*KernelNames::NeighborFlux,
+                           *FaceKinds::DynamicRupture,
+                           face,
+                           faceRelation);
+
+        auto found = table.find(key);
+        if(found != table.end()) {
+          BatchTable &entry = found->second;
+
+          real** dofs = (entry.content[*EntityId::Dofs])->getPointers();
+          real** godunov = (entry.content[*EntityId::Godunov])->getPointers();
+          real** fluxSolver = (entry.content[*EntityId::FluxSolver])->getPointers();
+          const auto [begin, end] = ownedElements(dofs, (entry.content[*EntityId::Dofs])->getSize());
+          const auto execute = dynamicRupture::kernel::nodalFlux::ExecutePtrs[faceRelation];
+
+          for (size_t element = begin; element < end; ++element) {
+            drKrnl.Q = dofs[element];
+            drKrnl.QInterpolated = godunov[element];
+            drKrnl.fluxSolver = fluxSolver[element];
+            drKrnl._prefetch.I = godunov[element + 1 < end ? element + 1 : element];
+            (drKrnl.*execute)();
+          }
+        }
+      }
+    }
+  }
 #endif
 }
 
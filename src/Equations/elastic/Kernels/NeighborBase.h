@@ -88,6 +88,10 @@ class seissol::kernels::NeighborBase {
     static void checkGlobalData(GlobalData const* global, size_t alignment);
     kernel::neighboringFlux m_nfKrnlPrototype;
     dynamicRupture::kernel::nodalFlux m_drKrnlPrototype;
+#ifndef MULTIPLE_SIMULATIONS
+    kernel::neighboringFluxBatch m_nfBatchKrnlPrototype;
+    kernel::neighboringFluxProjection m_nfProjectionKrnlPrototype;
+#endif
 
 #ifdef ACL_DEVICE
   kernel::gpu_neighboringFlux deviceNfKrnlPrototype;
@@ -57,6 +57,8 @@ typedef int ElemFaultTags[4];
 
 struct Element {
 	int localId;
+	/** Id of the element in the mesh file, or -1 if the mesh reader does not provide it */
+	int globalId = -1;
 	ElemVertices vertices;
 	int rank;
 	ElemNeighbors neighbors;
@@ -55,9 +55,85 @@
 #include "Monitoring/instrumentation.fpp"
 #include "Monitoring/Stopwatch.h"
 #include "Numerical_aux/Statistics.h"
+#include "Initializer/InputAux.hpp"
+#include "Initializer/time_stepping/LtsWeights/CostModel.h"
 #include "Initializer/time_stepping/LtsWeights/WeightsFactory.h"
+#include "Initializer/time_stepping/MultiRate.hpp"
 #include "Solver/time_stepping/MiniSeisSol.h"
 
+#if defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+/**
+ * Sets the vertex weights from the measured kernel costs.
+ * The costs are read from cacheFile if it contains them for this configuration.
+ */
+static void calibrateVertexWeights(bool usePlasticity,
+                                   std::string const& cacheFile,
+                                   int& vertexWeightElement,
+                                   int& vertexWeightDynamicRupture,
+                                   int& vertexWeightFreeSurfaceWithGravity) {
+	using namespace seissol::initializers::time_stepping;
+	const int rank = seissol::MPI::mpi.rank();
+	const auto key = costModelKey(usePlasticity);
+
+	KernelCosts costs;
+	int isCached = 0;
+	if (rank == 0 && !cacheFile.empty()) {
+		if (auto cachedCosts = loadKernelCosts(cacheFile, key)) {
+			costs = *cachedCosts;
+			isCached = 1;
+		}
+	}
+	MPI_Bcast(&isCached, 1, MPI_INT, 0, seissol::MPI::mpi.comm());
+
+	double values[5] = {costs.local, costs.neighbor, costs.plasticity, costs.dynamicRupture, costs.freeSurfaceWithGravity};
+	if (isCached) {
+		logInfo(rank) << "Using LTS kernel costs from" << cacheFile;
+		MPI_Bcast(values, 5, MPI_DOUBLE, 0, seissol::MPI::mpi.comm());
+	} else {
+		logInfo(rank) << "Measuring LTS kernel costs";
+		costs = seissol::measureKernelCosts(seissol::SeisSol::main.getMemoryManager(), usePlasticity);
+		values[0] = costs.local;
+		values[1] = costs.neighbor;
+		values[2] = costs.plasticity;
+		values[3] = costs.dynamicRupture;
+		values[4] = costs.freeSurfaceWithGravity;
+		// All ranks have to use the same weights
+		MPI_Allreduce(MPI_IN_PLACE, values, 5, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+		for (auto& value : values) {
+			value /= seissol::MPI::mpi.size();
+		}
+	}
+	costs = KernelCosts{values[0], values[1], values[2], values[3], values[4]};
+	if (!isCached && rank == 0 && !cacheFile.empty()) {
+		storeKernelCosts(cacheFile, key, costs);
+	}
+
+	// The cache holds the measured interpolation cost; the friction law depends on the setup
+	const auto& drParams = (*seissol::SeisSol::main.getInputParams())["dynamicrupture"];
+	const auto frictionLawType = static_cast<seissol::dr::FrictionLawType>(
+	    seissol::initializers::getWithDefault(drParams, "fl", 0));
+	const bool isThermalPressureOn = seissol::initializers::getWithDefault(drParams, "thermalpress", false);
+	const double frictionLawFactor = frictionLawCostFactor(frictionLawType, isThermalPressureOn);
+	costs.dynamicRupture *= frictionLawFactor;
+
+	const auto weights = computeVertexWeights(costs, vertexWeightElement);
+	vertexWeightDynamicRupture = weights.dynamicRupture;
+	// Not measured for all equations
+	if (costs.freeSurfaceWithGravity > 0.0) {
+		vertexWeightFreeSurfaceWithGravity = weights.freeSurfaceWithGravity;
+	}
+	logInfo(rank) << "Kernel costs per time step [s]: local =" << costs.local
+	              << "neighbor =" << costs.neighbor
+	              << "plasticity =" << costs.plasticity
+	              << "dynamic rupture face =" << costs.dynamicRupture
+	              << "(friction law factor" << frictionLawFactor << ")"
+	              << "free surface with gravity face =" << costs.freeSurfaceWithGravity;
+	logInfo(rank) << "Vertex weights: element =" << vertexWeightElement
+	              << "dynamic rupture =" << vertexWeightDynamicRupture
+	              << "free surface with gravity =" << vertexWeightFreeSurfaceWithGravity;
+}
+#endif // defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+
 void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const displacement[3], double const scalingMatrix[3][3])
 {
 	logInfo(rank) << "Reading mesh. Done.";
@@ -318,6 +394,15 @@ void read_mesh_puml_c(const char* meshfile,
 #else
     logInfo(rank) << "Skipping mini SeisSol";
 #endif
+
+    const auto& meshParams = (*seissol::SeisSol::main.getInputParams())["meshnml"];
+    if (seissol::initializers::getWithDefault(meshParams, "vertexweightcalibration", 0) != 0) {
+      calibrateVertexWeights(usePlasticity,
+                             seissol::initializers::getWithDefault(meshParams, "vertexweightcachefile", std::string("")),
+                             vertexWeightElement,
+                             vertexWeightDynamicRupture,
+                             vertexWeightFreeSurfaceWithGravity);
+    }
   }
 
 	logInfo(rank) << "Reading PUML mesh" << meshfile;
@@ -333,7 +418,10 @@ void read_mesh_puml_c(const char* meshfile,
 		static_cast<unsigned int>(clusterRate),
 		vertexWeightElement,
 		vertexWeightDynamicRupture,
-		vertexWeightFreeSurfaceWithGravity
+		vertexWeightFreeSurfaceWithGravity,
+		seissol::initializers::getWithDefault((*seissol::SeisSol::main.getInputParams())["meshnml"],
+		                                      "measuredcostsfile",
+		                                      std::string(""))
 	};
 
 	LtsWeightsTypes ltsWeightsType{};
@@ -348,6 +436,10 @@ void read_mesh_puml_c(const char* meshfile,
 	auto meshReader = new seissol::PUMLReader(meshfile, maximumAllowedTimeStep, checkPointFile,
         ltsWeights.get(), tpwgt, readPartitionFromFile);
 	seissol::SeisSol::main.setMeshReader(meshReader);
+	if (static_cast<unsigned int>(clusterRate) == seissol::initializers::time_stepping::MultiRate::AutomaticRate) {
+		// The layout has to use the rate of the partitioning
+		seissol::SeisSol::main.getLtsLayout().setSelectedClusterRate(ltsWeights->rate());
+	}
 
 	read_mesh(rank, seissol::SeisSol::main.meshReader(), hasFault, displacement, scalingMatrix);
 
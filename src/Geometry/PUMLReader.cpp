@@ -324,6 +324,7 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 	m_elements.resize(cells.size());
 	for (unsigned int i = 0; i < cells.size(); i++) {
 		m_elements[i].localId = i;
+		m_elements[i].globalId = cells[i].gid();
 
 		// Vertices
 		PUML::Downward::vertices(puml, cells[i], reinterpret_cast<unsigned int*>(m_elements[i].vertices));
@@ -0,0 +1,170 @@
+#include "PointLocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#include "MeshTools.h"
+
+namespace seissol::geometry {
+
+void PointLocator::BoundingBox::extend(BoundingBox const& other) {
+  for (int i = 0; i < 3; ++i) {
+    min[i] = std::min(min[i], other.min[i]);
+    max[i] = std::max(max[i], other.max[i]);
+  }
+}
+
+bool PointLocator::BoundingBox::contains(Eigen::Vector3d const& point) const {
+  for (int i = 0; i < 3; ++i) {
+    if (point(i) < min[i] || point(i) > max[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+PointLocator::PointLocator(std::vector<Vertex> const& vertices,
+                           std::vector<Element> const& elements)
+    : vertices(vertices), elements(elements) {
+  const auto numElements = static_cast<unsigned>(elements.size());
+  if (numElements == 0) {
+    return;
+  }
+
+  std::vector<BoundingBox> elementBoxes(numElements);
+  std::vector<std::array<double, 3>> centroids(numElements);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (unsigned elem = 0; elem < numElements; ++elem) {
+    auto& box = elementBoxes[elem];
+    box.min.fill(std::numeric_limits<double>::max());
+    box.max.fill(std::numeric_limits<double>::lowest());
+    for (int v = 0; v < 4; ++v) {
+      const auto& coords = vertices[elements[elem].vertices[v]].coords;
+      for (int i = 0; i < 3; ++i) {
+        box.min[i] = std::min(box.min[i], coords[i]);
+        box.max[i] = std::max(box.max[i], coords[i]);
+      }
+    }
+    // The plane test accepts points which are outside of the element up to round-off.
+    // Hence, we inflate the box slightly such that no such point is missed.
+    double diameter = 0.0;
+    for (int i = 0; i < 3; ++i) {
+      diameter = std::max(diameter, box.max[i] - box.min[i]);
+    }
+    const double tolerance = 1e-8 * diameter;
+    for (int i = 0; i < 3; ++i) {
+      box.min[i] -= tolerance;
+      box.max[i] += tolerance;
+      centroids[elem][i] = 0.5 * (box.min[i] + box.max[i]);
+    }
+  }
+
+  elementOrder.resize(numElements);
+  for (unsigned elem = 0; elem < numElements; ++elem) {
+    elementOrder[elem] = elem;
+  }
+  nodes.reserve(2 * (numElements / LeafSize + 1));
+  build(0, numElements, elementBoxes, centroids);
+}
+
+unsigned PointLocator::build(unsigned begin,
+                             unsigned end,
+                             std::vector<BoundingBox> const& elementBoxes,
+                             std::vector<std::array<double, 3>> const& centroids) {
+  const auto nodeIndex = static_cast<unsigned>(nodes.size());
+  nodes.emplace_back();
+
+  BoundingBox box = elementBoxes[elementOrder[begin]];
+  BoundingBox centroidBox{centroids[elementOrder[begin]], centroids[elementOrder[begin]]};
+  for (unsigned i = begin + 1; i < end; ++i) {
+    box.extend(elementBoxes[elementOrder[i]]);
+    centroidBox.extend({centroids[elementOrder[i]], centroids[elementOrder[i]]});
+  }
+  nodes[nodeIndex].box = box;
+
+  if (end - begin <= LeafSize) {
+    nodes[nodeIndex].begin = begin;
+    nodes[nodeIndex].end = end;
+    nodes[nodeIndex].right = 0;
+    return nodeIndex;
+  }
+
+  // Median split along the longest axis of the centroids
+  int axis = 0;
+  for (int i = 1; i < 3; ++i) {
+    if (centroidBox.max[i] - centroidBox.min[i] > centroidBox.max[axis] - centroidBox.min[axis]) {
+      axis = i;
+    }
+  }
+  const unsigned mid = begin + (end - begin) / 2;
+  std::nth_element(elementOrder.begin() + begin,
+                   elementOrder.begin() + mid,
+                   elementOrder.begin() + end,
+                   [&](unsigned a, unsigned b) { return centroids[a][axis] < centroids[b][axis]; });
+
+  build(begin, mid, elementBoxes, centroids);
+  const unsigned right = build(mid, end, elementBoxes, centroids);
+  nodes[nodeIndex].begin = begin;
+  nodes[nodeIndex].end = end;
+  nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+bool PointLocator::contains(Element const& element,
+                            std::vector<Vertex> const& vertices,
+                            Eigen::Vector3d const& point) {
+  const double homogeneousPoint[4] = {point(0), point(1), point(2), 1.0};
+  for (int face = 0; face < 4; ++face) {
+    VrtxCoords n, p;
+    MeshTools::pointOnPlane(element, face, vertices, p);
+    MeshTools::normal(element, face, vertices, n);
+    const double planeEquation[4] = {n[0], n[1], n[2], -MeshTools::dot(n, p)};
+
+    double result = 0.0;
+    for (unsigned dim = 0; dim < 4; ++dim) {
+      result += planeEquation[dim] * homogeneousPoint[dim];
+    }
+    if (result > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int PointLocator::findElement(Eigen::Vector3d const& point) const {
+  int foundId = -1;
+  if (nodes.empty()) {
+    return foundId;
+  }
+
+  // The depth of the tree is bounded by log2(#elements)
+  std::array<unsigned, 64> stack;
+  unsigned stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (!node.box.contains(point)) {
+      continue;
+    }
+    if (node.right == 0) {
+      for (unsigned i = node.begin; i < node.end; ++i) {
+        const auto& element = elements[elementOrder[i]];
+        if ((foundId < 0 || element.localId < foundId) && contains(element, vertices, point)) {
+          foundId = element.localId;
+        }
+      }
+    } else {
+      assert(stackSize + 2 <= stack.size());
+      const auto left = static_cast<unsigned>(&node - nodes.data()) + 1;
+      stack[stackSize++] = node.right;
+      stack[stackSize++] = left;
+    }
+  }
+  return foundId;
+}
+
+} // namespace seissol::geometry
@@ -0,0 +1,76 @@
+#ifndef SEISSOL_POINTLOCATOR_H
+#define SEISSOL_POINTLOCATOR_H
+
+#include <array>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "MeshDefinition.h"
+
+namespace seissol::geometry {
+
+/**
+ * Bounding volume hierarchy over the tetrahedra of a mesh, which answers
+ * point-in-tetrahedron queries in O(log n) instead of testing every element.
+ *
+ * The locator keeps references to vertices and elements, i.e. both must outlive
+ * the locator and must not be modified while it is in use.
+ */
+class PointLocator {
+  public:
+  PointLocator(std::vector<Vertex> const& vertices, std::vector<Element> const& elements);
+
+  /**
+   * Returns the local id of the element which contains the point or -1 if
+   * no element contains the point. If the point lies on a face shared by
+   * several elements, the element with the smallest local id is returned.
+   * This matches the (brute force) behaviour of initializers::findMeshIds.
+   */
+  [[nodiscard]] int findElement(Eigen::Vector3d const& point) const;
+
+  /**
+   * The same inside/outside test as used by the brute force search,
+   * i.e. points on a face belong to the element.
+   */
+  static bool contains(Element const& element,
+                       std::vector<Vertex> const& vertices,
+                       Eigen::Vector3d const& point);
+
+  [[nodiscard]] std::size_t numberOfNodes() const { return nodes.size(); }
+
+  private:
+  //! Maximum number of elements in a leaf
+  static constexpr unsigned LeafSize = 8;
+
+  struct BoundingBox {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+
+    void extend(BoundingBox const& other);
+    [[nodiscard]] bool contains(Eigen::Vector3d const& point) const;
+  };
+
+  struct Node {
+    BoundingBox box;
+    //! Range of leaf elements (in elementOrder) or child index for inner nodes
+    unsigned begin;
+    unsigned end;
+    //! Index of the right child, the left child is stored directly after this node; 0 for leaves
+    unsigned right;
+  };
+
+  unsigned build(unsigned begin,
+                 unsigned end,
+                 std::vector<BoundingBox> const& elementBoxes,
+                 std::vector<std::array<double, 3>> const& centroids);
+
+  std::vector<Vertex> const& vertices;
+  std::vector<Element> const& elements;
+  std::vector<Node> nodes;
+  std::vector<unsigned> elementOrder;
+};
+
+} // namespace seissol::geometry
+
+#endif // SEISSOL_POINTLOCATOR_H
@@ -42,6 +42,8 @@
 
 #include <cassert>
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -62,6 +64,9 @@ class VariableSubsampler
 private:
     std::vector<basisFunction::SampledBasisFunctions<T> > m_BasisFunctions;
 
+    /** The sampled basis functions of all sub cells (sub cells x basis functions) */
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> m_basisMatrix;
+
     /** The original number of cells (without refinement) */
     const unsigned int m_numCells;
 
@@ -92,6 +97,18 @@ public:
 
     void get(const real* inData, const unsigned int* cellMap,
             int variable, real* outData) const;
+
+    /**
+     * Evaluates several variables in a single pass over the cells.
+     * The DOFs of each cell are read once and multiplied with the sampled
+     * basis functions of all sub cells.
+     *
+     * @param variables The variables which are evaluated
+     * @param outData One output buffer per variable in <code>variables</code>
+     * @return False if any of the evaluated values is Inf or NaN
+     */
+    bool getMultiple(const real* inData, const unsigned int* cellMap,
+            const std::vector<unsigned int>& variables, real* const* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -124,6 +141,14 @@ VariableSubsampler<T>::VariableSubsampler(
 
     delete [] subCells;
     delete [] additionalVertices;
+
+    const unsigned int numBasisFunctions = m_BasisFunctions[0].getSize();
+    m_basisMatrix.resize(kSubCellsPerCell, numBasisFunctions);
+    for (unsigned int i = 0; i < kSubCellsPerCell; i++) {
+        for (unsigned int j = 0; j < numBasisFunctions; j++) {
+            m_basisMatrix(i, j) = m_BasisFunctions[i].m_data[j];
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -146,6 +171,49 @@ void VariableSubsampler<T>::get(const real* inData,  const unsigned int* cellMap
 
 //------------------------------------------------------------------------------
 
+template<typename T>
+bool VariableSubsampler<T>::getMultiple(const real* inData, const unsigned int* cellMap,
+        const std::vector<unsigned int>& variables, real* const* outData) const
+{
+    using CellDofs = Eigen::Map<const Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>,
+        Eigen::Unaligned, Eigen::OuterStride<> >;
+
+    const unsigned int numBasisFunctions = m_basisMatrix.cols();
+    bool isFinite = true;
+
+#ifdef _OPENMP
+    #pragma omp parallel reduction(&&: isFinite)
+#endif
+    {
+        // Sub cells x requested variables
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> values(kSubCellsPerCell, variables.size());
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (unsigned int c = 0; c < m_numCells; ++c) {
+            const CellDofs dofs(&inData[getInVarOffset(c, 0, cellMap)],
+                    kNumVariables, numBasisFunctions, Eigen::OuterStride<>(kNumAlignedDOF));
+            for (std::size_t v = 0; v < variables.size(); ++v) {
+                values.col(v).noalias() =
+                    m_basisMatrix * dofs.row(variables[v]).transpose().template cast<T>();
+            }
+
+            for (std::size_t v = 0; v < variables.size(); ++v) {
+                for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
+                    const real value = values(sc, v);
+                    isFinite = isFinite && std::isfinite(value);
+                    outData[v][getOutVarOffset(c, sc)] = value;
+                }
+            }
+        }
+    }
+
+    return isFinite;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace
 }
 
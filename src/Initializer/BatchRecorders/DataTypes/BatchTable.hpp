@@ -80,9 +80,56 @@ public:
 } // namespace seissol::initializers::recording
 
 #else  // ACL_DEVICE
+
+#include "Condition.hpp"
+#include "EncodedConstants.hpp"
+#include <Kernels/precision.hpp>
+#include <array>
+#include <cassert>
+#include <utility>
+#include <vector>
+
 namespace seissol::initializers::recording {
-// Provide a dummy implementation for a pure CPU execution
-struct BatchTable {};
+
+/**
+ * Host version of the batch pointers: the pointers stay in host memory
+ * and are used directly by the batched CPU kernels.
+ */
+class BatchPointers {
+public:
+  explicit BatchPointers(std::vector<real *> collectedPointers)
+      : pointers(std::move(collectedPointers)) {}
+
+  real **getPointers() {
+    assert(!pointers.empty() && "requested batch has not been recorded");
+    return pointers.data();
+  }
+  size_t getSize() {
+    return pointers.size();
+  }
+
+private:
+  std::vector<real *> pointers{};
+};
+
+struct BatchTable {
+public:
+  BatchTable() {
+    for (auto &item : content) {
+      item = nullptr;
+    }
+  }
+  BatchTable(const BatchTable &) = delete;
+  BatchTable &operator=(const BatchTable &) = delete;
+  ~BatchTable() {
+    for (auto &item : content) {
+      delete item;
+    }
+  }
+
+  std::array<BatchPointers *, *EntityId::Count> content{};
+};
+
 } // namespace seissol::initializers::recording
 #endif // ACL_DEVICE
 
@@ -1,13 +1,40 @@
 #include "Recorders.h"
 #include "utils/logger.h"
 #include <Kernels/Interface.hpp>
+#include <Kernels/MixedPrecision.h>
+#include <Parallel/TaskScheduling.h>
+#include <utils/env.h>
 #include <yateto.h>
 
 
+#ifdef ACL_DEVICE
 using namespace device;
+#endif
 using namespace seissol::initializers;
 using namespace seissol::initializers::recording;
 
+bool seissol::initializers::recording::useHostBatchedNeighborIntegration() {
+#if !defined(ACL_DEVICE) && defined(USE_ELASTIC)
+  static const bool useBatches = []() {
+    const bool requested = utils::Env::get<int>("SEISSOL_BATCHED_NEIGHBOR_INTEGRATION", 0) != 0;
+    // the scratchpad memory is shared by all layers
+    if (requested && seissol::parallel::useTaskBasedScheduling()) {
+      logWarning() << "SEISSOL_BATCHED_NEIGHBOR_INTEGRATION is ignored with SEISSOL_TASK_BASED_SCHEDULING.";
+      return false;
+    }
+    // the batch tables point to the buffers directly
+    if (requested && seissol::kernels::mixed_precision::useReducedPrecisionBuffers()) {
+      logWarning() << "SEISSOL_BATCHED_NEIGHBOR_INTEGRATION is ignored with SEISSOL_MIXED_PRECISION.";
+      return false;
+    }
+    return requested;
+  }();
+  return useBatches;
+#else
+  return false;
+#endif
+}
+
 void NeighIntegrationRecorder::record(LTS &handler, Layer &layer) {
   kernels::NeighborData::Loader loader;
   loader.load(handler, layer);
@@ -122,8 +149,13 @@ void NeighIntegrationRecorder::recordNeighbourFluxIntegrals() {
 
             regularPeriodicDofs[face][faceRelation].push_back(static_cast<real *>(data.dofs));
             regularPeriodicIDofs[face][faceRelation].push_back(idofsAddressRegistry[neighbourBufferPtr]);
+#ifdef ACL_DEVICE
             regularPeriodicAminusT[face][faceRelation].push_back(
                 static_cast<real *>(data.neighIntegrationOnDevice.nAmNm1[face]));
+#else
+            regularPeriodicAminusT[face][faceRelation].push_back(
+                static_cast<real *>(data.neighboringIntegration.nAmNm1[face]));
+#endif
           }
           break;
         }
@@ -13,6 +13,12 @@ namespace seissol {
 namespace initializers {
 namespace recording {
 
+/**
+ * Returns true if CPU builds execute the neighbor integration with the recorded batch tables
+ * instead of the per-cell loop (SEISSOL_BATCHED_NEIGHBOR_INTEGRATION=1).
+ * Only available for elastic CPU builds without task-based scheduling.
+ */
+bool useHostBatchedNeighborIntegration();
 
 template<typename LtsT>
 class AbstractRecorder {
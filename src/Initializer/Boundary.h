@@ -15,7 +15,7 @@ struct seissol::initializers::Boundary {
   
   void addTo(LTSTree& tree) {
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(faceInformation, mask, 1, seissol::memory::Standard);
+    tree.addVar(faceInformation, mask, 1, seissol::memory::Standard, "faceInformation");
   }
 };
 #endif
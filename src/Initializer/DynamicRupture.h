@@ -115,41 +115,41 @@ public:
   
   virtual void addTo(LTSTree& tree) {
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(      timeDerivativePlus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(     timeDerivativeMinus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(        imposedStatePlus,             mask,     PAGESIZE_HEAP,      MEMKIND_IMPOSED_STATE );
-    tree.addVar(       imposedStateMinus,             mask,     PAGESIZE_HEAP,      MEMKIND_IMPOSED_STATE );
-    tree.addVar(             godunovData,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION );
-    tree.addVar(          fluxSolverPlus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION );
-    tree.addVar(         fluxSolverMinus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION );
-    tree.addVar(         faceInformation,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(          waveSpeedsPlus,             mask,                 1,      MEMKIND_STANDARD );
-    tree.addVar(         waveSpeedsMinus,             mask,                 1,      MEMKIND_STANDARD );
-    tree.addVar(          drEnergyOutput,             mask,         ALIGNMENT,      MEMKIND_STANDARD );
-    tree.addVar(      impAndEta,                      mask,                 1,      MEMKIND_STANDARD );
-    tree.addVar(      initialStressInFaultCS,         mask,                 1,      MEMKIND_STANDARD );
-    tree.addVar(      nucleationStressInFaultCS,      mask,                 1,      MEMKIND_STANDARD );
-    tree.addVar(      ruptureTime,                    mask,                 1,      MEMKIND_STANDARD );
+    tree.addVar(      timeDerivativePlus,             mask,                 1,      seissol::memory::Standard, "timeDerivativePlus" );
+    tree.addVar(     timeDerivativeMinus,             mask,                 1,      seissol::memory::Standard, "timeDerivativeMinus" );
+    tree.addVar(        imposedStatePlus,             mask,     PAGESIZE_HEAP,      MEMKIND_IMPOSED_STATE, "imposedStatePlus" );
+    tree.addVar(       imposedStateMinus,             mask,     PAGESIZE_HEAP,      MEMKIND_IMPOSED_STATE, "imposedStateMinus" );
+    tree.addVar(             godunovData,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION, "godunovData" );
+    tree.addVar(          fluxSolverPlus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION, "fluxSolverPlus" );
+    tree.addVar(         fluxSolverMinus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION, "fluxSolverMinus" );
+    tree.addVar(         faceInformation,             mask,                 1,      seissol::memory::Standard, "faceInformation" );
+    tree.addVar(          waveSpeedsPlus,             mask,                 1,      MEMKIND_STANDARD, "waveSpeedsPlus" );
+    tree.addVar(         waveSpeedsMinus,             mask,                 1,      MEMKIND_STANDARD, "waveSpeedsMinus" );
+    tree.addVar(          drEnergyOutput,             mask,         ALIGNMENT,      MEMKIND_STANDARD, "drEnergyOutput" );
+    tree.addVar(      impAndEta,                      mask,                 1,      MEMKIND_STANDARD, "impAndEta" );
+    tree.addVar(      initialStressInFaultCS,         mask,                 1,      MEMKIND_STANDARD, "initialStressInFaultCS" );
+    tree.addVar(      nucleationStressInFaultCS,      mask,                 1,      MEMKIND_STANDARD, "nucleationStressInFaultCS" );
+    tree.addVar(      ruptureTime,                    mask,                 1,      MEMKIND_STANDARD, "ruptureTime" );
 
-    tree.addVar(ruptureTimePending, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(dynStressTime, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(dynStressTimePending, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(mu, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(accumulatedSlipMagnitude, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(slip1, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(slip2, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(slipRateMagnitude, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(slipRate1, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(slipRate2, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(peakSlipRate, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(traction1, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(traction2, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(qInterpolatedPlus, mask, ALIGNMENT, MEMKIND_STANDARD);
-    tree.addVar(qInterpolatedMinus, mask, ALIGNMENT, MEMKIND_STANDARD);
+    tree.addVar(ruptureTimePending, mask, 1, MEMKIND_STANDARD, "ruptureTimePending");
+    tree.addVar(dynStressTime, mask, 1, MEMKIND_STANDARD, "dynStressTime");
+    tree.addVar(dynStressTimePending, mask, 1, MEMKIND_STANDARD, "dynStressTimePending");
+    tree.addVar(mu, mask, 1, MEMKIND_STANDARD, "mu");
+    tree.addVar(accumulatedSlipMagnitude, mask, 1, MEMKIND_STANDARD, "accumulatedSlipMagnitude");
+    tree.addVar(slip1, mask, 1, MEMKIND_STANDARD, "slip1");
+    tree.addVar(slip2, mask, 1, MEMKIND_STANDARD, "slip2");
+    tree.addVar(slipRateMagnitude, mask, 1, MEMKIND_STANDARD, "slipRateMagnitude");
+    tree.addVar(slipRate1, mask, 1, MEMKIND_STANDARD, "slipRate1");
+    tree.addVar(slipRate2, mask, 1, MEMKIND_STANDARD, "slipRate2");
+    tree.addVar(peakSlipRate, mask, 1, MEMKIND_STANDARD, "peakSlipRate");
+    tree.addVar(traction1, mask, 1, MEMKIND_STANDARD, "traction1");
+    tree.addVar(traction2, mask, 1, MEMKIND_STANDARD, "traction2");
+    tree.addVar(qInterpolatedPlus, mask, ALIGNMENT, MEMKIND_STANDARD, "qInterpolatedPlus");
+    tree.addVar(qInterpolatedMinus, mask, ALIGNMENT, MEMKIND_STANDARD, "qInterpolatedMinus");
 
 #ifdef ACL_DEVICE
-    tree.addScratchpadMemory(idofsPlusOnDevice,  1, seissol::memory::DeviceGlobalMemory);
-    tree.addScratchpadMemory(idofsMinusOnDevice, 1,  seissol::memory::DeviceGlobalMemory);
+    tree.addScratchpadMemory(idofsPlusOnDevice,  1, seissol::memory::DeviceGlobalMemory, "idofsPlusOnDevice");
+    tree.addScratchpadMemory(idofsMinusOnDevice, 1,  seissol::memory::DeviceGlobalMemory, "idofsMinusOnDevice");
 #endif
   }
 };
@@ -165,11 +165,11 @@ struct seissol::initializers::LTSLinearSlipWeakening : public seissol::initializ
     virtual void addTo(initializers::LTSTree& tree) {
         seissol::initializers::DynamicRupture::addTo(tree);
         LayerMask mask = LayerMask(Ghost);
-        tree.addVar(dC, mask, 1, MEMKIND_STANDARD);
-        tree.addVar(muS, mask, 1, MEMKIND_STANDARD);
-        tree.addVar(muD, mask, 1, MEMKIND_STANDARD);
-        tree.addVar(cohesion, mask,1, MEMKIND_STANDARD);
-        tree.addVar(forcedRuptureTime, mask, 1, MEMKIND_STANDARD);
+        tree.addVar(dC, mask, 1, MEMKIND_STANDARD, "dC");
+        tree.addVar(muS, mask, 1, MEMKIND_STANDARD, "muS");
+        tree.addVar(muD, mask, 1, MEMKIND_STANDARD, "muD");
+        tree.addVar(cohesion, mask,1, MEMKIND_STANDARD, "cohesion");
+        tree.addVar(forcedRuptureTime, mask, 1, MEMKIND_STANDARD, "forcedRuptureTime");
     }
 };
 
@@ -179,7 +179,7 @@ struct seissol::initializers::LTSLinearSlipWeakeningBimaterial : public seissol:
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSLinearSlipWeakening::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(regularisedStrength, mask, 1, MEMKIND_STANDARD);
+    tree.addVar(regularisedStrength, mask, 1, MEMKIND_STANDARD, "regularisedStrength");
   }
 };
 
@@ -191,9 +191,9 @@ struct seissol::initializers::LTSRateAndState : public seissol::initializers::Dy
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::DynamicRupture::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(rsA, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(rsSl0, mask, 1, MEMKIND_STANDARD);
-    tree.addVar(stateVariable, mask, 1, MEMKIND_STANDARD);
+    tree.addVar(rsA, mask, 1, MEMKIND_STANDARD, "rsA");
+    tree.addVar(rsSl0, mask, 1, MEMKIND_STANDARD, "rsSl0");
+    tree.addVar(stateVariable, mask, 1, MEMKIND_STANDARD, "stateVariable");
   }
 };
 
@@ -204,7 +204,7 @@ struct seissol::initializers::LTSRateAndStateFastVelocityWeakening : public seis
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSRateAndState::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(rsSrW, mask, 1, MEMKIND_STANDARD);
+    tree.addVar(rsSrW, mask, 1, MEMKIND_STANDARD, "rsSrW");
   }
 };
 
@@ -212,10 +212,10 @@ struct seissol::initializers::LTSRateAndStateThermalPressurization : public seis
 
   Variable<real[dr::misc::numPaddedPoints]> temperature;
   Variable<real[dr::misc::numPaddedPoints]> pressure;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> theta;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> sigma;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> thetaTmpBuffer;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> sigmaTmpBuffer;
+  Variable<real[seissol::dr::misc::numberOfTPGridPoints][dr::misc::numPaddedPoints]> theta;
+  Variable<real[seissol::dr::misc::numberOfTPGridPoints][dr::misc::numPaddedPoints]> sigma;
+  Variable<real[seissol::dr::misc::numberOfTPGridPoints][dr::misc::numPaddedPoints]> thetaTmpBuffer;
+  Variable<real[seissol::dr::misc::numberOfTPGridPoints][dr::misc::numPaddedPoints]> sigmaTmpBuffer;
   Variable<real[dr::misc::numPaddedPoints]> faultStrength;
   Variable<real[dr::misc::numPaddedPoints]>halfWidthShearZone;
   Variable<real[dr::misc::numPaddedPoints]> hydraulicDiffusivity;
@@ -223,15 +223,15 @@ struct seissol::initializers::LTSRateAndStateThermalPressurization : public seis
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSRateAndStateFastVelocityWeakening::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(temperature, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(pressure, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(theta, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(sigma, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(thetaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(sigmaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(faultStrength, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(halfWidthShearZone, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(hydraulicDiffusivity, mask, ALIGNMENT, seissol::memory::Standard);
+    tree.addVar(temperature, mask, ALIGNMENT, seissol::memory::Standard, "temperature");
+    tree.addVar(pressure, mask, ALIGNMENT, seissol::memory::Standard, "pressure");
+    tree.addVar(theta, mask, ALIGNMENT, seissol::memory::Standard, "theta");
+    tree.addVar(sigma, mask, ALIGNMENT, seissol::memory::Standard, "sigma");
+    tree.addVar(thetaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard, "thetaTmpBuffer");
+    tree.addVar(sigmaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard, "sigmaTmpBuffer");
+    tree.addVar(faultStrength, mask, ALIGNMENT, seissol::memory::Standard, "faultStrength");
+    tree.addVar(halfWidthShearZone, mask, ALIGNMENT, seissol::memory::Standard, "halfWidthShearZone");
+    tree.addVar(hydraulicDiffusivity, mask, ALIGNMENT, seissol::memory::Standard, "hydraulicDiffusivity");
   }
 };
 
@@ -244,10 +244,10 @@ struct seissol::initializers::LTSImposedSlipRates : public seissol::initializers
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::DynamicRupture::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(imposedSlipDirection1, mask, 1, seissol::memory::Standard);
-    tree.addVar(imposedSlipDirection2, mask, 1, seissol::memory::Standard);
-    tree.addVar(slip2, mask, 1, seissol::memory::Standard);
-    tree.addVar(onsetTime, mask, 1, seissol::memory::Standard);
+    tree.addVar(imposedSlipDirection1, mask, 1, seissol::memory::Standard, "imposedSlipDirection1");
+    tree.addVar(imposedSlipDirection2, mask, 1, seissol::memory::Standard, "imposedSlipDirection2");
+    tree.addVar(slip2, mask, 1, seissol::memory::Standard, "slip2");
+    tree.addVar(onsetTime, mask, 1, seissol::memory::Standard, "onsetTime");
   }
 };
 
@@ -259,8 +259,8 @@ struct seissol::initializers::LTSImposedSlipRatesYoffe : public seissol::initial
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSImposedSlipRates::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(tauS, mask, 1, seissol::memory::Standard);
-    tree.addVar(tauR, mask, 1, seissol::memory::Standard);
+    tree.addVar(tauS, mask, 1, seissol::memory::Standard, "tauS");
+    tree.addVar(tauR, mask, 1, seissol::memory::Standard, "tauR");
   }
 };
 
@@ -271,7 +271,7 @@ struct seissol::initializers::LTSImposedSlipRatesGaussian : public seissol::init
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSImposedSlipRates::addTo(tree);
     LayerMask mask = LayerMask(Ghost);
-    tree.addVar(riseTime, mask, 1, seissol::memory::Standard);
+    tree.addVar(riseTime, mask, 1, seissol::memory::Standard, "riseTime");
   }
 };
 
@@ -71,12 +71,209 @@
 #include "MemoryAllocator.h"
 #include <Parallel/MPI.h>
 
+#include <utils/env.h>
 #include <utils/logger.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <linux/mman.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
+namespace {
+using seissol::memory::Memkind;
+
+bool isHostPolicyMemkind(Memkind memkind) {
+  return memkind == seissol::memory::TransparentHugePages || memkind == seissol::memory::HugePages2M ||
+         memkind == seissol::memory::HugePages1G || memkind == seissol::memory::NumaInterleave ||
+         memkind == seissol::memory::NumaPreferred;
+}
+
+std::size_t roundUp(std::size_t value, std::size_t multiple) {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+#ifdef __linux__
+constexpr std::size_t HugePageSize = 2ul * 1024 * 1024;
+constexpr std::size_t GiganticPageSize = 1024ul * 1024 * 1024;
+constexpr unsigned long MaxNumaNodes = 1024;
+constexpr unsigned long BitsPerMaskWord = 8 * sizeof(unsigned long);
+
+//! mmap'ed memory, indexed by the (aligned) pointer returned to the caller
+struct MappedRegion {
+  void* base;
+  std::size_t length;
+};
+std::mutex mappedRegionsMutex;
+std::unordered_map<void*, MappedRegion> mappedRegions;
+
+std::size_t systemPageSize() {
+  static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return pageSize;
+}
+
+void* mapAligned(std::size_t size, std::size_t alignment, std::size_t pageSize, int flags) {
+  const std::size_t padding = alignment > pageSize ? alignment : 0;
+  const std::size_t length = roundUp(size + padding, pageSize);
+  void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  const auto address = reinterpret_cast<std::uintptr_t>(base);
+  void* pointer = reinterpret_cast<void*>(padding > 0 ? roundUp(address, alignment) : address);
+
+  std::lock_guard<std::mutex> lock(mappedRegionsMutex);
+  mappedRegions[pointer] = MappedRegion{base, length};
+  return pointer;
+}
+
+void* allocateWithPolicy(std::size_t size, std::size_t alignment, Memkind memkind) {
+  switch (memkind) {
+  case seissol::memory::TransparentHugePages: {
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, std::max(alignment, HugePageSize), size) != 0) {
+      return nullptr;
+    }
+    // Fails if transparent huge pages are disabled; the memory is still usable
+    if (madvise(pointer, roundUp(size, systemPageSize()), MADV_HUGEPAGE) != 0) {
+      static std::once_flag warned;
+      std::call_once(warned, []() {
+        logWarning() << "madvise(MADV_HUGEPAGE) failed:" << strerror(errno);
+      });
+    }
+    return pointer;
+  }
+  case seissol::memory::HugePages2M:
+  case seissol::memory::HugePages1G: {
+    const bool gigantic = memkind == seissol::memory::HugePages1G;
+    // Smaller allocations would leave most of their huge page unused
+    if (gigantic && size < GiganticPageSize) {
+      return allocateWithPolicy(size, alignment, seissol::memory::HugePages2M);
+    }
+    if (size < HugePageSize) {
+      void* pointer = nullptr;
+      if (posix_memalign(&pointer, std::max(alignment, sizeof(void*)), size) != 0) {
+        return nullptr;
+      }
+      return pointer;
+    }
+    void* pointer = mapAligned(size,
+                               alignment,
+                               gigantic ? GiganticPageSize : HugePageSize,
+                               MAP_HUGETLB | (gigantic ? MAP_HUGE_1GB : MAP_HUGE_2MB));
+    if (pointer == nullptr) {
+      // Not enough huge pages reserved (see /proc/sys/vm/nr_hugepages)
+      static std::once_flag warned;
+      std::call_once(warned, [&]() {
+        logWarning() << "Allocation with explicit huge pages (" << seissol::memory::memkindName(memkind)
+                     << ") failed; falling back to transparent huge pages.";
+      });
+      return allocateWithPolicy(size, alignment, seissol::memory::TransparentHugePages);
+    }
+    return pointer;
+  }
+  case seissol::memory::NumaInterleave:
+  case seissol::memory::NumaPreferred: {
+    void* pointer = mapAligned(size, alignment, systemPageSize(), 0);
+    if (pointer == nullptr) {
+      return nullptr;
+    }
+    std::vector<unsigned long> nodeMask(MaxNumaNodes / BitsPerMaskWord, 0);
+    long result = syscall(SYS_get_mempolicy, nullptr, nodeMask.data(), MaxNumaNodes, nullptr, MPOL_F_MEMS_ALLOWED);
+    if (result == 0 && memkind == seissol::memory::NumaPreferred) {
+      unsigned numberOfNodes = 0;
+      for (const auto word : nodeMask) {
+        numberOfNodes += __builtin_popcountl(word);
+      }
+      unsigned cpu = 0;
+      unsigned node = 0;
+      result = syscall(SYS_getcpu, &cpu, &node, nullptr);
+      if (result == 0 && node < MaxNumaNodes) {
+        if (numberOfNodes > 1) {
+          // The allocating (master) thread decides the node for the threads on all other nodes
+          static std::once_flag warned;
+          std::call_once(warned, [&]() {
+            logWarning() << "The process may use" << numberOfNodes << "NUMA nodes, but preferred places all pages on"
+                         << "node" << node << "of the allocating thread. Use one rank per NUMA domain"
+                         << "or SEISSOL_MEMKIND_*=interleave.";
+          });
+        }
+        std::fill(nodeMask.begin(), nodeMask.end(), 0);
+        nodeMask[node / BitsPerMaskWord] |= 1ul << (node % BitsPerMaskWord);
+      }
+    }
+    if (result == 0) {
+      // If the node is full, the pages spill to other nodes instead of failing with out of memory.
+      // The kernel ignores the last bit of the mask.
+      result = syscall(SYS_mbind,
+                       pointer,
+                       roundUp(size, systemPageSize()),
+                       memkind == seissol::memory::NumaInterleave ? MPOL_INTERLEAVE : MPOL_PREFERRED,
+                       nodeMask.data(),
+                       MaxNumaNodes + 1,
+                       0);
+    }
+    if (result != 0) {
+      static std::once_flag warned;
+      std::call_once(warned, [&]() {
+        logWarning() << "Setting the NUMA policy (" << seissol::memory::memkindName(memkind)
+                     << ") failed:" << strerror(errno);
+      });
+    }
+    return pointer;
+  }
+  default:
+    return nullptr;
+  }
+}
+
+void freeWithPolicy(void* pointer) {
+  {
+    std::lock_guard<std::mutex> lock(mappedRegionsMutex);
+    const auto region = mappedRegions.find(pointer);
+    if (region != mappedRegions.end()) {
+      munmap(region->second.base, region->second.length);
+      mappedRegions.erase(region);
+      return;
+    }
+  }
+  // Transparent huge pages and fallbacks
+  ::free(pointer);
+}
+#else
+void* allocateWithPolicy(std::size_t size, std::size_t alignment, Memkind memkind) {
+  static std::once_flag warned;
+  std::call_once(warned, [&]() {
+    logWarning() << "Memkind" << seissol::memory::memkindName(memkind)
+                 << "is only supported on Linux; using standard memory.";
+  });
+  void* pointer = nullptr;
+  if (posix_memalign(&pointer, std::max(alignment, sizeof(void*)), size) != 0) {
+    return nullptr;
+  }
+  return pointer;
+}
+
+void freeWithPolicy(void* pointer) {
+  ::free(pointer);
+}
+#endif
+} // namespace
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer{nullptr};
@@ -89,6 +286,10 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       return l_ptrBuffer;
     }
 
+  if (isHostPolicyMemkind(i_memkind)) {
+    l_ptrBuffer = allocateWithPolicy(i_size, i_alignment, i_memkind);
+    error = (l_ptrBuffer == nullptr);
+  } else {
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if( i_memkind == 0 ) {
 #endif
@@ -127,6 +328,7 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
     logError() << "unknown memkind type used (" << i_memkind << "). Please, refer to the documentation";
   }
 #endif
+  }
     
     if (error) {
       logError() << "The malloc failed (bytes: " << i_size << ", alignment: " << i_alignment << ", memkind: " << i_memkind << ").";
@@ -136,6 +338,12 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
 }
 
 void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
+  if (isHostPolicyMemkind(i_memkind)) {
+    if (i_pointer != nullptr) {
+      freeWithPolicy(i_pointer);
+    }
+    return;
+  }
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (i_memkind == Standard) {
 #endif
@@ -162,6 +370,96 @@ void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
 #endif
 }
 
+const char* seissol::memory::memkindName(enum Memkind i_memkind) {
+  switch (i_memkind) {
+  case Standard:
+    return "standard";
+  case HighBandwidth:
+    return "high bandwidth";
+  case DeviceGlobalMemory:
+    return "device global";
+  case DeviceUnifiedMemory:
+    return "device unified";
+  case PinnedMemory:
+    return "pinned";
+  case TransparentHugePages:
+    return "thp";
+  case HugePages2M:
+    return "huge2m";
+  case HugePages1G:
+    return "huge1g";
+  case NumaInterleave:
+    return "interleave";
+  case NumaPreferred:
+    return "preferred";
+  default:
+    return "unknown";
+  }
+}
+
+enum seissol::memory::Memkind seissol::memory::hostMemkind(enum Memkind i_memkind, const char* i_envName) {
+  if (i_memkind != Standard) {
+    return i_memkind;
+  }
+
+  const std::string name = utils::Env::get<std::string>(i_envName, "standard");
+  for (const auto memkind : {Standard, TransparentHugePages, HugePages2M, HugePages1G, NumaInterleave, NumaPreferred}) {
+    if (name == memkindName(memkind)) {
+      return memkind;
+    }
+  }
+  if (name == "bind") {
+    logError() << std::string(i_envName) + "=bind is not supported: the pages are only preferred on the NUMA node"
+               << "of the allocating thread, not bound to it. Use" << std::string(i_envName) + "=preferred instead.";
+  }
+  logError() << "Unknown memkind" << name << "in" << i_envName
+             << "(expected standard, thp, huge2m, huge1g, interleave or preferred)";
+  return Standard;
+}
+
+seissol::memory::PageDistribution seissol::memory::numaPageDistribution(const void* i_pointer, size_t i_size, size_t i_maxSamples) {
+  PageDistribution distribution;
+#ifdef __linux__
+  if (i_pointer == nullptr || i_size == 0 || i_maxSamples == 0) {
+    return distribution;
+  }
+
+  const std::size_t pageSize = systemPageSize();
+  const auto first = reinterpret_cast<std::uintptr_t>(i_pointer) / pageSize * pageSize;
+  const std::size_t numberOfPages = (reinterpret_cast<std::uintptr_t>(i_pointer) + i_size - first + pageSize - 1) / pageSize;
+  const std::size_t stride = std::max<std::size_t>(1, (numberOfPages + i_maxSamples - 1) / i_maxSamples);
+
+  std::vector<void*> pages;
+  for (std::size_t page = 0; page < numberOfPages; page += stride) {
+    pages.push_back(reinterpret_cast<void*>(first + page * pageSize));
+  }
+  std::vector<int> status(pages.size(), 0);
+
+  // Without target nodes, move_pages only queries the nodes
+  if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) {
+    return distribution;
+  }
+
+  distribution.sampled = pages.size();
+  for (const int node : status) {
+    if (node >= 0) {
+      if (static_cast<std::size_t>(node) >= distribution.pagesPerNode.size()) {
+        distribution.pagesPerNode.resize(node + 1, 0);
+      }
+      ++distribution.pagesPerNode[node];
+    } else {
+      ++distribution.notPresent;
+    }
+  }
+#endif
+  return distribution;
+}
+
+bool seissol::memory::useMemoryAudit() {
+  static const bool audit = utils::Env::get<int>("SEISSOL_MEMORY_AUDIT", 0) != 0;
+  return audit;
+}
+
 void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned long long> > i_memoryAlignment ) {
   logDebug() << "printing memory alignment per struct";
   for( unsigned long long l_i = 0; l_i < i_memoryAlignment.size(); l_i++ ) {
@@ -75,6 +75,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #ifdef USE_MEMKIND
@@ -88,11 +89,52 @@ namespace seissol {
       HighBandwidth = 1,
       DeviceGlobalMemory = 3,
       DeviceUnifiedMemory = 4,
-      PinnedMemory = 5
+      PinnedMemory = 5,
+      //! host memory with transparent huge pages (madvise)
+      TransparentHugePages = 6,
+      //! host memory with explicit 2 MB huge pages (MAP_HUGETLB) for allocations of at least 2 MB,
+      //! falls back to TransparentHugePages
+      HugePages2M = 7,
+      //! host memory with explicit 1 GB huge pages (MAP_HUGETLB) for allocations of at least 1 GB,
+      //! smaller allocations use HugePages2M
+      HugePages1G = 8,
+      //! host memory interleaved over all NUMA nodes the process may use
+      NumaInterleave = 9,
+      //! host memory preferably placed on the NUMA node of the allocating thread (spills if full)
+      NumaPreferred = 10
     };
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    const char* memkindName(enum Memkind i_memkind);
+
+    /**
+     * Returns the memkind for host data which would use i_memkind otherwise:
+     * Standard is replaced by the memkind selected with the environment variable i_envName
+     * (standard, thp, huge2m, huge1g, interleave or preferred), all other memkinds are kept.
+     **/
+    enum Memkind hostMemkind(enum Memkind i_memkind, const char* i_envName);
+
+    /**
+     * NUMA nodes of the pages of a memory range.
+     **/
+    struct PageDistribution {
+      //! number of sampled pages on each NUMA node
+      std::vector<size_t> pagesPerNode;
+      //! number of sampled pages which are not backed by memory yet
+      size_t notPresent = 0;
+      size_t sampled = 0;
+    };
+
+    /**
+     * Queries the NUMA nodes of (at most i_maxSamples equidistant) pages of a memory range.
+     * Returns an empty distribution if the query is not supported.
+     **/
+    PageDistribution numaPageDistribution(const void* i_pointer, size_t i_size, size_t i_maxSamples = 1024);
+
+    //! Memory audit requested (SEISSOL_MEMORY_AUDIT=1)
+    bool useMemoryAudit();
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
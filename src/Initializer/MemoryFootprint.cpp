@@ -0,0 +1,420 @@
+#include "MemoryFootprint.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include "Initializer/tree/LTSTree.hpp"
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace seissol::initializers {
+
+namespace {
+constexpr std::array<LayerType, 3> Layers = {Ghost, Copy, Interior};
+constexpr std::array<const char*, 3> LayerNames = {"ghost", "copy", "interior"};
+
+double toMiB(std::size_t bytes) { return bytes / (1024.0 * 1024.0); }
+
+FootprintEntry treeEntry(const std::string& group,
+                         const std::string& kind,
+                         const MemoryInfo& info,
+                         std::size_t numberOfClusters) {
+  FootprintEntry entry;
+  entry.group = group;
+  entry.kind = kind;
+  entry.name = info.name;
+  entry.memkind = info.memkind;
+  entry.bytesPerLayer.resize(numberOfClusters, {0, 0, 0});
+  return entry;
+}
+
+void sumLayers(FootprintEntry& entry) {
+  entry.bytes = 0;
+  for (const auto& layerBytes : entry.bytesPerLayer) {
+    entry.bytes += std::accumulate(layerBytes.begin(), layerBytes.end(), std::size_t(0));
+  }
+}
+
+std::string joinKeys(const std::vector<std::string>& keys) {
+  std::string joined;
+  for (const auto& key : keys) {
+    joined += key;
+    joined += '\n';
+  }
+  return joined;
+}
+
+std::vector<std::string> splitKeys(const std::string& joined) {
+  std::vector<std::string> keys;
+  std::istringstream stream(joined);
+  std::string key;
+  while (std::getline(stream, key)) {
+    keys.push_back(key);
+  }
+  return keys;
+}
+
+#ifdef USE_MPI
+//! Replaces the keys on all ranks by the keys of rank 0
+void broadcastKeys(std::vector<std::string>& keys, MPI_Comm comm) {
+  auto joined = joinKeys(keys);
+  unsigned long long size = joined.size();
+  MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, comm);
+  joined.resize(size);
+  MPI_Bcast(joined.data(), static_cast<int>(size), MPI_CHAR, 0, comm);
+  keys = splitKeys(joined);
+}
+
+//! Keys of all ranks on rank 0 (empty on all other ranks)
+std::vector<std::string> gatherKeys(const std::vector<std::string>& keys, MPI_Comm comm) {
+  const auto joined = joinKeys(keys);
+  const int size = static_cast<int>(joined.size());
+  const bool isRoot = seissol::MPI::mpi.rank() == 0;
+  std::vector<int> sizes(isRoot ? seissol::MPI::mpi.size() : 0);
+  MPI_Gather(&size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+  std::vector<int> displacements(sizes.size(), 0);
+  for (std::size_t i = 1; i < sizes.size(); ++i) {
+    displacements[i] = displacements[i - 1] + sizes[i - 1];
+  }
+  std::string gathered(isRoot ? displacements.back() + sizes.back() : 0, '\0');
+  MPI_Gatherv(joined.data(),
+              size,
+              MPI_CHAR,
+              gathered.data(),
+              sizes.data(),
+              displacements.data(),
+              MPI_CHAR,
+              0,
+              comm);
+  return splitKeys(gathered);
+}
+#endif
+} // namespace
+
+std::string footprintKey(const FootprintEntry& entry) {
+  return entry.group + "\t" + entry.kind + "\t" + entry.name;
+}
+
+void mergeFootprintKeys(std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  for (const auto& key : others) {
+    if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+      keys.push_back(key);
+    }
+  }
+}
+
+void MemoryFootprint::remove(const std::string& group,
+                             const std::string& kind,
+                             const std::string& name) {
+  m_entries.erase(std::remove_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const FootprintEntry& entry) {
+                                   return entry.group == group &&
+                                          (kind.empty() || entry.kind == kind) &&
+                                          (name.empty() || entry.name == name);
+                                 }),
+                  m_entries.end());
+}
+
+void MemoryFootprint::setTree(const std::string& group, LTSTree& tree) {
+  remove(group, "", "");
+
+  const auto& varInfo = tree.getVariableInfo();
+  const auto& bucketInfo = tree.getBucketInfo();
+  const auto& scratchpadInfo = tree.getScratchpadInfo();
+  const unsigned numberOfClusters = tree.numChildren();
+
+  for (unsigned var = 0; var < varInfo.size(); ++var) {
+    auto entry = treeEntry(group, "variable", varInfo[var], numberOfClusters);
+    for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+      for (unsigned l = 0; l < Layers.size(); ++l) {
+        const Layer& layer = tree.child(tc).child(Layers[l]);
+        if (!layer.isMasked(varInfo[var].mask)) {
+          entry.bytesPerLayer[tc][l] = layer.getNumberOfCells() * varInfo[var].bytes;
+        }
+      }
+    }
+    sumLayers(entry);
+    m_entries.push_back(entry);
+  }
+
+  for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
+    auto entry = treeEntry(group, "bucket", bucketInfo[bucket], numberOfClusters);
+    for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+      for (unsigned l = 0; l < Layers.size(); ++l) {
+        entry.bytesPerLayer[tc][l] = tree.child(tc).child(Layers[l]).getBucketSize(bucket);
+      }
+    }
+    sumLayers(entry);
+    m_entries.push_back(entry);
+  }
+
+  // Scratchpads are shared by all layers, hence their size is the maximum over the layers
+  std::vector<std::size_t> scratchpadSizes(scratchpadInfo.size(), 0);
+  for (auto it = tree.beginLeaf(); it != tree.endLeaf(); ++it) {
+    it->findMaxScratchpadSizes(scratchpadSizes);
+  }
+  for (unsigned id = 0; id < scratchpadInfo.size(); ++id) {
+    auto entry = treeEntry(group, "scratchpad", scratchpadInfo[id], 0);
+    entry.bytes = scratchpadSizes[id];
+    m_entries.push_back(entry);
+  }
+}
+
+void MemoryFootprint::setBuffer(const std::string& group,
+                                const std::string& name,
+                                std::size_t bytes,
+                                seissol::memory::Memkind memkind) {
+  remove(group, "buffer", name);
+
+  FootprintEntry entry;
+  entry.group = group;
+  entry.kind = "buffer";
+  entry.name = name;
+  entry.memkind = memkind;
+  entry.bytes = bytes;
+  m_entries.push_back(entry);
+}
+
+std::vector<std::string> MemoryFootprint::keys() const {
+  std::vector<std::string> keys;
+  keys.reserve(m_entries.size());
+  for (const auto& entry : m_entries) {
+    keys.push_back(footprintKey(entry));
+  }
+  return keys;
+}
+
+std::vector<unsigned long long>
+    MemoryFootprint::bytesOf(const std::vector<std::string>& keys) const {
+  std::vector<unsigned long long> bytes(keys.size(), 0);
+  for (const auto& entry : m_entries) {
+    const auto key = std::find(keys.begin(), keys.end(), footprintKey(entry));
+    if (key != keys.end()) {
+      bytes[key - keys.begin()] += entry.bytes;
+    }
+  }
+  return bytes;
+}
+
+std::size_t MemoryFootprint::hostBytes() const {
+  std::size_t bytes = 0;
+  for (const auto& entry : m_entries) {
+    if (entry.memkind != seissol::memory::DeviceGlobalMemory) {
+      bytes += entry.bytes;
+    }
+  }
+  return bytes;
+}
+
+std::size_t MemoryFootprint::deviceBytes() const {
+  std::size_t bytes = 0;
+  for (const auto& entry : m_entries) {
+    if (entry.memkind == seissol::memory::DeviceGlobalMemory ||
+        entry.memkind == seissol::memory::DeviceUnifiedMemory) {
+      bytes += entry.bytes;
+    }
+  }
+  return bytes;
+}
+
+std::string MemoryFootprint::breakdown() const {
+  std::vector<const FootprintEntry*> sorted;
+  for (const auto& entry : m_entries) {
+    if (entry.bytes > 0) {
+      sorted.push_back(&entry);
+    }
+  }
+  std::stable_sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+    return a->bytes > b->bytes;
+  });
+
+  std::ostringstream stream;
+  stream.precision(4);
+  std::vector<std::array<std::size_t, 3>> clusterBytes;
+  for (const auto* entry : sorted) {
+    stream << "\n  " << entry->group << " " << entry->kind << " " << entry->name << ": "
+           << toMiB(entry->bytes) << " MiB (" << seissol::memory::memkindName(entry->memkind)
+           << ")";
+    if (entry->bytesPerLayer.size() > clusterBytes.size()) {
+      clusterBytes.resize(entry->bytesPerLayer.size(), {0, 0, 0});
+    }
+    for (std::size_t tc = 0; tc < entry->bytesPerLayer.size(); ++tc) {
+      for (unsigned l = 0; l < Layers.size(); ++l) {
+        clusterBytes[tc][l] += entry->bytesPerLayer[tc][l];
+      }
+    }
+  }
+  for (std::size_t tc = 0; tc < clusterBytes.size(); ++tc) {
+    stream << "\n  cluster " << tc << ":";
+    for (unsigned l = 0; l < Layers.size(); ++l) {
+      stream << " " << LayerNames[l] << " " << toMiB(clusterBytes[tc][l]) << " MiB";
+    }
+  }
+  stream << "\n  total: host " << toMiB(hostBytes()) << " MiB, device " << toMiB(deviceBytes())
+         << " MiB";
+  return stream.str();
+}
+
+void MemoryFootprint::report(const std::string& stage) const {
+  const int rank = seissol::MPI::mpi.rank();
+
+  auto keys = this->keys();
+  unsigned long long hostMin = hostBytes();
+  unsigned long long hostMax = hostMin;
+  unsigned long long hostSum = hostMin;
+#ifdef USE_MPI
+  auto comm = seissol::MPI::mpi.comm();
+  // Usually, all ranks register the same entries; rank 0 only collects the keys it does not know
+  auto allKeys = keys;
+  broadcastKeys(allKeys, comm);
+  std::vector<std::string> unknownKeys;
+  for (const auto& key : keys) {
+    if (std::find(allKeys.begin(), allKeys.end(), key) == allKeys.end()) {
+      unknownKeys.push_back(key);
+    }
+  }
+  mergeFootprintKeys(allKeys, gatherKeys(unknownKeys, comm));
+  broadcastKeys(allKeys, comm);
+  keys = allKeys;
+  auto bytes = bytesOf(keys);
+  MPI_Allreduce(MPI_IN_PLACE, bytes.data(), bytes.size(), MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &hostMin, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &hostMax, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &hostSum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+#else
+  const auto bytes = bytesOf(keys);
+#endif
+
+  logInfo(rank) << "Memory footprint" << stage.c_str() << "(maximum over all ranks):";
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    if (bytes[i] > 0) {
+      auto name = keys[i];
+      std::replace(name.begin(), name.end(), '\t', ' ');
+      logInfo(rank) << " " << name.c_str() << ":" << toMiB(bytes[i]) << "MiB";
+    }
+  }
+  logInfo(rank) << "Host memory per rank: min" << toMiB(hostMin) << "MiB, max" << toMiB(hostMax)
+                << "MiB, average" << toMiB(hostSum / seissol::MPI::mpi.size()) << "MiB";
+  const auto budget = memoryBudget();
+  if (budget > 0) {
+    logInfo(rank) << "Memory budget per rank:" << toMiB(budget) << "MiB";
+  }
+
+  static const std::string prefix = utils::Env::get<std::string>("SEISSOL_MEMORY_REPORT_PREFIX", "");
+  if (!prefix.empty()) {
+    write(prefix + "-" + stage + "-" + std::to_string(rank) + ".csv");
+  }
+}
+
+void MemoryFootprint::write(const std::string& fileName) const {
+  std::ofstream file(fileName);
+  if (!file) {
+    logWarning() << "Could not write the memory footprint to" << fileName.c_str();
+    return;
+  }
+  file << "group,kind,name,memkind,cluster,layer,bytes\n";
+  for (const auto& entry : m_entries) {
+    const auto prefix = entry.group + "," + entry.kind + "," + entry.name + "," +
+                        seissol::memory::memkindName(entry.memkind) + ",";
+    if (entry.bytesPerLayer.empty()) {
+      file << prefix << "all,all," << entry.bytes << "\n";
+    }
+    for (std::size_t tc = 0; tc < entry.bytesPerLayer.size(); ++tc) {
+      for (unsigned l = 0; l < Layers.size(); ++l) {
+        file << prefix << tc << "," << LayerNames[l] << "," << entry.bytesPerLayer[tc][l] << "\n";
+      }
+    }
+  }
+}
+
+void MemoryFootprint::enforceBudget(const std::string& stage) const {
+  const auto budget = memoryBudget();
+  if (budget > 0 && hostBytes() > budget) {
+    logError() << "The memory footprint of rank" << seissol::MPI::mpi.rank() << "(" << stage.c_str()
+               << "," << toMiB(hostBytes()) << "MiB) exceeds the budget of" << toMiB(budget)
+               << "MiB (SEISSOL_MEMORY_BUDGET):" << breakdown().c_str();
+  }
+}
+
+std::size_t parseMemorySize(const std::string& size) {
+  std::size_t pos = 0;
+  double value = 0.0;
+  try {
+    value = std::stod(size, &pos);
+  } catch (const std::exception&) {
+    return 0;
+  }
+  std::string suffix = size.substr(pos);
+  suffix.erase(std::remove_if(suffix.begin(), suffix.end(), ::isspace), suffix.end());
+  std::transform(suffix.begin(), suffix.end(), suffix.begin(), ::toupper);
+  // Accept "G", "GB" and "GIB"
+  if (suffix.size() > 1 && suffix.back() == 'B') {
+    suffix.pop_back();
+    if (suffix.size() > 1 && suffix.back() == 'I') {
+      suffix.pop_back();
+    }
+  }
+
+  double factor = 1.0;
+  if (suffix == "K") {
+    factor = 1024.0;
+  } else if (suffix == "M") {
+    factor = 1024.0 * 1024.0;
+  } else if (suffix == "G") {
+    factor = 1024.0 * 1024.0 * 1024.0;
+  } else if (suffix == "T") {
+    factor = 1024.0 * 1024.0 * 1024.0 * 1024.0;
+  } else if (!suffix.empty() && suffix != "B") {
+    return 0;
+  }
+  if (value <= 0.0) {
+    return 0;
+  }
+  return static_cast<std::size_t>(value * factor);
+}
+
+std::size_t memoryBudget() {
+  static const std::size_t budget = []() {
+    const auto value = utils::Env::get<std::string>("SEISSOL_MEMORY_BUDGET", "");
+    const auto bytes = parseMemorySize(value);
+    if (!value.empty() && bytes == 0) {
+      logWarning() << "Ignoring invalid SEISSOL_MEMORY_BUDGET:" << value.c_str();
+    }
+    return bytes;
+  }();
+  return budget;
+}
+
+bool useMemoryDryRun() {
+  static const bool dryRun = utils::Env::get<int>("SEISSOL_MEMORY_DRY_RUN", 0) != 0;
+  return dryRun;
+}
+
+void reportPeakResidentMemory(const std::string& stage) {
+#ifdef __linux__
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  // ru_maxrss is given in KiB
+  unsigned long long peakMin = static_cast<unsigned long long>(usage.ru_maxrss) * 1024;
+  unsigned long long peakMax = peakMin;
+#ifdef USE_MPI
+  auto comm = seissol::MPI::mpi.comm();
+  MPI_Allreduce(MPI_IN_PLACE, &peakMin, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &peakMax, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+#endif
+  const auto title = "Peak resident memory per rank (" + stage + "): min";
+  logInfo(seissol::MPI::mpi.rank()) << title.c_str() << toMiB(peakMin) << "MiB, max"
+                                    << toMiB(peakMax) << "MiB";
+#endif
+}
+
+} // namespace seissol::initializers
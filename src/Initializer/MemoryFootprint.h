@@ -0,0 +1,122 @@
+#ifndef SEISSOL_MEMORYFOOTPRINT_H
+#define SEISSOL_MEMORYFOOTPRINT_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Initializer/MemoryAllocator.h"
+
+namespace seissol::initializers {
+class LTSTree;
+
+/**
+ * Memory of a single variable, bucket, scratchpad or buffer of this rank.
+ */
+struct FootprintEntry {
+  //! owner of the memory, e.g. "lts", "dynamic rupture" or "output"
+  std::string group;
+  //! "variable", "bucket", "scratchpad" or "buffer"
+  std::string kind;
+  std::string name;
+  seissol::memory::Memkind memkind = seissol::memory::Standard;
+  //! bytes per time cluster and layer (ghost, copy, interior); empty if the memory is shared
+  std::vector<std::array<std::size_t, 3>> bytesPerLayer;
+  std::size_t bytes = 0;
+};
+
+/**
+ * Per-rank memory footprint of the solver.
+ *
+ * The sizes of the variables of a tree are known as soon as the number of cells of its layers is
+ * set, the sizes of the buckets and scratchpads once they are derived. Hence, the footprint can be
+ * computed before anything is allocated and checked against the memory budget of a rank
+ * (SEISSOL_MEMORY_BUDGET).
+ */
+class MemoryFootprint {
+  public:
+  /**
+   * Adds (or replaces) the variables, buckets and scratchpads of a tree.
+   * Buckets and scratchpads are zero until their sizes are derived.
+   */
+  void setTree(const std::string& group, LTSTree& tree);
+
+  //! Adds (or replaces) a buffer which does not belong to a tree
+  void setBuffer(const std::string& group,
+                 const std::string& name,
+                 std::size_t bytes,
+                 seissol::memory::Memkind memkind = seissol::memory::Standard);
+
+  const std::vector<FootprintEntry>& entries() const { return m_entries; }
+
+  //! Keys (see footprintKey) of all entries
+  std::vector<std::string> keys() const;
+
+  /**
+   * Bytes of the entries with the given keys, zero for keys which are not registered.
+   * Ranks may register different buffers (e.g. only ranks with receivers), hence the footprints
+   * of several ranks are compared by key and not by position.
+   */
+  std::vector<unsigned long long> bytesOf(const std::vector<std::string>& keys) const;
+
+  //! Bytes in host memory (including unified memory)
+  std::size_t hostBytes() const;
+
+  //! Bytes in device global memory
+  std::size_t deviceBytes() const;
+
+  /**
+   * Summary of all entries and the ghost/copy/interior totals per time cluster.
+   */
+  std::string breakdown() const;
+
+  /**
+   * Logs the footprint (maximum over all ranks) and writes the per-rank report
+   * (SEISSOL_MEMORY_REPORT_PREFIX). Collective.
+   */
+  void report(const std::string& stage) const;
+
+  //! Writes all entries per time cluster and layer as CSV
+  void write(const std::string& fileName) const;
+
+  //! Aborts if the host footprint exceeds the memory budget of the rank
+  void enforceBudget(const std::string& stage) const;
+
+  private:
+  void remove(const std::string& group, const std::string& kind, const std::string& name);
+
+  std::vector<FootprintEntry> m_entries;
+};
+
+//! Identifies an entry across ranks: group, kind and name, separated by tabs
+std::string footprintKey(const FootprintEntry& entry);
+
+//! Appends the keys of others which are not in keys yet
+void mergeFootprintKeys(std::vector<std::string>& keys, const std::vector<std::string>& others);
+
+/**
+ * Parses a size in bytes with an optional binary suffix (K, M, G, T), e.g. "64G" or "512M".
+ * Returns 0 for an empty or invalid string.
+ */
+std::size_t parseMemorySize(const std::string& size);
+
+//! Per-rank host memory budget in bytes (SEISSOL_MEMORY_BUDGET), 0 if unlimited
+std::size_t memoryBudget();
+
+/**
+ * Dry run (SEISSOL_MEMORY_DRY_RUN=1): the memory layout is derived from the partition, the
+ * footprint is reported and SeisSol stops before the buckets are allocated. Apart from the cell
+ * information and the material, the variables are not touched.
+ */
+bool useMemoryDryRun();
+
+/**
+ * Logs the minimum and maximum peak resident memory (RSS) over all ranks. Collective.
+ * Only available on Linux.
+ */
+void reportPeakResidentMemory(const std::string& stage);
+
+} // namespace seissol::initializers
+
+#endif // SEISSOL_MEMORYFOOTPRINT_H
@@ -83,8 +83,9 @@
 #include <omp.h>
 #endif
 
-#ifdef ACL_DEVICE
 #include "BatchRecorders/Recorders.h"
+
+#ifdef ACL_DEVICE
 #include "device.h"
 #include "DynamicRupture/FrictionLaws/GpuImpl/GpuBaseFrictionLaw.h"
 #endif // ACL_DEVICE
@@ -446,9 +447,6 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
     cluster.child<Interior>().setNumberOfCells(i_meshStructure[tc].numberOfInteriorCells);
   }
 
-  m_ltsTree.allocateVariables();
-  m_ltsTree.touchVariables();
-
   /// Dynamic rupture tree
   m_dynRup->addTo(m_dynRupTree);
 
@@ -467,8 +465,22 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
     }
   }
 
+  // The variables are known from the partition, hence the budget is checked before allocating them
+  // (a dry run reports the complete layout first)
+  m_memoryFootprint.setTree("lts", m_ltsTree);
+  m_memoryFootprint.setTree("dynamic rupture", m_dynRupTree);
+  if (!useMemoryDryRun()) {
+    m_memoryFootprint.enforceBudget("variables");
+  }
+
+  m_ltsTree.allocateVariables();
   m_dynRupTree.allocateVariables();
-  m_dynRupTree.touchVariables();
+
+  // A dry run does not touch the variables (only the cell information and the material are written)
+  if (!useMemoryDryRun()) {
+    m_ltsTree.touchVariables();
+    m_dynRupTree.touchVariables();
+  }
 
 #ifdef ACL_DEVICE
   constexpr size_t idofsSize = tensor::Q::size() * sizeof(real);
@@ -552,6 +564,20 @@ void seissol::initializers::MemoryManager::fixateBoundaryLtsTree() {
   }
 }
 
+void seissol::initializers::MemoryManager::auditMemory() {
+  m_ltsTree.auditMemory("lts");
+  m_dynRupTree.auditMemory("dynamic rupture");
+  m_boundaryTree.auditMemory("boundary");
+}
+
+void seissol::initializers::MemoryManager::reportMemoryFootprint() {
+  m_memoryFootprint.setTree("lts", m_ltsTree);
+  m_memoryFootprint.setTree("dynamic rupture", m_dynRupTree);
+  m_memoryFootprint.setTree("boundary", m_boundaryTree);
+  m_memoryFootprint.enforceBudget("initialization");
+  m_memoryFootprint.report("initialization");
+}
+
 void seissol::initializers::MemoryManager::deriveFaceDisplacementsBucket()
 {
   for (auto layer = m_ltsTree.beginLeaf(m_lts.faceDisplacements.mask); layer != m_ltsTree.endLeaf(); ++layer) {
@@ -581,9 +607,10 @@ void seissol::initializers::MemoryManager::deriveFaceDisplacementsBucket()
   }
 }
 
-#ifdef ACL_DEVICE
 void seissol::initializers::MemoryManager::deriveRequiredScratchpadMemory() {
+#ifdef ACL_DEVICE
   constexpr size_t totalDerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+#endif
 
   for (auto layer = m_ltsTree.beginLeaf(Ghost); layer != m_ltsTree.endLeaf(); ++layer) {
 
@@ -596,11 +623,13 @@ void seissol::initializers::MemoryManager::deriveRequiredScratchpadMemory() {
 
     for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
 
+#ifdef ACL_DEVICE
       bool needsScratchMemForDerivatives = (cellInformation[cell].ltsSetup >> 9) % 2 == 0;
       if (needsScratchMemForDerivatives) {
         ++derivativesCounter;
       }
       ++idofsCounter;
+#endif
 
       // include data provided by ghost layers
       for (unsigned face = 0; face < 4; ++face) {
@@ -626,11 +655,12 @@ void seissol::initializers::MemoryManager::deriveRequiredScratchpadMemory() {
     }
     layer->setScratchpadSize(m_lts.idofsScratch,
                              idofsCounter * tensor::I::size() * sizeof(real));
+#ifdef ACL_DEVICE
     layer->setScratchpadSize(m_lts.derivativesScratch,
                              derivativesCounter * totalDerivativesSize * sizeof(real));
+#endif
   }
 }
-#endif
 
 void seissol::initializers::MemoryManager::initializeFaceDisplacements()
 {
@@ -662,7 +692,7 @@ void seissol::initializers::MemoryManager::initializeFaceDisplacements()
   }
 }
 
-void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFreeSurfaceIntegration)
+bool seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFreeSurfaceIntegration)
 {
   // correct LTS-information in the ghost layer
   correctGhostRegionSetups();
@@ -695,6 +725,16 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
 
   deriveFaceDisplacementsBucket();
 
+  m_memoryFootprint.setTree("lts", m_ltsTree);
+  if (useMemoryDryRun()) {
+    m_memoryFootprint.report("dry-run");
+    m_memoryFootprint.enforceBudget("dry run");
+    reportPeakResidentMemory("dry run");
+    logInfo(seissol::MPI::mpi.rank()) << "Memory dry run finished (SEISSOL_MEMORY_DRY_RUN), stopping.";
+    return false;
+  }
+  m_memoryFootprint.enforceBudget("buckets");
+
   m_ltsTree.allocateBuckets();
 
   // initialize the internal state
@@ -723,7 +763,14 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
 #ifdef ACL_DEVICE
   deriveRequiredScratchpadMemory();
   m_ltsTree.allocateScratchPads();
+#else
+  if (recording::useHostBatchedNeighborIntegration()) {
+    deriveRequiredScratchpadMemory();
+    m_ltsTree.allocateScratchPads();
+  }
 #endif
+
+  return true;
 }
 
 std::pair<MeshStructure *, CompoundGlobalData>
@@ -748,27 +795,32 @@ void seissol::initializers::MemoryManager::initializeEasiBoundaryReader(const ch
 }
 
 
-#ifdef ACL_DEVICE
 void seissol::initializers::MemoryManager::recordExecutionPaths(bool usePlasticity) {
   recording::CompositeRecorder<seissol::initializers::LTS> recorder;
+#ifdef ACL_DEVICE
   recorder.addRecorder(new recording::LocalIntegrationRecorder);
   recorder.addRecorder(new recording::NeighIntegrationRecorder);
 
   if (usePlasticity) {
     recorder.addRecorder(new recording::PlasticityRecorder);
   }
+#else
+  // CPUs only batch the neighbor integration; plasticity stays a per-cell loop
+  recorder.addRecorder(new recording::NeighIntegrationRecorder);
+#endif // ACL_DEVICE
 
   for (LTSTree::leaf_iterator it = m_ltsTree.beginLeaf(Ghost); it != m_ltsTree.endLeaf(); ++it) {
     recorder.record(m_lts, *it);
   }
 
+#ifdef ACL_DEVICE
   recording::CompositeRecorder<seissol::initializers::DynamicRupture> drRecorder;
   drRecorder.addRecorder(new recording::DynamicRuptureRecorder);
   for (LTSTree::leaf_iterator it = m_dynRupTree.beginLeaf(Ghost); it != m_dynRupTree.endLeaf(); ++it) {
     drRecorder.record(*m_dynRup, *it);
   }
-}
 #endif // ACL_DEVICE
+}
 
 bool seissol::initializers::isAcousticSideOfElasticAcousticInterface(CellMaterialData &material,
                                               unsigned int face) {
@@ -79,6 +79,7 @@
 
 #include <Initializer/typedefs.hpp>
 #include "MemoryAllocator.h"
+#include "MemoryFootprint.h"
 
 #include <Initializer/LTS.h>
 #include <Initializer/tree/LTSTree.hpp>
@@ -171,6 +172,8 @@ class seissol::initializers::MemoryManager {
 
     EasiBoundary m_easiBoundary;
 
+    MemoryFootprint m_memoryFootprint;
+
     /**
      * Corrects the LTS Setups (buffer or derivatives, never both) in the ghost region
      **/
@@ -202,12 +205,10 @@ class seissol::initializers::MemoryManager {
      */
     void deriveDisplacementsBucket();
 
-#ifdef ACL_DEVICE
     /**
      * Derives the sizes of scratch memory required during the computations
      */
     void deriveRequiredScratchpadMemory();
-#endif
     
     /**
      * Initializes the displacement accumulation buffer.
@@ -262,12 +263,23 @@ class seissol::initializers::MemoryManager {
                        bool usePlasticity);
 
     void fixateBoundaryLtsTree();
+
+    /**
+     * Reports the NUMA nodes of the pages of all tree variables and buckets.
+     **/
+    void auditMemory();
+
+    /**
+     * Updates the footprint of all trees, enforces the memory budget, and logs the footprint.
+     **/
+    void reportMemoryFootprint();
     /**
      * Set up the internal structure.
      *
      * @param enableFreeSurfaceIntegration Create buffers to accumulate displacement.
+     * @return false if a memory dry run (SEISSOL_MEMORY_DRY_RUN) stopped before the buckets were allocated.
      **/
-    void initializeMemoryLayout(bool enableFreeSurfaceIntegration);
+    bool initializeMemoryLayout(bool enableFreeSurfaceIntegration);
 
     /**
      * Gets global data on the host.
@@ -324,6 +336,10 @@ class seissol::initializers::MemoryManager {
       return m_dynRup.get();
     }
 
+    inline MemoryFootprint& getMemoryFootprint() {
+      return m_memoryFootprint;
+    }
+
     inline LTSTree* getBoundaryTree() {
       return &m_boundaryTree;
     }
@@ -356,9 +372,10 @@ class seissol::initializers::MemoryManager {
       m_dynRupParameters = dr::readParametersFromYaml(m_inputParams);
     }
 
-#ifdef ACL_DEVICE
+  /**
+   * Records the batch tables of all layers (GPUs, and CPUs with batched neighbor integration).
+   */
   void recordExecutionPaths(bool usePlasticity);
-#endif
 
   void initializeFrictionLaw();
   void initFaultOutputManager();
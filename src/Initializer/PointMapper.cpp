@@ -73,6 +73,7 @@
 #include <Initializer/MemoryAllocator.h>
 #include <utils/logger.h>
 #include <Parallel/MPI.h>
+#include <Geometry/PointLocator.h>
 
 void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
                                         MeshReader const& mesh,
@@ -93,6 +94,35 @@ void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
                                         unsigned numPoints,
                                         short* contained,
                                         unsigned* meshIds) {
+  const geometry::PointLocator locator(vertices, elements);
+  findMeshIds(points, locator, numPoints, contained, meshIds);
+}
+
+void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
+                                        geometry::PointLocator const& locator,
+                                        unsigned numPoints,
+                                        short* contained,
+                                        unsigned* meshIds) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+  for (unsigned point = 0; point < numPoints; ++point) {
+    const int localId = locator.findElement(points[point]);
+    if (localId >= 0) {
+      contained[point] = 1;
+      meshIds[point] = static_cast<unsigned>(localId);
+    } else {
+      contained[point] = 0;
+    }
+  }
+}
+
+void seissol::initializers::findMeshIdsBruteForce(Eigen::Vector3d const* points,
+                                                  std::vector<Vertex> const& vertices,
+                                                  std::vector<Element> const& elements,
+                                                  unsigned numPoints,
+                                                  short* contained,
+                                                  unsigned* meshIds) {
 
   memset(contained, 0, numPoints * sizeof(short));
 
@@ -41,6 +41,7 @@
 #define INITIALIZER_POINTMAPPER_H_
 
 #include <Geometry/MeshReader.h>
+#include <Geometry/PointLocator.h>
 #include <Eigen/Dense>
 
 namespace seissol {
@@ -61,6 +62,25 @@ namespace seissol {
                      unsigned numPoints,
                      short* contained,
                      unsigned* meshIds);
+
+    /** Same as above, but reuses an existing point locator.
+     *  Use this variant if points are located in the same mesh several times.
+     */
+    void findMeshIds(Eigen::Vector3d const* points,
+                     geometry::PointLocator const& locator,
+                     unsigned numPoints,
+                     short* contained,
+                     unsigned* meshIds);
+
+    /** Reference implementation which tests every point against every element.
+     *  It is kept for testing and benchmarking the point locator.
+     */
+    void findMeshIdsBruteForce(Eigen::Vector3d const* points,
+                               std::vector<Vertex> const& vertices,
+                               std::vector<Element> const& elements,
+                               unsigned numPoints,
+                               short* contained,
+                               unsigned* meshIds);
   #ifdef USE_MPI
     void cleanDoubles(short* contained, unsigned numPoints);
 #endif
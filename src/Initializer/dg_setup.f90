@@ -442,10 +442,13 @@ CONTAINS
   call c_interoperability_synchronizeCellLocalData(logical(EQN%Plasticity == 1, 1))
 #endif
 
-    call c_interoperability_initializeMemoryLayout(&
+    IO%MemoryDryRun = .not. c_interoperability_initializeMemoryLayout(&
             clustering = disc%galerkin%clusteredLts, &
             enableFreeSurfaceIntegration = enableFreeSurfaceIntegration, &
             usePlasticity = logical(EQN%Plasticity == 1, 1))
+    if (IO%MemoryDryRun) then
+      return
+    endif
 
     call c_interoperability_initFaultOutputManager()
 
@@ -290,6 +290,9 @@ CONTAINS
          MPI    = MPI                                , &              !
          IO     = IO                                   )              !
     !                                                                       !
+    IF (IO%MemoryDryRun) THEN                                               !
+      RETURN                                                                ! Memory dry run, no initial conditions
+    ENDIF                                                                   !
     logInfo(*) 'Galerkin module initialized correctly.'    !
     !
     !aheineck: Metisweighs are not used, @TODO we should delete this
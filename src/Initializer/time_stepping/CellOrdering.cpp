@@ -0,0 +1,228 @@
+#include "CellOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "utils/logger.h"
+
+namespace seissol::initializers::time_stepping {
+
+CellOrdering parseCellOrdering(const std::string& name) {
+  if (name == "meshid") {
+    return CellOrdering::MeshId;
+  }
+  if (name == "morton") {
+    return CellOrdering::Morton;
+  }
+  if (name == "hilbert") {
+    return CellOrdering::Hilbert;
+  }
+  logError() << "Unknown cell ordering" << name << "(expected meshid, morton or hilbert)";
+  return CellOrdering::MeshId;
+}
+
+namespace {
+//! Spreads the lower 21 bits such that two zero bits are between each bit
+std::uint64_t spreadBits(std::uint32_t value) {
+  std::uint64_t x = value & 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x << 8) & 0x100f00f00f00f00fULL;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+  x = (x | x << 2) & 0x1249249249249249ULL;
+  return x;
+}
+} // namespace
+
+std::uint64_t mortonKey(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+  return spreadBits(x) << 2 | spreadBits(y) << 1 | spreadBits(z);
+}
+
+std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+  // J. Skilling, Programming the Hilbert curve, AIP Conference Proceedings 707 (2004)
+  std::uint32_t axes[3] = {x, y, z};
+  const std::uint32_t highestBit = 1u << (CurveBits - 1);
+
+  // Inverse undo excess work
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (auto& axis : axes) {
+      if (axis & q) {
+        axes[0] ^= p;
+      } else {
+        const std::uint32_t t = (axes[0] ^ axis) & p;
+        axes[0] ^= t;
+        axis ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  axes[1] ^= axes[0];
+  axes[2] ^= axes[1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    if (axes[2] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (auto& axis : axes) {
+    axis ^= t;
+  }
+
+  // The transposed index is the Morton key of the transformed axes
+  return mortonKey(axes[0], axes[1], axes[2]);
+}
+
+void sortCells(std::vector<unsigned>& cells,
+               const std::vector<std::array<double, 3>>& barycenters,
+               CellOrdering ordering) {
+  if (ordering == CellOrdering::MeshId || cells.empty()) {
+    return;
+  }
+
+  std::array<double, 3> min;
+  std::array<double, 3> max;
+  min.fill(std::numeric_limits<double>::max());
+  max.fill(std::numeric_limits<double>::lowest());
+  for (const auto cell : cells) {
+    for (unsigned d = 0; d < 3; ++d) {
+      min[d] = std::min(min[d], barycenters[cell][d]);
+      max[d] = std::max(max[d], barycenters[cell][d]);
+    }
+  }
+  // Same scaling in all directions to keep the curve isotropic
+  double extent = 0.0;
+  for (unsigned d = 0; d < 3; ++d) {
+    extent = std::max(extent, max[d] - min[d]);
+  }
+  const double maxCoordinate = static_cast<double>((1u << CurveBits) - 1);
+  const double scale = extent > 0.0 ? maxCoordinate / extent : 0.0;
+
+  std::vector<std::pair<std::uint64_t, unsigned>> keys(cells.size());
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    std::uint32_t coordinates[3];
+    for (unsigned d = 0; d < 3; ++d) {
+      coordinates[d] = static_cast<std::uint32_t>(
+          std::min(maxCoordinate, std::floor((barycenters[cells[i]][d] - min[d]) * scale)));
+    }
+    const auto key = ordering == CellOrdering::Hilbert
+                         ? hilbertKey(coordinates[0], coordinates[1], coordinates[2])
+                         : mortonKey(coordinates[0], coordinates[1], coordinates[2]);
+    keys[i] = {key, cells[i]};
+  }
+
+  // Ties are resolved by the mesh id, such that the order is deterministic
+  std::sort(keys.begin(), keys.end());
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    cells[i] = keys[i].second;
+  }
+}
+
+LocalityStatistics& LocalityStatistics::operator+=(const LocalityStatistics& other) {
+  neighborDistance += other.neighborDistance;
+  neighborAccesses += other.neighborAccesses;
+  l2Misses += other.l2Misses;
+  l3Misses += other.l3Misses;
+  return *this;
+}
+
+namespace {
+/**
+ * Fully associative LRU cache of cell positions (doubly linked list over all positions)
+ */
+class LruCache {
+  public:
+  LruCache(std::size_t numberOfCells, std::size_t capacity)
+      : capacity(std::max<std::size_t>(capacity, 1)), previous(numberOfCells, Invalid),
+        next(numberOfCells, Invalid), cached(numberOfCells, false) {}
+
+  //! @return True on a miss
+  bool access(unsigned cell) {
+    if (cached[cell]) {
+      unlink(cell);
+      pushFront(cell);
+      return false;
+    }
+    if (size == capacity) {
+      const unsigned evicted = tail;
+      unlink(evicted);
+      cached[evicted] = false;
+      --size;
+    }
+    pushFront(cell);
+    cached[cell] = true;
+    ++size;
+    return true;
+  }
+
+  private:
+  static constexpr unsigned Invalid = std::numeric_limits<unsigned>::max();
+
+  void unlink(unsigned cell) {
+    if (previous[cell] != Invalid) {
+      next[previous[cell]] = next[cell];
+    } else {
+      head = next[cell];
+    }
+    if (next[cell] != Invalid) {
+      previous[next[cell]] = previous[cell];
+    } else {
+      tail = previous[cell];
+    }
+  }
+
+  void pushFront(unsigned cell) {
+    previous[cell] = Invalid;
+    next[cell] = head;
+    if (head != Invalid) {
+      previous[head] = cell;
+    }
+    head = cell;
+    if (tail == Invalid) {
+      tail = cell;
+    }
+  }
+
+  std::size_t capacity;
+  std::size_t size = 0;
+  unsigned head = Invalid;
+  unsigned tail = Invalid;
+  std::vector<unsigned> previous;
+  std::vector<unsigned> next;
+  std::vector<bool> cached;
+};
+} // namespace
+
+LocalityStatistics analyzeLocality(const std::vector<std::array<unsigned, 4>>& neighbors,
+                                   std::size_t l2Cells,
+                                   std::size_t l3Cells) {
+  LocalityStatistics statistics;
+  LruCache l2(neighbors.size(), l2Cells);
+  LruCache l3(neighbors.size(), l3Cells);
+
+  auto access = [&](unsigned cell) {
+    if (l2.access(cell)) {
+      ++statistics.l2Misses;
+    }
+    if (l3.access(cell)) {
+      ++statistics.l3Misses;
+    }
+  };
+
+  for (unsigned cell = 0; cell < neighbors.size(); ++cell) {
+    access(cell);
+    for (const auto neighbor : neighbors[cell]) {
+      if (neighbor < neighbors.size()) {
+        statistics.neighborDistance +=
+            std::abs(static_cast<double>(neighbor) - static_cast<double>(cell));
+        ++statistics.neighborAccesses;
+        access(neighbor);
+      }
+    }
+  }
+  return statistics;
+}
+
+} // namespace seissol::initializers::time_stepping
@@ -0,0 +1,85 @@
+#ifndef SEISSOL_CELLORDERING_H
+#define SEISSOL_CELLORDERING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace seissol::initializers::time_stepping {
+
+/**
+ * Order of the cells inside a layer
+ */
+enum class CellOrdering {
+  //! Sorted by mesh id
+  MeshId,
+  //! Sorted along a Morton (Z-order) curve through the barycenters
+  Morton,
+  //! Sorted along a Hilbert curve through the barycenters
+  Hilbert
+};
+
+CellOrdering parseCellOrdering(const std::string& name);
+
+//! Number of bits per coordinate of the space-filling curves
+constexpr unsigned CurveBits = 21;
+
+/**
+ * Interleaves the bits of the (quantized) coordinates.
+ */
+std::uint64_t mortonKey(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+/**
+ * Position on the Hilbert curve of the (quantized) coordinates (Skilling's algorithm).
+ */
+std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+/**
+ * Sorts the cells along the space-filling curve of their barycenters
+ * (the bounding box of the cells is mapped to the curve). Does nothing for CellOrdering::MeshId.
+ *
+ * @param cells Mesh ids of the cells
+ * @param barycenters Barycenters of all cells, indexed by mesh id
+ */
+void sortCells(std::vector<unsigned>& cells,
+               const std::vector<std::array<double, 3>>& barycenters,
+               CellOrdering ordering);
+
+/**
+ * Memory locality of the neighbor accesses in the order of a layer
+ */
+struct LocalityStatistics {
+  //! Sum of the distances between the positions of a cell and its face neighbors (in cells)
+  double neighborDistance = 0.0;
+  //! Number of neighbor accesses
+  unsigned long neighborAccesses = 0;
+  //! Misses of the modeled L2 and L3 cache
+  unsigned long l2Misses = 0;
+  unsigned long l3Misses = 0;
+
+  LocalityStatistics& operator+=(const LocalityStatistics& other);
+
+  [[nodiscard]] double averageNeighborDistance() const {
+    return neighborAccesses > 0 ? neighborDistance / neighborAccesses : 0.0;
+  }
+};
+
+/**
+ * Models the neighbor accesses of the neighbor integration: the cells are visited in the
+ * given order and each visit reads the data of the cell and its face neighbors. The caches are
+ * modeled as fully associative LRU caches holding a number of cells.
+ *
+ * @param neighbors Positions of the face neighbors in the layer (invalid if not in the layer)
+ * @param l2Cells Capacity of the L2 cache in cells
+ * @param l3Cells Capacity of the L3 cache in cells
+ */
+LocalityStatistics analyzeLocality(const std::vector<std::array<unsigned, 4>>& neighbors,
+                                   std::size_t l2Cells,
+                                   std::size_t l3Cells);
+
+} // namespace seissol::initializers::time_stepping
+
+#endif // SEISSOL_CELLORDERING_H
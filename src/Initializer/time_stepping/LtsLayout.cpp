@@ -43,12 +43,19 @@
 #include "Parallel/MPI.h"
 
 #include "utils/logger.h"
+#include "utils/env.h"
 
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
 #include <iterator>
+#include <unistd.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 seissol::initializers::time_stepping::LtsLayout::LtsLayout():
+ m_selectedClusterRate(      MultiRate::AutomaticRate ),
+ m_cellOrdering(             CellOrdering::MeshId ),
  m_cellTimeStepWidths(       NULL ),
  m_cellClusterIds(           NULL ),
  m_globalTimeStepWidths(     NULL ),
@@ -78,6 +85,18 @@ void seissol::initializers::time_stepping::LtsLayout::setMesh( const MeshReader
   m_cells = i_mesh.getElements();
   m_fault = i_mesh.getFault();
 
+  // barycenters of the cells for space-filling curve orderings
+  const std::vector<Vertex>& l_vertices = i_mesh.getVertices();
+  m_barycenters.resize( m_cells.size() );
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    m_barycenters[l_cell].fill( 0.0 );
+    for( unsigned int l_vertex = 0; l_vertex < 4; l_vertex++ ) {
+      for( unsigned int l_dim = 0; l_dim < 3; l_dim++ ) {
+        m_barycenters[l_cell][l_dim] += 0.25 * l_vertices[ m_cells[l_cell].vertices[l_vertex] ].coords[l_dim];
+      }
+    }
+  }
+
   m_cellTimeStepWidths = new double[       m_cells.size() ];
   m_cellClusterIds     = new unsigned int[ m_cells.size() ];
 
@@ -584,11 +603,12 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceSingleBuffe
 }
 
 void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
-  const int rank = seissol::MPI::mpi.rank();
-  // allocate memory for the cluster ids of the ghost layer
-  m_plainGhostCellClusterIds = new unsigned int*[ m_plainNeighboringRanks.size() ];
-  for( unsigned int l_neighbor = 0; l_neighbor < m_plainNeighboringRanks.size(); l_neighbor++ ) {
-    m_plainGhostCellClusterIds[l_neighbor] = new unsigned int[ m_numberOfPlainGhostCells[l_neighbor] ];
+  // allocate memory for the cluster ids of the ghost layer (reused if the clustering is derived again)
+  if( m_plainGhostCellClusterIds == NULL ) {
+    m_plainGhostCellClusterIds = new unsigned int*[ m_plainNeighboringRanks.size() ];
+    for( unsigned int l_neighbor = 0; l_neighbor < m_plainNeighboringRanks.size(); l_neighbor++ ) {
+      m_plainGhostCellClusterIds[l_neighbor] = new unsigned int[ m_numberOfPlainGhostCells[l_neighbor] ];
+    }
   }
 
   // enforce requirements until mesh is valid
@@ -636,7 +656,10 @@ void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
   }
 
   //logInfo() << "Performed a total of" << l_totalMaximumDifference << "reductions (max. diff.) for" << m_cells.size() << "cells," << l_totalDynamicRupture << "reductions (dyn. rup.) for" << m_fault.size() << "faces.";
-  
+}
+
+void seissol::initializers::time_stepping::LtsLayout::logClusterHistogram() {
+  const int rank = seissol::MPI::mpi.rank();
   int* localClusterHistogram = new int[m_numberOfGlobalClusters];
   for (unsigned cluster = 0; cluster < m_numberOfGlobalClusters; ++cluster) {
     localClusterHistogram[cluster] = 0;
@@ -895,6 +918,9 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredCopyInterio
     }
   }
 
+  // order the interior along the space-filling curve; copy cells keep their sorted order per region
+  reorderClusteredInterior();
+
   /*
    * Sort GTS regions: DR and "GTS on der" comes first.
    */
@@ -953,6 +979,85 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredCopyInterio
   }
 }
 
+void seissol::initializers::time_stepping::LtsLayout::reorderClusteredInterior() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  // cache capacities in cells (the L3 cache is shared by the threads)
+  const std::size_t l_cellSize = tensor::Q::size() * sizeof(real);
+  long l_l2Size = sysconf( _SC_LEVEL2_CACHE_SIZE );
+  long l_l3Size = sysconf( _SC_LEVEL3_CACHE_SIZE );
+  if( l_l2Size <= 0 ) l_l2Size = 1l << 20;
+  if( l_l3Size <= 0 ) l_l3Size = 32l << 20;
+#ifdef _OPENMP
+  l_l3Size /= omp_get_max_threads();
+#endif
+  const std::size_t l_l2Cells = l_l2Size / l_cellSize;
+  const std::size_t l_l3Cells = l_l3Size / l_cellSize;
+
+  m_interiorPositions.assign( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+
+  // positions of the face neighbors in the interior of the same cluster
+  auto l_neighborPositions = [&]( const std::vector< clusterCell > &i_interior ) {
+    std::vector< std::array<unsigned int, 4> > l_neighbors( i_interior.size() );
+    for( unsigned int l_cell = 0; l_cell < i_interior.size(); l_cell++ ) {
+      const Element &l_element = m_cells[ i_interior[l_cell] ];
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        l_neighbors[l_cell][l_face] = std::numeric_limits<unsigned int>::max();
+        const unsigned int l_neighbor = l_element.neighbors[l_face];
+        if( l_element.neighborRanks[l_face] == rank && l_neighbor < m_cells.size() &&
+            m_cellClusterIds[l_neighbor] == m_cellClusterIds[ i_interior[l_cell] ] ) {
+          l_neighbors[l_cell][l_face] = m_interiorPositions[l_neighbor];
+        }
+      }
+    }
+    return l_neighbors;
+  };
+
+  auto l_updatePositions = [&]( const std::vector< clusterCell > &i_interior ) {
+    for( unsigned int l_cell = 0; l_cell < i_interior.size(); l_cell++ ) {
+      m_interiorPositions[ i_interior[l_cell] ] = l_cell;
+    }
+  };
+
+  LocalityStatistics l_before;
+  LocalityStatistics l_after;
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    l_updatePositions( m_clusteredInterior[l_cluster] );
+    if( m_cellOrdering == CellOrdering::MeshId ) continue;
+
+    l_before += analyzeLocality( l_neighborPositions( m_clusteredInterior[l_cluster] ), l_l2Cells, l_l3Cells );
+    sortCells( m_clusteredInterior[l_cluster], m_barycenters, m_cellOrdering );
+    l_updatePositions( m_clusteredInterior[l_cluster] );
+    l_after  += analyzeLocality( l_neighborPositions( m_clusteredInterior[l_cluster] ), l_l2Cells, l_l3Cells );
+  }
+
+  if( m_cellOrdering == CellOrdering::MeshId ) return;
+
+#ifdef USE_MPI
+  double l_distances[2] = { l_before.neighborDistance, l_after.neighborDistance };
+  unsigned long l_counts[5] = { l_before.neighborAccesses, l_before.l2Misses, l_before.l3Misses, l_after.l2Misses, l_after.l3Misses };
+  if( rank == 0 ) {
+    MPI_Reduce( MPI_IN_PLACE, l_distances, 2, MPI_DOUBLE,        MPI_SUM, 0, seissol::MPI::mpi.comm() );
+    MPI_Reduce( MPI_IN_PLACE, l_counts,    5, MPI_UNSIGNED_LONG, MPI_SUM, 0, seissol::MPI::mpi.comm() );
+  } else {
+    MPI_Reduce( l_distances, 0L, 2, MPI_DOUBLE,        MPI_SUM, 0, seissol::MPI::mpi.comm() );
+    MPI_Reduce( l_counts,    0L, 5, MPI_UNSIGNED_LONG, MPI_SUM, 0, seissol::MPI::mpi.comm() );
+  }
+  l_before.neighborDistance = l_distances[0];
+  l_after.neighborDistance  = l_distances[1];
+  l_before.neighborAccesses = l_after.neighborAccesses = l_counts[0];
+  l_before.l2Misses = l_counts[1]; l_before.l3Misses = l_counts[2];
+  l_after.l2Misses  = l_counts[3]; l_after.l3Misses  = l_counts[4];
+#endif
+
+  logInfo(rank) << "Interior cell ordering:" << (m_cellOrdering == CellOrdering::Hilbert ? "Hilbert" : "Morton")
+                << "curve; average neighbor distance" << l_before.averageNeighborDistance()
+                << "->" << l_after.averageNeighborDistance() << "cells.";
+  logInfo(rank) << "Modeled neighbor integration misses (L2:" << l_l2Cells << "cells, L3:" << l_l3Cells << "cells per thread):"
+                << "L2" << l_before.l2Misses << "->" << l_after.l2Misses
+                << ", L3" << l_before.l3Misses << "->" << l_after.l3Misses;
+}
+
 void seissol::initializers::time_stepping::LtsLayout::deriveClusteredGhost() {
   /*
    * Get sizes of the ghost regions
@@ -1149,31 +1254,59 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredGhost() {
 #endif // USE_MPI
 }
 
+void seissol::initializers::time_stepping::LtsLayout::setSelectedClusterRate( unsigned int i_clusterRate ) {
+  m_selectedClusterRate = i_clusterRate;
+}
+
+void seissol::initializers::time_stepping::LtsLayout::deriveClustering( unsigned int i_clusterRate ) {
+  // free the global clusters of a previous clustering
+  delete[] m_globalTimeStepWidths;
+  delete[] m_globalTimeStepRates;
+
+  // derive time stepping clusters and per-cell cluster ids (w/o normalizations)
+  MultiRate::deriveClusterIds( m_cells.size(),
+                               i_clusterRate,
+                               m_cellTimeStepWidths,
+                               m_cellClusterIds,
+                               m_numberOfGlobalClusters,
+                               m_globalTimeStepWidths,
+                               m_globalTimeStepRates );
+
+  // normalize clustering
+  normalizeClustering();
+}
+
+unsigned int seissol::initializers::time_stepping::LtsLayout::selectClusterRate() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  unsigned int l_bestRate = 2;
+  double l_bestCost = std::numeric_limits<double>::max();
+  for( unsigned int l_rate = 2; l_rate <= MultiRate::MaximumAutomaticRate; l_rate++ ) {
+    deriveClustering( l_rate );
+
+    double l_perCellSpeedup, l_clusteringSpeedup;
+    getTheoreticalSpeedup( l_perCellSpeedup, l_clusteringSpeedup );
+    logInfo(rank) << "theoretical speedup with rate" << l_rate << ":" << l_clusteringSpeedup;
+
+    // same criterion as the LTS weights
+    const double l_cost = MultiRate::deriveClusteringCost( l_rate, m_cells.size(), m_cellClusterIds );
+    if( MultiRate::isCheaperClustering( l_cost, l_bestCost ) ) {
+      l_bestCost = l_cost;
+      l_bestRate = l_rate;
+    }
+  }
+
+  logInfo(rank) << "Selected the multi-rate LTS rate" << l_bestRate;
+  return l_bestRate;
+}
+
 void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClustering i_timeClustering,
                                                                     unsigned int        i_clusterRate ) {
 	const int rank = seissol::MPI::mpi.rank();
 
   m_clusteringStrategy = i_timeClustering;
 
-  // derive time stepping clusters and per-cell cluster ids (w/o normalizations)
-  if( m_clusteringStrategy == single ) {
-    MultiRate::deriveClusterIds( m_cells.size(),
-                                 std::numeric_limits<unsigned int>::max(),
-                                 m_cellTimeStepWidths,
-                                 m_cellClusterIds,
-                                 m_numberOfGlobalClusters,
-                                 m_globalTimeStepWidths,
-                                 m_globalTimeStepRates  );
-  }
-  else if ( m_clusteringStrategy == multiRate ) {
-    MultiRate::deriveClusterIds( m_cells.size(),
-                                 i_clusterRate,
-                                 m_cellTimeStepWidths,
-                                 m_cellClusterIds,
-                                 m_numberOfGlobalClusters,
-                                 m_globalTimeStepWidths,
-                                 m_globalTimeStepRates );
-  }
+  m_cellOrdering = parseCellOrdering( utils::Env::get<const char*>( "SEISSOL_CELL_ORDERING", "meshid" ) );
 
   // derive plain copy and the interior
   derivePlainCopyInterior();
@@ -1184,8 +1317,24 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
   // normalize mpi indices
   normalizeMpiIndices();
 
-  // normalize clustering
-  normalizeClustering();
+  // derive time stepping clusters and per-cell cluster ids; the plain layout does not depend on them
+  if( m_clusteringStrategy == single ) {
+    deriveClustering( std::numeric_limits<unsigned int>::max() );
+  }
+  else if ( m_clusteringStrategy == multiRate ) {
+    if( i_clusterRate == MultiRate::AutomaticRate ) {
+      if( m_selectedClusterRate != MultiRate::AutomaticRate ) {
+        // the mesh was partitioned with this rate
+        i_clusterRate = m_selectedClusterRate;
+        logInfo(rank) << "Using the multi-rate LTS rate" << i_clusterRate << "of the LTS weights";
+      } else {
+        i_clusterRate = selectClusterRate();
+      }
+    }
+    deriveClustering( i_clusterRate );
+  }
+
+  logClusterHistogram();
 
   // get maximum speedups compared to GTS
   double l_perCellSpeedup, l_clusteringSpeedup;
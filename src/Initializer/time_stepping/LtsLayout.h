@@ -46,6 +46,7 @@
 
 #include <Geometry/MeshDefinition.h>
 #include <Geometry/MeshReader.h>
+#include "CellOrdering.h"
 
 #include <array>
 #include <limits>
@@ -67,12 +68,21 @@ class seissol::initializers::time_stepping::LtsLayout {
     //! used clustering strategy
     enum TimeClustering m_clusteringStrategy;
 
+    //! rate selected by the LTS weights (MultiRate::AutomaticRate if none)
+    unsigned int m_selectedClusterRate;
+
     //! cells in the local domain
     std::vector<Element> m_cells;
 
     //! fault in the local domain
     std::vector<Fault> m_fault;
 
+    //! barycenters of the cells
+    std::vector< std::array<double, 3> > m_barycenters;
+
+    //! order of the interior cells
+    CellOrdering m_cellOrdering;
+
     //! time step widths of the cells (cfl)
     double       *m_cellTimeStepWidths;
 
@@ -159,6 +169,11 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * position of interior cells in their interior cluster (indexed by mesh id, invalid for non-interior cells)
+     **/
+    std::vector< unsigned int > m_interiorPositions;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -298,6 +313,26 @@ class seissol::initializers::time_stepping::LtsLayout {
     void getTheoreticalSpeedup( double &o_perCellTimeStepWidths,
                                 double &o_clustering );
 
+    /**
+     * Derives the per-cell cluster ids for the given rate and normalizes them.
+     *
+     * @param i_clusterRate cluster rate in the case of a multi-rate scheme.
+     **/
+    void deriveClustering( unsigned int i_clusterRate );
+
+    /**
+     * Selects the rate of the multi-rate scheme with the fewest cell updates of the normalized clustering
+     * (MultiRate::deriveClusteringCost).
+     *
+     * @return selected rate.
+     **/
+    unsigned int selectClusterRate();
+
+    /**
+     * Prints the number of cells per cluster.
+     **/
+    void logClusterHistogram();
+
     /**
      * Sorts a clustered copy region neighboring to a copy region in GTS fashion.
      * Copy cells send either buffers or derivatives to neighboring cells, never both.
@@ -339,6 +374,12 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     void deriveClusteredCopyInterior();
 
+    /**
+     * Orders the cells of the clustered interior along the selected space-filling curve
+     * and reports the locality of the neighbor accesses before and after.
+     **/
+    void reorderClusteredInterior();
+
     /**
      * Derives the clustered ghost region (cell ids in then neighboring domain).
      **/
@@ -444,14 +485,11 @@ class seissol::initializers::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
-      std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
-                                                                               m_clusteredInterior[o_localClusterId].end(),   // end of the search
-                                                                               i_meshId );                                    // value to search for
-      o_localCellId = l_searchResult - m_clusteredInterior[o_localClusterId].begin();
+      o_localCellId = m_interiorPositions[ i_meshId ];
 
       // ensure a valid value
-      if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+      if( o_localCellId >= m_clusteredInterior[o_localClusterId].size() ||
+          m_clusteredInterior[o_localClusterId][o_localCellId] != i_meshId ) logError() << "no matching neighboring interior cell";
     }
 
   public:
@@ -481,11 +519,20 @@ class seissol::initializers::time_stepping::LtsLayout {
     void setTimeStepWidth( unsigned int i_cellId,
                            double       i_timeStepWidth );
 
+    /**
+     * Sets the rate which the LTS weights selected automatically for the partitioning.
+     * deriveLayout uses it instead of selecting the rate again.
+     *
+     * @param i_clusterRate selected rate; MultiRate::AutomaticRate if the weights did not select a rate.
+     **/
+    void setSelectedClusterRate( unsigned int i_clusterRate );
+
     /**
      * Derives the layout of the LTS scheme.
      *
      * @param i_timeClustering clustering strategy.
-     * @param i_clusterRate cluster rate in the case of a multi-rate scheme.
+     * @param i_clusterRate cluster rate in the case of a multi-rate scheme; MultiRate::AutomaticRate uses the rate
+     *        of the LTS weights if set or selects the rate with the fewest cell updates.
      **/
     void deriveLayout( enum TimeClustering i_timeClustering,
                        unsigned int        i_clusterRate = std::numeric_limits<unsigned int>::max() );
@@ -0,0 +1,137 @@
+#include "CostModel.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "utils/logger.h"
+
+namespace seissol::initializers::time_stepping {
+
+namespace {
+std::string cpuModelName() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("model name", 0) == 0) {
+      const auto colon = line.find(':');
+      if (colon != std::string::npos) {
+        return line.substr(colon + 1);
+      }
+    }
+  }
+  return "unknown";
+}
+} // namespace
+
+std::string costModelKey(bool usePlasticity) {
+  int numberOfThreads = 1;
+#ifdef _OPENMP
+  numberOfThreads = omp_get_max_threads();
+#endif
+
+  std::ostringstream key;
+  key << "order" << CONVERGENCE_ORDER << "-quantities" << NUMBER_OF_QUANTITIES << "-mechanisms"
+      << NUMBER_OF_RELAXATION_MECHANISMS << "-real"
+      << REAL_SIZE << "-plasticity" << (usePlasticity ? 1 : 0) << "-threads" << numberOfThreads
+      << '-' << cpuModelName();
+
+  // The key must not contain white space
+  auto keyString = key.str();
+  keyString.erase(std::unique(keyString.begin(),
+                              keyString.end(),
+                              [](char a, char b) { return std::isspace(a) && std::isspace(b); }),
+                  keyString.end());
+  std::replace_if(
+      keyString.begin(), keyString.end(), [](char c) { return std::isspace(c); }, '_');
+  return keyString;
+}
+
+std::optional<KernelCosts> loadKernelCosts(const std::string& fileName, const std::string& key) {
+  std::ifstream file(fileName);
+  std::string line;
+  std::optional<KernelCosts> result;
+  // Later entries overwrite earlier ones
+  while (std::getline(file, line)) {
+    std::istringstream entry(line);
+    std::string entryKey;
+    KernelCosts costs;
+    if (entry >> entryKey >> costs.local >> costs.neighbor >> costs.plasticity >>
+        costs.dynamicRupture >> costs.freeSurfaceWithGravity) {
+      if (entryKey == key) {
+        result = costs;
+      }
+    }
+  }
+  return result;
+}
+
+void storeKernelCosts(const std::string& fileName, const std::string& key, const KernelCosts& costs) {
+  std::ofstream file(fileName, std::ios::app);
+  file.precision(std::numeric_limits<double>::max_digits10);
+  file << key << ' ' << costs.local << ' ' << costs.neighbor << ' ' << costs.plasticity << ' '
+       << costs.dynamicRupture << ' ' << costs.freeSurfaceWithGravity << '\n';
+  if (!file) {
+    logWarning() << "Could not write the LTS cost model to" << fileName;
+  }
+}
+
+double frictionLawCostFactor(dr::FrictionLawType frictionLawType, bool isThermalPressureOn) {
+  // Estimates from the number of nonlinear updates per fault point and time point:
+  // The linear slip weakening and imposed slip rate laws evaluate the friction once,
+  // the rate-and-state laws solve a Newton iteration for each of their state variable updates.
+  double factor = 1.0;
+  switch (frictionLawType) {
+  case dr::FrictionLawType::NoFault:
+    factor = 1.0;
+    break;
+  case dr::FrictionLawType::ImposedSlipRatesYoffe:
+  case dr::FrictionLawType::ImposedSlipRatesGaussian:
+  case dr::FrictionLawType::LinearSlipWeakening:
+    factor = 1.5;
+    break;
+  case dr::FrictionLawType::LinearSlipWeakeningBimaterial:
+    factor = 1.75;
+    break;
+  case dr::FrictionLawType::RateAndStateAgingLaw:
+  case dr::FrictionLawType::RateAndStateSlipLaw:
+  case dr::FrictionLawType::RateAndStateVelocityWeakening:
+  case dr::FrictionLawType::RateAndStateAgingNucleation:
+    factor = 3.0;
+    break;
+  case dr::FrictionLawType::RateAndStateFastVelocityWeakening:
+    factor = 3.5;
+    break;
+  default:
+    logWarning() << "No cost estimate for friction law"
+                 << static_cast<unsigned>(frictionLawType) << "available.";
+    break;
+  }
+  // The thermal pressurization solves a diffusion equation on a spectral grid per fault point
+  if (isThermalPressureOn) {
+    factor += 1.0;
+  }
+  return factor;
+}
+
+VertexWeights computeVertexWeights(const KernelCosts& costs, int elementWeight) {
+  const double elementCost = costs.local + costs.neighbor + costs.plasticity;
+  if (!(elementCost > 0.0)) {
+    logError() << "Invalid LTS cost model: The costs of an element must be positive.";
+  }
+  const auto relativeWeight = [&](double cost) {
+    return std::max(0, static_cast<int>(std::lround(elementWeight * cost / elementCost)));
+  };
+  return VertexWeights{elementWeight,
+                       relativeWeight(costs.dynamicRupture),
+                       relativeWeight(costs.freeSurfaceWithGravity)};
+}
+
+} // namespace seissol::initializers::time_stepping
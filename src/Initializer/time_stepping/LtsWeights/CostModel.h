@@ -0,0 +1,60 @@
+#ifndef SEISSOL_LTSCOSTMODEL_H
+#define SEISSOL_LTSCOSTMODEL_H
+
+#include <optional>
+#include <string>
+
+#include "DynamicRupture/Typedefs.hpp"
+
+namespace seissol::initializers::time_stepping {
+
+/**
+ * Measured run time of the kernels per time step (in seconds).
+ * Element costs are per element, the others per face.
+ */
+struct KernelCosts {
+  double local{};
+  double neighbor{};
+  double plasticity{};
+  double dynamicRupture{};
+  double freeSurfaceWithGravity{};
+};
+
+struct VertexWeights {
+  int element{};
+  int dynamicRupture{};
+  int freeSurfaceWithGravity{};
+};
+
+/**
+ * Identifies the compiled configuration (order, equation, precision) and the
+ * hardware, for which kernel costs are valid.
+ */
+std::string costModelKey(bool usePlasticity);
+
+/**
+ * Returns the kernel costs for key from the cache file, if present.
+ */
+std::optional<KernelCosts> loadKernelCosts(const std::string& fileName, const std::string& key);
+
+/**
+ * Appends the kernel costs for key to the cache file.
+ */
+void storeKernelCosts(const std::string& fileName, const std::string& key, const KernelCosts& costs);
+
+/**
+ * Estimated cost of a dynamic rupture face with the given friction law relative to the
+ * space-time interpolation alone (which is what measureKernelCosts measures).
+ * The friction law is not measured, as its cost depends on the fault state.
+ */
+double frictionLawCostFactor(dr::FrictionLawType frictionLawType, bool isThermalPressureOn);
+
+/**
+ * Converts the kernel costs to vertex weights relative to an element,
+ * which has the weight elementWeight.
+ */
+VertexWeights computeVertexWeights(const KernelCosts& costs, int elementWeight = 100);
+
+} // namespace seissol::initializers::time_stepping
+
+#endif // SEISSOL_LTSCOSTMODEL_H
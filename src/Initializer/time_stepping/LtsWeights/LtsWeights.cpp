@@ -48,10 +48,16 @@
 #include "LtsWeights.h"
 
 #include <Initializer/ParameterDB.h>
+#include <Initializer/time_stepping/MultiRate.hpp>
 #include <Parallel/MPI.h>
 
 #include <generated_code/init.h>
 
+#include <hdf5.h>
+
+#include <cmath>
+#include <fstream>
+
 namespace seissol::initializers::time_stepping {
 
 class FaceSorter {
@@ -72,6 +78,9 @@ void LtsWeights::computeWeights(PUML::TETPUML const &mesh, double maximumAllowed
   // Note: Return value optimization is guaranteed while returning temp. objects in C++17
   m_mesh = &mesh;
   m_details = collectGlobalTimeStepDetails(maximumAllowedTimeStep);
+  if (m_rate == MultiRate::AutomaticRate) {
+    m_rate = selectRate();
+  }
   m_clusterIds = computeClusterIds();
   m_ncon = evaluateNumberOfConstraints();
   auto totalNumberOfReductions = enforceMaximumDifference();
@@ -223,6 +232,26 @@ std::vector<int> LtsWeights::computeClusterIds() {
   return clusterIds;
 }
 
+unsigned LtsWeights::selectRate() {
+  // The LtsLayout uses this rate if the rate is selected automatically
+  unsigned bestRate = 2;
+  double bestCost = std::numeric_limits<double>::max();
+  for (unsigned rate = 2; rate <= MultiRate::MaximumAutomaticRate; ++rate) {
+    m_rate = rate;
+    m_clusterIds = computeClusterIds();
+    enforceMaximumDifference();
+
+    const double cost = MultiRate::deriveClusteringCost(rate, m_clusterIds.size(), m_clusterIds.data());
+    if (MultiRate::isCheaperClustering(cost, bestCost)) {
+      bestCost = cost;
+      bestRate = rate;
+    }
+  }
+
+  logInfo(seissol::MPI::mpi.rank()) << "Selected the LTS rate" << bestRate << "for the LTS weights.";
+  return bestRate;
+}
+
 std::vector<int> LtsWeights::computeCostsPerTimestep() {
   const auto &cells = m_mesh->cells();
 
@@ -245,9 +274,75 @@ std::vector<int> LtsWeights::computeCostsPerTimestep() {
     const int costDisplacement = m_vertexWeightFreeSurfaceWithGravity * freeSurfaceWithGravity;
     cellCosts[cell] = m_vertexWeightElement + costDynamicRupture + costDisplacement;
   }
+
+  if (!m_measuredCostsFile.empty() && applyMeasuredCosts(cellCosts)) {
+    logInfo(seissol::MPI::mpi.rank()) << "Using the measured costs from" << m_measuredCostsFile;
+  }
   return cellCosts;
 }
 
+bool LtsWeights::applyMeasuredCosts(std::vector<int> &cellCosts) {
+  // The file is written by the CellCostExporter and contains the costs of all cells
+  // in the order of the mesh file, normalized by their mean
+  if (!std::ifstream(m_measuredCostsFile).good()) {
+    return false;
+  }
+
+  const int rank = seissol::MPI::mpi.rank();
+  unsigned long numberOfCells = cellCosts.size();
+  unsigned long offset = 0;
+  unsigned long totalNumberOfCells = 0;
+  MPI_Exscan(&numberOfCells, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+  if (rank == 0) {
+    offset = 0;
+  }
+  MPI_Allreduce(&numberOfCells, &totalNumberOfCells, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+
+  hid_t plistId = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plistId, seissol::MPI::mpi.comm(), MPI_INFO_NULL);
+  hid_t file = H5Fopen(m_measuredCostsFile.c_str(), H5F_ACC_RDONLY, plistId);
+  H5Pclose(plistId);
+  if (file < 0) {
+    logError() << "Could not open" << m_measuredCostsFile;
+  }
+
+  hid_t dataset = H5Dopen2(file, "/cost", H5P_DEFAULT);
+  hid_t filespace = H5Dget_space(dataset);
+  hsize_t dim = 0;
+  H5Sget_simple_extent_dims(filespace, &dim, nullptr);
+  if (dim != totalNumberOfCells) {
+    logWarning(rank) << "The measured costs in" << m_measuredCostsFile << "belong to a different mesh. Ignoring them.";
+    H5Sclose(filespace);
+    H5Dclose(dataset);
+    H5Fclose(file);
+    return false;
+  }
+
+  const hsize_t start[] = {static_cast<hsize_t>(offset)};
+  const hsize_t count[] = {static_cast<hsize_t>(numberOfCells)};
+  H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  hid_t memspace = H5Screate_simple(1, count, nullptr);
+
+  plistId = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plistId, H5FD_MPIO_COLLECTIVE);
+  std::vector<double> measuredCosts(numberOfCells);
+  if (H5Dread(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, plistId, measuredCosts.data()) < 0) {
+    logError() << "Could not read the measured costs from" << m_measuredCostsFile;
+  }
+
+  H5Pclose(plistId);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(dataset);
+  H5Fclose(file);
+
+  // The measured costs include dynamic rupture and free surfaces with gravity
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    cellCosts[cell] = std::max(1, static_cast<int>(std::lround(m_vertexWeightElement * measuredCosts[cell])));
+  }
+  return true;
+}
+
 int LtsWeights::enforceMaximumDifference() {
   int totalNumberOfReductions = 0;
   int globalNumberOfReductions;
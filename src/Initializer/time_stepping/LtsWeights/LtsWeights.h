@@ -58,6 +58,8 @@ struct LtsWeightsConfig {
   int vertexWeightElement{};
   int vertexWeightDynamicRupture{};
   int vertexWeightFreeSurfaceWithGravity{};
+  //! measured costs of the cells, replace the vertex weights of the elements if the file exists
+  std::string measuredCostsFile{};
 };
 
 
@@ -67,7 +69,8 @@ public:
                                                m_rate(config.rate),
                                                m_vertexWeightElement(config.vertexWeightElement),
                                                m_vertexWeightDynamicRupture(config.vertexWeightDynamicRupture),
-                                               m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity) {}
+                                               m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity),
+                                               m_measuredCostsFile(config.measuredCostsFile) {}
 
   virtual ~LtsWeights() = default;
   void computeWeights(PUML::TETPUML const &mesh, double maximumAllowedTimeStep);
@@ -75,6 +78,8 @@ public:
   const int *vertexWeights() const;
   const double *imbalances() const;
   int nWeightsPerVertex() const;
+  //! rate of the multi-rate scheme; the selected rate after computeWeights for MultiRate::AutomaticRate
+  unsigned rate() const { return m_rate; }
 
 protected:
   struct GlobalTimeStepDetails {
@@ -88,9 +93,12 @@ protected:
   int getCluster(double timestep, double globalMinTimestep, unsigned rate);
   int getBoundaryCondition(int const *boundaryCond, unsigned cell, unsigned face);
   std::vector<int> computeClusterIds();
+  //! Selects the rate with the fewest cell updates per time interval (for MultiRate::AutomaticRate)
+  unsigned selectRate();
   int enforceMaximumDifference();
   int enforceMaximumDifferenceLocal(int maxDifference = 1);
   std::vector<int> computeCostsPerTimestep();
+  bool applyMeasuredCosts(std::vector<int> &cellCosts);
 
   static int ipow(int x, int y);
 
@@ -106,6 +114,7 @@ protected:
   int m_vertexWeightElement{};
   int m_vertexWeightDynamicRupture{};
   int m_vertexWeightFreeSurfaceWithGravity{};
+  std::string m_measuredCostsFile{};
   int m_ncon{std::numeric_limits<int>::infinity()};
   const PUML::TETPUML * m_mesh{nullptr};
   std::vector<int> m_clusterIds{};
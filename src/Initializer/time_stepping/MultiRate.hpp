@@ -42,6 +42,7 @@
 #include "Parallel/MPI.h"
 
 #include "common.hpp"
+#include <cmath>
 #include <limits>
 
 #ifndef MULTIRATE_HPP
@@ -196,6 +197,47 @@ class seissol::initializers::time_stepping::MultiRate {
 
 
   public:
+    //! Rate which requests the automatic selection of the rate
+    static constexpr unsigned int AutomaticRate = 0;
+
+    //! Largest rate considered by the automatic selection (starting at 2)
+    static constexpr unsigned int MaximumAutomaticRate = 8;
+
+    /**
+     * Derives the cost of a clustering, i.e. the number of cell updates per time step of the
+     * smallest cluster, summed over all ranks.
+     * The automatic selection picks the rate with the lowest cost; the LTS weights and the
+     * LTS layout both use this criterion.
+     *
+     * @param i_multiRate multi rate configuration.
+     * @param i_numberOfCells number of cells in the local domain.
+     * @param i_cellClusterIds cluster ids of the cells.
+     * @return global cost of the clustering.
+     **/
+    template< typename ClusterId >
+    static double deriveClusteringCost( unsigned int     i_multiRate,
+                                        unsigned int     i_numberOfCells,
+                                        const ClusterId *i_cellClusterIds ) {
+      double l_cost = 0;
+      for( unsigned int l_cell = 0; l_cell < i_numberOfCells; l_cell++ ) {
+        l_cost += std::pow( static_cast<double>(i_multiRate), -static_cast<double>(i_cellClusterIds[l_cell]) );
+      }
+
+#ifdef USE_MPI
+      MPI_Allreduce( MPI_IN_PLACE, &l_cost, 1, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm() );
+#endif
+      return l_cost;
+    }
+
+    /**
+     * Returns true if a clustering with cost i_cost is preferred over one with cost i_bestCost.
+     * The rates are tested in increasing order; the smaller rate is preferred if the costs are equal.
+     **/
+    static bool isCheaperClustering( double i_cost,
+                                     double i_bestCost ) {
+      return i_cost < i_bestCost * (1.0 - 1e-10);
+    }
+
     /**
      * Derives the cluster ids of the cells.
      *
@@ -46,6 +46,11 @@
 
 #include <Initializer/MemoryAllocator.h>
 
+#include <sstream>
+#include <string>
+
+#include "utils/logger.h"
+
 namespace seissol {
   namespace initializers {
     class LTSTree;
@@ -62,12 +67,10 @@ private:
   std::vector<size_t> variableSizes{};  /*!< sizes of variables within the entire tree in bytes */
   std::vector<size_t> bucketSizes{};    /*!< sizes of buckets within the entire tree in bytes */
 
-#ifdef ACL_DEVICE
   std::vector<MemoryInfo> scratchpadMemInfo{};
   std::vector<size_t> scratchpadMemSizes{};  /*!< sizes of variables within the entire tree in bytes */
   void** scratchpadMemories;
   std::vector<int> scratchpadMemIds{};
-#endif  // ACL_DEVICE
 
 public:
   LTSTree() : m_vars(NULL), m_buckets(NULL) {}
@@ -82,9 +85,7 @@ public:
     setPostOrderPointers();
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
       it->allocatePointerArrays(varInfo.size(), bucketInfo.size());
-#ifdef ACL_DEVICE
       it->allocateScratchpadArrays(scratchpadMemInfo.size());
-#endif
     }
   }
   
@@ -112,7 +113,7 @@ public:
   }
   
   template<typename T>
-  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind) {
+  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind, const std::string& name) {
     handle.index = varInfo.size();
     handle.mask = mask;
     MemoryInfo m;
@@ -120,26 +121,27 @@ public:
     m.alignment = alignment;
     m.mask = mask;
     m.memkind = memkind;
+    m.name = name;
     varInfo.push_back(m);
   }
   
-  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind) {
+  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind, const std::string& name) {
     handle.index = bucketInfo.size();
     MemoryInfo m;
     m.alignment = alignment;
     m.memkind = memkind;
+    m.name = name;
     bucketInfo.push_back(m);
   }
 
-#ifdef ACL_DEVICE
-  void addScratchpadMemory(ScratchpadMemory& handle, size_t alignment, seissol::memory::Memkind memkind) {
+  void addScratchpadMemory(ScratchpadMemory& handle, size_t alignment, seissol::memory::Memkind memkind, const std::string& name) {
     handle.index = scratchpadMemInfo.size();
     MemoryInfo memoryInfo;
     memoryInfo.alignment = alignment;
     memoryInfo.memkind = memkind;
+    memoryInfo.name = name;
     scratchpadMemInfo.push_back(memoryInfo);
   }
-#endif // ACL_DEVICE
   
   void allocateVariables() {
     m_vars = new void*[varInfo.size()];
@@ -150,6 +152,7 @@ public:
     }
 
     for (unsigned var = 0; var < varInfo.size(); ++var) {
+      varInfo[var].memkind = seissol::memory::hostMemkind(varInfo[var].memkind, "SEISSOL_MEMKIND_VARIABLES");
       m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
     }
     
@@ -169,6 +172,7 @@ public:
     }
     
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
+      bucketInfo[bucket].memkind = seissol::memory::hostMemkind(bucketInfo[bucket].memkind, "SEISSOL_MEMKIND_BUCKETS");
       m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
     }
     
@@ -179,13 +183,13 @@ public:
     }
   }
 
-#ifdef ACL_DEVICE
   // Walks through all leaves, computes the maximum amount of memory for each scratchpad entity,
   // allocates all scratchpads based on evaluated max. scratchpad sizes, and, finally,
   // redistributes scratchpads to all leaves.
   //
   // Note, all scratchpad entities are shared between leaves.
-  // Do not update leaves in parallel inside of the same MPI rank while using GPUs.
+  // Do not update leaves in parallel inside of the same MPI rank while using GPUs
+  // or batched CPU kernels.
   void allocateScratchPads() {
     scratchpadMemories = new void*[scratchpadMemInfo.size()];
     scratchpadMemSizes.resize(scratchpadMemInfo.size(), 0);
@@ -206,7 +210,6 @@ public:
       it->setMemoryRegionsForScratchpads(scratchpadMemories, scratchpadMemInfo.size());
     }
   }
-#endif
   
   void touchVariables() {
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
@@ -214,6 +217,50 @@ public:
     }
   }
 
+  /**
+   * Reports the distribution of the (touched) pages of all variables and buckets
+   * over the NUMA nodes (SEISSOL_MEMORY_AUDIT).
+   */
+  void auditMemory(const std::string& treeName) {
+    auto report = [&](const MemoryInfo& info, const void* memory, size_t bytes) {
+      if (bytes == 0 || info.memkind == seissol::memory::DeviceGlobalMemory) {
+        return;
+      }
+      const auto distribution = seissol::memory::numaPageDistribution(memory, bytes);
+      std::ostringstream nodes;
+      for (size_t node = 0; node < distribution.pagesPerNode.size(); ++node) {
+        if (distribution.pagesPerNode[node] > 0) {
+          nodes << " node" << node << ": "
+                << 100.0 * distribution.pagesPerNode[node] / distribution.sampled << "%";
+        }
+      }
+      if (distribution.notPresent > 0) {
+        nodes << " not present: " << 100.0 * distribution.notPresent / distribution.sampled << "%";
+      }
+      logInfo() << treeName.c_str() << info.name.c_str() << "(" << bytes / (1024.0 * 1024.0) << "MiB,"
+                << seissol::memory::memkindName(info.memkind) << "):" << nodes.str().c_str();
+    };
+
+    for (unsigned var = 0; var < varInfo.size(); ++var) {
+      report(varInfo[var], m_vars[var], variableSizes[var]);
+    }
+    for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
+      report(bucketInfo[bucket], m_buckets[bucket], bucketSizes[bucket]);
+    }
+  }
+
+  std::vector<MemoryInfo> const& getVariableInfo() const {
+    return varInfo;
+  }
+
+  std::vector<MemoryInfo> const& getBucketInfo() const {
+    return bucketInfo;
+  }
+
+  std::vector<MemoryInfo> const& getScratchpadInfo() const {
+    return scratchpadMemInfo;
+  }
+
   const std::vector<size_t>& getVariableSizes() {
     return variableSizes;
   }
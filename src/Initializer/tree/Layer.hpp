@@ -46,6 +46,7 @@
 #include <bitset>
 #include <limits>
 #include <cstring>
+#include <string>
 
 
 enum LayerType {
@@ -63,9 +64,7 @@ namespace seissol {
     struct Bucket;
     struct MemoryInfo;
     class Layer;
-#ifdef ACL_DEVICE
     struct ScratchpadMemory;
-#endif
   }
 }
 
@@ -83,15 +82,14 @@ struct seissol::initializers::Bucket {
   Bucket() : index(std::numeric_limits<unsigned>::max()) {}
 };
 
-#ifdef ACL_DEVICE
 struct seissol::initializers::ScratchpadMemory : public seissol::initializers::Bucket{};
-#endif
 
 struct seissol::initializers::MemoryInfo {
   size_t bytes;
   size_t alignment;
   LayerMask mask;
   seissol::memory::Memkind memkind;
+  std::string name;
 };
 
 class seissol::initializers::Layer : public seissol::initializers::Node {
@@ -102,11 +100,9 @@ private:
   void** m_buckets;
   size_t* m_bucketSizes;
 
-#ifdef ACL_DEVICE
   void** m_scratchpads{};
   size_t* m_scratchpadSizes{};
   ConditionalBatchTableT m_conditionalBatchTable{};
-#endif
 
 public:
   Layer() : m_numberOfCells(0), m_vars(NULL), m_buckets(NULL), m_bucketSizes(NULL) {}
@@ -125,13 +121,11 @@ public:
     return m_buckets[handle.index];
   }
 
-#ifdef ACL_DEVICE
   void* getScratchpadMemory(ScratchpadMemory const& handle) {
     assert(handle.index != std::numeric_limits<unsigned>::max());
     assert(m_scratchpads != NULL/* && m_vars[handle.index] != NULL*/);
     return (m_scratchpads[handle.index]);
   }
-#endif
   
   /// i-th bit of layerMask shall be set if data is masked on the i-th layer
   inline bool isMasked(LayerMask layerMask) const {
@@ -164,7 +158,6 @@ public:
     std::fill(m_bucketSizes, m_bucketSizes + numBuckets, 0);
   }
 
-#ifdef ACL_DEVICE
   inline void allocateScratchpadArrays(unsigned numScratchPads) {
     assert(m_scratchpads == nullptr && m_scratchpadSizes == nullptr);
 
@@ -174,24 +167,26 @@ public:
     m_scratchpadSizes = new size_t[numScratchPads];
     std::fill(m_scratchpadSizes, m_scratchpadSizes + numScratchPads, 0);
   }
-#endif
   
   inline void setBucketSize(Bucket const& handle, size_t size) {
     assert(m_bucketSizes != NULL);
     m_bucketSizes[handle.index] = size;
   }
 
-#ifdef ACL_DEVICE
   inline void setScratchpadSize(ScratchpadMemory const& handle, size_t size) {
     assert(m_scratchpadSizes != NULL);
     m_scratchpadSizes[handle.index] = size;
   }
-#endif
 
   inline size_t getBucketSize(Bucket const& handle) {
     assert(m_bucketSizes != nullptr);
     return m_bucketSizes[handle.index];
     }
+
+  inline size_t getBucketSize(unsigned index) const {
+    assert(m_bucketSizes != nullptr);
+    return m_bucketSizes[index];
+  }
   
   void addVariableSizes(std::vector<MemoryInfo> const& vars, std::vector<size_t>& bytes) {
     for (unsigned var = 0; var < vars.size(); ++var) {
@@ -207,7 +202,6 @@ public:
     }
   }
 
-#ifdef ACL_DEVICE
   // Overrides array's elements; if the corresponding local
   // scratchpad mem. size is bigger then the one inside of the array
   void findMaxScratchpadSizes(std::vector<size_t>& bytes) {
@@ -215,7 +209,6 @@ public:
       bytes[id] = std::max(bytes[id], m_scratchpadSizes[id]);
     }
   }
-#endif
 
   void setMemoryRegionsForVariables(std::vector<MemoryInfo> const& vars, void** memory, std::vector<size_t>& offsets) {
     assert(m_vars != NULL);
@@ -233,14 +226,12 @@ public:
     }
   }
 
-#ifdef ACL_DEVICE
   void setMemoryRegionsForScratchpads(void** memory, size_t numScratchPads) {
     assert(m_scratchpads != NULL);
     for (size_t id = 0; id < numScratchPads; ++id) {
       m_scratchpads[id] = static_cast<char*>(memory[id]);
     }
   }
-#endif
   
   void touchVariables(std::vector<MemoryInfo> const& vars) {
     for (unsigned var = 0; var < vars.size(); ++var) {
@@ -258,7 +249,6 @@ public:
     }
   }
 
-#ifdef ACL_DEVICE
   ConditionalBatchTableT& getCondBatchTable() {
     return m_conditionalBatchTable;
   }
@@ -266,7 +256,6 @@ public:
   const ConditionalBatchTableT& getCondBatchTable() const {
     return m_conditionalBatchTable;
   }
-#endif // ACL_DEVICE
 };
 
 #endif
@@ -0,0 +1,70 @@
+#include "MixedPrecision.h"
+
+#include <algorithm>
+
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace seissol::kernels::mixed_precision {
+
+bool useReducedPrecisionBuffers() {
+  static const bool useReduced = []() {
+    const bool requested = utils::Env::get<int>("SEISSOL_MIXED_PRECISION", 0) != 0;
+#if defined(DOUBLE_PRECISION) && !defined(ACL_DEVICE)
+    if (requested) {
+      logInfo() << "Storing and exchanging the time-integrated buffers in single precision;"
+                << "the time derivatives stay in double precision.";
+    }
+    return requested;
+#else
+    if (requested) {
+      logWarning() << "SEISSOL_MIXED_PRECISION is only supported by double precision CPU builds.";
+    }
+    return false;
+#endif
+  }();
+  return useReduced;
+}
+
+void compress(const real* in, ReducedReal* out, std::size_t size) {
+#pragma omp simd
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = static_cast<ReducedReal>(in[i]);
+  }
+}
+
+void decompress(const ReducedReal* in, real* out, std::size_t size) {
+#pragma omp simd
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = static_cast<real>(in[i]);
+  }
+}
+
+void accumulate(const real* in, ReducedReal* inout, std::size_t size) {
+#pragma omp simd
+  for (std::size_t i = 0; i < size; ++i) {
+    inout[i] = static_cast<ReducedReal>(static_cast<real>(inout[i]) + in[i]);
+  }
+}
+
+void packBuffers(const real* region,
+                 unsigned numberOfBuffers,
+                 std::size_t bufferSize,
+                 ReducedReal* packed) {
+  for (unsigned buffer = 0; buffer < numberOfBuffers; ++buffer) {
+    const ReducedReal* slot = reducedBuffer(region + buffer * bufferSize);
+    std::copy_n(slot, bufferSize, packed + buffer * bufferSize);
+  }
+}
+
+void unpackBuffers(const ReducedReal* packed,
+                   unsigned numberOfBuffers,
+                   std::size_t bufferSize,
+                   real* region) {
+  for (unsigned buffer = 0; buffer < numberOfBuffers; ++buffer) {
+    ReducedReal* slot = reducedBuffer(region + buffer * bufferSize);
+    std::copy_n(packed + buffer * bufferSize, bufferSize, slot);
+  }
+}
+
+} // namespace seissol::kernels::mixed_precision
@@ -0,0 +1,63 @@
+#ifndef SEISSOL_MIXEDPRECISION_H
+#define SEISSOL_MIXEDPRECISION_H
+
+#include <cstddef>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::kernels::mixed_precision {
+
+//! Storage type of the time-integrated buffers (not of the time derivatives)
+using ReducedReal = float;
+
+/**
+ * Returns true if the time-integrated buffers are stored and exchanged in single precision
+ * (SEISSOL_MIXED_PRECISION=1). The DOFs and the time derivatives stay in double precision and are
+ * exchanged in double precision, since the dynamic rupture faces at partition boundaries are
+ * computed from the derivatives on both ranks.
+ * Only available for double precision CPU builds.
+ */
+bool useReducedPrecisionBuffers();
+
+/**
+ * A buffer in reduced precision occupies the first half of its (double precision) slot,
+ * i.e. the memory layout is the same as without reduced precision.
+ */
+inline ReducedReal* reducedBuffer(real* buffer) { return reinterpret_cast<ReducedReal*>(buffer); }
+
+inline const ReducedReal* reducedBuffer(const real* buffer) {
+  return reinterpret_cast<const ReducedReal*>(buffer);
+}
+
+//! out = in (rounded to reduced precision)
+void compress(const real* in, ReducedReal* out, std::size_t size);
+
+//! out = in
+void decompress(const ReducedReal* in, real* out, std::size_t size);
+
+//! inout += in (the sum is computed in full precision)
+void accumulate(const real* in, ReducedReal* inout, std::size_t size);
+
+/**
+ * Packs the buffers of a copy region (see InternalState) into a contiguous array in reduced
+ * precision. The buffers are expected to be stored in reduced precision already.
+ * The derivatives which follow the buffers are exchanged in full precision and not packed.
+ *
+ * @param bufferSize Number of values of a buffer (size of a buffer slot in reals)
+ */
+void packBuffers(const real* region,
+                 unsigned numberOfBuffers,
+                 std::size_t bufferSize,
+                 ReducedReal* packed);
+
+/**
+ * Inverse of packBuffers for a ghost region.
+ */
+void unpackBuffers(const ReducedReal* packed,
+                   unsigned numberOfBuffers,
+                   std::size_t bufferSize,
+                   real* region);
+
+} // namespace seissol::kernels::mixed_precision
+
+#endif // SEISSOL_MIXEDPRECISION_H
@@ -44,8 +44,43 @@
 #include <Numerical_aux/Transformation.h>
 #include <Parallel/MPI.h>
 #include <Monitoring/FlopCounter.hpp>
+#include <Parallel/TaskScheduling.h>
 #include <generated_code/kernel.h>
 
+#include <algorithm>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+seissol::kernels::ReceiverCluster::ReceiverCluster( GlobalData const*             global,
+                                                    std::vector<unsigned> const&  quantities,
+                                                    double                        samplingInterval,
+                                                    double                        syncPointInterval,
+                                                    ReceiverDecimation const&     decimation )
+  : m_quantities(quantities),
+    m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval),
+    m_decimation(std::max(decimation.factor, 1u)) {
+  m_timeKernel.setHostGlobalData(global);
+  m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+
+#ifdef _OPENMP
+  m_scratch.resize(omp_get_max_threads());
+#else
+  m_scratch.resize(1);
+#endif
+  for (auto& scratch : m_scratch) {
+    scratch.values.resize(ncols() - 1);
+  }
+
+  if (m_decimation > 1 && decimation.filterOrder > 0) {
+    // Cutoff relative to the (dense) sampling frequency
+    const double cutoff = 0.5 * decimation.cutoff / m_decimation;
+    m_filter = filter::IIRCascade(filter::designButterworthLowPass(decimation.filterOrder, cutoff));
+  }
+}
+
 void seissol::kernels::ReceiverCluster::addReceiver(  unsigned                          meshId,
                                                       unsigned                          pointId,
                                                       Eigen::Vector3d const&            point,
@@ -61,131 +96,258 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
   }
   auto xiEtaZeta = seissol::transformations::tetrahedronGlobalToReference(coords[0], coords[1], coords[2], coords[3], point);
 
-  // (time + number of quantities) * number of samples until sync point
-  size_t reserved = ncols() * (m_syncPointInterval / m_samplingInterval + 1);
+  // Cells which store their time derivatives for the neighbors are evaluated
+  // with the derivatives of the local integration
+#if defined(USE_STP) || defined(ACL_DEVICE)
+  real* derivatives = nullptr;
+#else
+  real* derivatives = ltsLut.lookup(lts.derivatives, meshId);
+#endif
+
+  // (time + number of quantities) * number of (decimated) samples until sync point
+  size_t reserved = ncols() * (m_syncPointInterval / (m_samplingInterval * m_decimation) + 1);
   m_receivers.emplace_back(pointId,
                            point,
                            xiEtaZeta[0],
                            xiEtaZeta[1],
                            xiEtaZeta[2],
                            kernels::LocalData::lookup(lts, ltsLut, meshId),
+                           derivatives,
                            reserved);
+  m_receivers.back().filterState.assign(filterStateSize(), 0.0);
+}
+
+namespace {
+bool isSelected(seissol::kernels::Receiver const& receiver,
+                seissol::kernels::ReceiverSelection selection) {
+  using seissol::kernels::ReceiverSelection;
+  switch (selection) {
+  case ReceiverSelection::WithoutStoredDerivatives:
+    return receiver.derivatives == nullptr;
+  case ReceiverSelection::WithStoredDerivatives:
+    return receiver.derivatives != nullptr;
+  default:
+    return true;
+  }
+}
+} // namespace
+
+seissol::kernels::ReceiverCluster::ReceiverScratch& seissol::kernels::ReceiverCluster::scratch() {
+#ifdef _OPENMP
+  // Also valid for the tasks of parallel::forEach: a task runs to completion on its thread
+  return m_scratch[omp_get_thread_num()];
+#else
+  return m_scratch[0];
+#endif
 }
 
 double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
                                                           double expansionPoint,
-                                                          double timeStepWidth ) {
-#ifdef USE_STP
-  alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
-  alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
-  alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
+                                                          double timeStepWidth,
+                                                          ReceiverSelection selection ) {
+  // The sampling times are the same for all receivers
+  auto& sampleTimes = m_sampleTimes;
+  sampleTimes.clear();
+  double receiverTime = time;
+  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
+    while (receiverTime < expansionPoint + timeStepWidth) {
+      sampleTimes.push_back(receiverTime);
+      receiverTime += m_samplingInterval;
+    }
+  }
+  if (sampleTimes.empty()) {
+    return receiverTime;
+  }
 
-  kernel::evaluateDOFSAtPointSTP krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.spaceTimePredictor = stp;
+#ifndef USE_STP
+  // Taylor expansion for all samples: samples = taylorCoefficients * derivativesAtPoint
+  constexpr unsigned NumberOfDerivatives = yateto::numFamilyMembers<tensor::dQ>();
+  m_taylorCoefficients.resize(sampleTimes.size() * NumberOfDerivatives);
+  for (size_t sample = 0; sample < sampleTimes.size(); ++sample) {
+    const real deltaT = sampleTimes[sample] - expansionPoint;
+    real power = 1.0;
+    for (unsigned derivative = 0; derivative < NumberOfDerivatives; ++derivative) {
+      m_taylorCoefficients[sample * NumberOfDerivatives + derivative] = power;
+      power *= deltaT / real(derivative + 1);
+    }
+  }
+#endif
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
+  // Receivers only write to their own output, hence they are independent
+  parallel::forEach(m_receivers.size(), [&](unsigned r) {
+    auto& receiver = m_receivers[r];
+    if (!isSelected(receiver, selection)) {
+      return;
+    }
 
-  double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+#ifdef USE_STP
+    alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
+    alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
+    alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
 
-      m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
-      g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
-      g_SeisSolHardwareFlopsOther += m_hardwareFlops;
+    kernel::evaluateDOFSAtPointSTP krnl;
+    krnl.QAtPoint = timeEvaluatedAtPoint;
+    krnl.spaceTimePredictor = stp;
+    krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+
+    auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
+    auto& values = scratch().values;
+
+    m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    g_SeisSolHardwareFlopsOther += m_hardwareFlops;
 
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
-        //eval time basis
-        double tau = (time - expansionPoint) / timeStepWidth;
-        seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
-        krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
-        krnl.execute();
+    for (auto sampleTime : sampleTimes) {
+      //eval time basis
+      double tau = (time - expansionPoint) / timeStepWidth;
+      seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
+      krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
+      krnl.execute();
 
-        receiver.output.push_back(receiverTime);
+      auto* value = values.data();
 #ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
-        }
-#else //MULTIPLE_SIMULATIONS
+      for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
         for (auto quantity : m_quantities) {
-          receiver.output.push_back(qAtPoint(quantity));
+          *value++ = qAtPoint(sim, quantity);
         }
-#endif //MULTITPLE_SIMULATIONS
-
-        receiverTime += m_samplingInterval;
       }
+#else //MULTIPLE_SIMULATIONS
+      for (auto quantity : m_quantities) {
+        *value++ = qAtPoint(quantity);
+      }
+#endif //MULTITPLE_SIMULATIONS
+      recordSample(receiver, sampleTime, values.data());
     }
-  }
-  return receiverTime;
 #else //USE_STP
-  real timeEvaluated[tensor::Q::size()] __attribute__((aligned(ALIGNMENT)));
-  real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()] __attribute__((aligned(ALIGNMENT)));
-  real timeEvaluatedAtPoint[tensor::QAtPoint::size()] __attribute__((aligned(ALIGNMENT)));
-
-  kernels::LocalTmp tmp;
-
-  kernel::evaluateDOFSAtPoint krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.Q = timeEvaluated;
+    alignas(ALIGNMENT) real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()];
+    real const* derivatives = receiver.derivatives;
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
-
-  double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+    // Stored derivatives are only valid after the local integration
+    if (selection != ReceiverSelection::WithStoredDerivatives) {
+      alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
+      kernels::LocalTmp tmp{};
 
       m_timeKernel.computeAder( timeStepWidth,
                                 receiver.data,
                                 tmp,
                                 timeEvaluated, // useless but the interface requires it
                                 timeDerivatives );
+#ifdef _OPENMP
+      #pragma omp atomic
+#endif
       g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
+#ifdef _OPENMP
+      #pragma omp atomic
+#endif
       g_SeisSolHardwareFlopsOther += m_hardwareFlops;
 
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
-        krnl.execute();
+      derivatives = timeDerivatives;
+    }
+
+    evaluateReceiver(receiver, derivatives, sampleTimes);
+#endif //USE_STP
+  });
+
+  return receiverTime;
+}
+
+#ifndef USE_STP
+void seissol::kernels::ReceiverCluster::evaluateReceiver(Receiver& receiver,
+                                                          real const* timeDerivatives,
+                                                          std::vector<double> const& sampleTimes) {
+  constexpr unsigned NumberOfDerivatives = yateto::numFamilyMembers<tensor::dQ>();
+  constexpr unsigned PointSize = tensor::QAtPoint::size();
+  constexpr unsigned PointStride =
+      (PointSize * sizeof(real) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT / sizeof(real);
+
+  // Evaluate the time derivatives at the receiver (one row per derivative)
+  alignas(ALIGNMENT) real derivativesAtPoint[NumberOfDerivatives * PointStride];
+
+  kernel::evaluateDerivativeAtPoint krnl;
+  krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+  unsigned offset = 0;
+  for (unsigned derivative = 0; derivative < NumberOfDerivatives; ++derivative) {
+    krnl.dQ(derivative) = timeDerivatives + offset;
+    krnl.QAtPoint = derivativesAtPoint + derivative * PointStride;
+    krnl.execute(derivative);
+    offset += tensor::dQ::size(derivative);
+  }
+
+  // The Taylor coefficients are shared by all receivers; the products are written to the
+  // scratch memory of the thread, which only grows with the number of samples per time step
+  using Matrix = Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const auto numberOfSamples = static_cast<Eigen::Index>(sampleTimes.size());
+  auto& threadScratch = scratch();
+  threadScratch.samples.resize(numberOfSamples * PointSize);
+  const Eigen::Map<const Matrix> taylorCoefficients(
+      m_taylorCoefficients.data(), numberOfSamples, NumberOfDerivatives);
+  const Eigen::Map<const Matrix, 0, Eigen::OuterStride<>> derivativesMatrix(
+      derivativesAtPoint, NumberOfDerivatives, PointSize, Eigen::OuterStride<>(PointStride));
+  Eigen::Map<Matrix> samples(threadScratch.samples.data(), numberOfSamples, PointSize);
+  samples.noalias() = taylorCoefficients * derivativesMatrix;
+
+  auto& values = threadScratch.values;
+  for (Eigen::Index sample = 0; sample < numberOfSamples; ++sample) {
+    auto qAtPoint = init::QAtPoint::view::create(samples.data() + sample * PointSize);
 
-        receiver.output.push_back(receiverTime);
+    auto* value = values.data();
 #ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-           if (!std::isfinite(qAtPoint(sim, quantity))) {
-             logError()
-                 << "Detected Inf/NaN in receiver output at"
-                 << receiver.coordinates[0] << ","
-                 << receiver.coordinates[1] << ","
-                 << receiver.coordinates[2] << "."
-                 << "Aborting.";
-          }
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
+    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+      for (auto quantity : m_quantities) {
+        if (!std::isfinite(qAtPoint(sim, quantity))) {
+          logError()
+              << "Detected Inf/NaN in receiver output at"
+              << receiver.coordinates[0] << ","
+              << receiver.coordinates[1] << ","
+              << receiver.coordinates[2] << "."
+              << "Aborting.";
         }
+        *value++ = qAtPoint(sim, quantity);
+      }
+    }
 #else //MULTIPLE_SIMULATIONS
-        for (auto quantity : m_quantities) {
-          if (!std::isfinite(qAtPoint(quantity))) {
-            logError()
-                << "Detected Inf/NaN in receiver output at"
-                << receiver.coordinates[0] << ","
-                << receiver.coordinates[1] << ","
-                << receiver.coordinates[2] << "."
-                << "Aborting.";
-          }
-          receiver.output.push_back(qAtPoint(quantity));
-        }
-#endif //MULTITPLE_SIMULATIONS
-
-        receiverTime += m_samplingInterval;
+    for (auto quantity : m_quantities) {
+      if (!std::isfinite(qAtPoint(quantity))) {
+        logError()
+            << "Detected Inf/NaN in receiver output at"
+            << receiver.coordinates[0] << ","
+            << receiver.coordinates[1] << ","
+            << receiver.coordinates[2] << "."
+            << "Aborting.";
       }
+      *value++ = qAtPoint(quantity);
     }
+#endif //MULTITPLE_SIMULATIONS
+    recordSample(receiver, sampleTimes[sample], values.data());
   }
-  return receiverTime;
-#endif //USE_STP
 }
+#endif //USE_STP
+
+void seissol::kernels::ReceiverCluster::recordSample(Receiver& receiver,
+                                                      double sampleTime,
+                                                      real* values) const {
+  const auto numberOfValues = ncols() - 1;
+  if (m_decimation > 1) {
+    // Every sample passes through the filter, also the ones removed by the decimation
+    const auto stateSize = m_filter.stateSize();
+    for (size_t i = 0; i < numberOfValues; ++i) {
+      values[i] = m_filter.apply(values[i], receiver.filterState.data() + i * stateSize);
+    }
 
+    // The decimation phase is given by the global sample index, such that it does not depend
+    // on the time steps or on restarts from checkpoints
+    const auto sampleIndex = std::llround(sampleTime / m_samplingInterval);
+    if (sampleIndex % m_decimation != 0) {
+      return;
+    }
+  }
+
+  receiver.output.push_back(sampleTime);
+  receiver.output.insert(receiver.output.end(), values, values + numberOfValues);
+}
@@ -44,6 +44,7 @@
 #include <Eigen/Dense>
 #include <Geometry/MeshReader.h>
 #include <Numerical_aux/BasisFunction.h>
+#include <Numerical_aux/IIRFilter.h>
 #include <Initializer/tree/Lut.hpp>
 #include <Initializer/LTS.h>
 #include <Initializer/PointMapper.h>
@@ -58,36 +59,61 @@ namespace seissol {
       Receiver(unsigned pointId,
                Eigen::Vector3d coordinates,
                double xi, double eta, double zeta,
-               kernels::LocalData data, size_t reserved)
+               kernels::LocalData data, real* derivatives, size_t reserved)
           : pointId(pointId),
             coordinates(std::move(coordinates)),
             basisFunctions(CONVERGENCE_ORDER, xi, eta, zeta),
-            data(data) {
+            data(data),
+            derivatives(derivatives) {
         output.reserve(reserved);
       }
       unsigned pointId;
       Eigen::Vector3d coordinates;
       basisFunction::SampledBasisFunctions<real> basisFunctions;
       kernels::LocalData data;
+      //! Time derivatives stored by the local integration (nullptr if the cell does not store them)
+      real* derivatives;
       std::vector<real> output;
+      //! State of the anti-alias filter (filter state size values per output column without the time)
+      std::vector<double> filterState;
+    };
+
+    /** Receivers are low-pass filtered and only every factor-th sample is stored, if factor > 1.
+     */
+    struct ReceiverDecimation {
+      unsigned factor = 1;
+      //! Order of the Butterworth anti-alias filter (0 disables the filter)
+      unsigned filterOrder = 8;
+      //! Cutoff relative to the Nyquist frequency of the decimated samples
+      double cutoff = 0.8;
+    };
+
+    /** Selects the receivers which are evaluated by ReceiverCluster::calcReceivers.
+     *  Receivers in cells which store their time derivatives can reuse the derivatives
+     *  of the local integration, i.e. they need to be evaluated after the local integration.
+     *  All other receivers need the DOFs before they are updated by the local integration.
+     */
+    enum class ReceiverSelection {
+      //! Compute the time derivatives of all receivers
+      All,
+      //! Compute the time derivatives of receivers whose cell does not store them
+      WithoutStoredDerivatives,
+      //! Reuse the stored time derivatives
+      WithStoredDerivatives
     };
 
     class ReceiverCluster {
     public:
       ReceiverCluster()
         : m_nonZeroFlops(0), m_hardwareFlops(0),
-          m_samplingInterval(1.0e99), m_syncPointInterval(0.0)
+          m_samplingInterval(1.0e99), m_syncPointInterval(0.0), m_decimation(1)
       {}
 
       ReceiverCluster(  GlobalData const*             global,
                         std::vector<unsigned> const&  quantities,
                         double                        samplingInterval,
-                        double                        syncPointInterval )
-        : m_quantities(quantities),
-          m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval) {
-        m_timeKernel.setHostGlobalData(global);
-        m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
-      }
+                        double                        syncPointInterval,
+                        ReceiverDecimation const&     decimation = ReceiverDecimation() );
 
       void addReceiver( unsigned          meshId,
                         unsigned          pointId,
@@ -99,7 +125,8 @@ namespace seissol {
       //! Returns new receiver time
       double calcReceivers( double time,
                             double expansionPoint,
-                            double timeStepWidth );
+                            double timeStepWidth,
+                            ReceiverSelection selection = ReceiverSelection::All );
 
       std::vector<Receiver>::iterator begin() {
         return m_receivers.begin();
@@ -109,6 +136,23 @@ namespace seissol {
         return m_receivers.end();
       }
 
+      std::vector<Receiver>::const_iterator begin() const {
+        return m_receivers.begin();
+      }
+
+      std::vector<Receiver>::const_iterator end() const {
+        return m_receivers.end();
+      }
+
+      size_t numberOfReceivers() const {
+        return m_receivers.size();
+      }
+
+      //! Number of filter state values of each receiver
+      size_t filterStateSize() const {
+        return m_filter.stateSize() * (ncols() - 1);
+      }
+
       size_t ncols() const {
         size_t ncols = m_quantities.size();
 #ifdef MULTIPLE_SIMULATIONS
@@ -118,6 +162,28 @@ namespace seissol {
       }
 
     private:
+      //! Scratch memory of one thread, reused for all receivers and time steps
+      struct ReceiverScratch {
+        //! Values of all quantities at the receiver for all samples of a time step
+        std::vector<real> samples;
+        //! Values of one sample (without the time)
+        std::vector<real> values;
+      };
+
+      //! Scratch memory of the calling thread
+      ReceiverScratch& scratch();
+
+#ifndef USE_STP
+      //! Evaluates the time derivatives at the receiver and all samples with one matrix product
+      void evaluateReceiver(Receiver& receiver,
+                            real const* timeDerivatives,
+                            std::vector<double> const& sampleTimes);
+#endif
+
+      //! Filters the values of one sample (all columns without the time) and stores them if the
+      //! sample is not removed by the decimation
+      void recordSample(Receiver& receiver, double sampleTime, real* values) const;
+
       std::vector<Receiver> m_receivers;
       seissol::kernels::Time m_timeKernel;
       std::vector<unsigned> m_quantities;
@@ -125,7 +191,13 @@ namespace seissol {
       unsigned m_hardwareFlops;
       double m_samplingInterval;
       double m_syncPointInterval;
-
+      unsigned m_decimation;
+      filter::IIRCascade m_filter;
+      //! Sampling times of the current time step
+      std::vector<double> m_sampleTimes;
+      //! Taylor coefficients of the samples of the current time step (samples x derivatives)
+      std::vector<real> m_taylorCoefficients;
+      std::vector<ReceiverScratch> m_scratch;
     };
   }
 }
@@ -39,6 +39,7 @@
  **/
 
 #include "TimeCommon.h"
+#include "MixedPrecision.h"
 #include <stdint.h>
 
 void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
@@ -48,7 +49,8 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
                                                     double i_timeStepWidth,
                                                     real * const i_timeDofs[4],
                                                     real o_integrationBuffer[4][tensor::I::size()],
-                                                    real * o_timeIntegrated[4] )
+                                                    real * o_timeIntegrated[4],
+                                                    bool i_reducedPrecisionBuffers )
 {
   /*
    * assert valid input.
@@ -73,7 +75,16 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
 	i_faceTypes[l_dofeighbor] != FaceType::dynamicRupture) {
       // check if the time integration is already done (-> copy pointer)
       if( (i_ltsSetup >> l_dofeighbor ) % 2 == 0 ) {
-        o_timeIntegrated[l_dofeighbor] = i_timeDofs[l_dofeighbor];
+        if( i_reducedPrecisionBuffers ) {
+          // convert the buffer to the full precision on load
+          mixed_precision::decompress( mixed_precision::reducedBuffer( i_timeDofs[l_dofeighbor] ),
+                                       o_integrationBuffer[l_dofeighbor],
+                                       tensor::I::size() );
+          o_timeIntegrated[l_dofeighbor] = o_integrationBuffer[ l_dofeighbor];
+        }
+        else {
+          o_timeIntegrated[l_dofeighbor] = i_timeDofs[l_dofeighbor];
+        }
       }
       // integrate the DOFs in time via the derivatives and set pointer to local buffer
       else {
@@ -96,7 +107,8 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
                                                     const double i_timeStepWidth,
                                                     real * const i_timeDofs[4],
                                                     real o_integrationBuffer[4][tensor::I::size()],
-                                                    real * o_timeIntegrated[4])
+                                                    real * o_timeIntegrated[4],
+                                                    bool i_reducedPrecisionBuffers)
 {
   double l_startTimes[5];
   l_startTimes[0] = i_timeStepStart;
@@ -117,7 +129,8 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
                     i_timeStepWidth,
                     i_timeDofs,
                     o_integrationBuffer,
-                    o_timeIntegrated );
+                    o_timeIntegrated,
+                    i_reducedPrecisionBuffers );
 }
 
 void seissol::kernels::TimeCommon::computeBatchedIntegrals(Time& i_time,
@@ -151,6 +164,27 @@ void seissol::kernels::TimeCommon::computeBatchedIntegrals(Time& i_time,
                                   (entry.content[*EntityId::Idofs])->getSize());
   }
 #else
-  assert(false && "no implementation provided");
+  // Same batches on the host: each entry integrates one set of neighbor derivatives
+  auto integrate = [&](ComputationKind kind, double expansionPoint) {
+    ConditionalKey key(*KernelNames::NeighborFlux, *kind);
+    if(table.find(key) != table.end()) {
+      BatchTable &entry = table[key];
+      real** derivatives = (entry.content[*EntityId::Derivatives])->getPointers();
+      real** idofs = (entry.content[*EntityId::Idofs])->getPointers();
+      const unsigned numElements = (entry.content[*EntityId::Idofs])->getSize();
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (unsigned element = 0; element < numElements; ++element) {
+        i_time.computeIntegral(expansionPoint,
+                               i_timeStepStart,
+                               i_timeStepStart + i_timeStepWidth,
+                               derivatives[element],
+                               idofs[element]);
+      }
+    }
+  };
+  integrate(ComputationKind::WithGtsDerivatives, i_timeStepStart);
+  integrate(ComputationKind::WithLtsDerivatives, 0.0);
 #endif
 }
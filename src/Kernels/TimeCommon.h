@@ -71,6 +71,7 @@ namespace seissol {
        * @param i_timeDofs pointers to time integrated buffers or time derivatives of the four neighboring cells.
        * @param i_integrationBuffer memory where the time integration goes if derived from derivatives. Ensure thread safety!
        * @param o_timeIntegrated pointers to the time integrated DOFs of the four neighboring cells (either local integration buffer or integration buffer of input).
+       * @param i_reducedPrecisionBuffers true if the time integrated buffers are stored in reduced precision; these are converted to the integration buffer.
        **/
       void computeIntegrals(Time& i_time,
                             unsigned short i_ltsSetup,
@@ -79,7 +80,8 @@ namespace seissol {
                             double i_timeStepWidth,
                             real * const i_timeDofs[4],
                             real o_integrationBuffer[4][tensor::I::size()],
-                            real * o_timeIntegrated[4]);
+                            real * o_timeIntegrated[4],
+                            bool i_reducedPrecisionBuffers = false);
 
       /**
        * Special case of the computeIntegrals function, which assumes a common "current time" for all face neighbors which provide derivatives.
@@ -91,6 +93,7 @@ namespace seissol {
        * @param i_timeDofs pointers to time integrated buffers or time derivatives of the four neighboring cells.
        * @param i_integrationBuffer memory where the time integration goes if derived from derivatives. Ensure thread safety!
        * @param o_timeIntegrated pointers to the time integrated DOFs of the four neighboring cells (either local integration buffer or integration buffer of input).
+       * @param i_reducedPrecisionBuffers true if the time integrated buffers are stored in reduced precision.
        **/
       void computeIntegrals(Time& i_time,
                             unsigned short i_ltsSetup,
@@ -99,7 +102,8 @@ namespace seissol {
                             const double i_timeStepWidth,
                             real * const i_timeDofs[4],
                             real o_integrationBuffer[4][tensor::I::size()],
-                            real * o_timeIntegrated[4]);
+                            real * o_timeIntegrated[4],
+                            bool i_reducedPrecisionBuffers = false);
 
       void computeBatchedIntegrals(Time& i_time,
                                    const double i_timeStepStart,
@@ -51,6 +51,24 @@
 #include "Monitoring/Stopwatch.h"
 #include <utils/env.h>
 
+std::size_t seissol::LoopStatistics::accumulate(unsigned region,
+                                               std::size_t firstSample,
+                                               std::vector<double>& timePerSubRegion,
+                                               std::vector<double>& iterationsPerSubRegion) {
+  std::lock_guard<std::mutex> lock(m_timesMutex);
+  auto const& samples = m_times[region];
+  for (std::size_t i = firstSample; i < samples.size(); ++i) {
+    auto const& sample = samples[i];
+    if (sample.subRegion >= timePerSubRegion.size()) {
+      timePerSubRegion.resize(sample.subRegion + 1, 0.0);
+      iterationsPerSubRegion.resize(sample.subRegion + 1, 0.0);
+    }
+    timePerSubRegion[sample.subRegion] += seconds(difftime(sample.begin, sample.end));
+    iterationsPerSubRegion[sample.subRegion] += sample.numIters;
+  }
+  return samples.size();
+}
+
 #ifdef USE_MPI  
 void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
   unsigned const nRegions = m_times.size();
@@ -97,6 +115,9 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
 
   MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
 
+  auto skippedIters = m_skippedIters;
+  MPI_Allreduce(MPI_IN_PLACE, skippedIters.data(), skippedIters.size(), MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
   auto regressionCoeffs = std::vector<double>(2*nRegions);
   auto stderror = std::vector<double>(nRegions, 0.0);
   for (unsigned region = 0; region < nRegions; ++region) {
@@ -150,6 +171,11 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
                       << "(sample size:" << N << ", standard error:" << se << ")";
       }
       totalTime += y;
+
+      if (skippedIters[region] > 0) {
+        logInfo(rank) << m_regions[region] << "(skipped iterations):"
+                      << 100.0 * skippedIters[region] / x << "%";
+      }
     }
 
     logInfo(rank) << "Total time spent in compute kernels:" << totalTime;
@@ -45,6 +45,7 @@
 #include <unordered_map>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <time.h>
 #include <vector>
 
@@ -60,6 +61,7 @@ public:
     m_begin.push_back(timespec{});
     m_times.emplace_back();
     m_includeInSummary.push_back(includeInSummary);
+    m_skippedIters.push_back(0);
   }
   
   unsigned getRegion(std::string const& name) {
@@ -79,9 +81,13 @@ public:
     sample.begin = m_begin[region];
     sample.numIters = numIterations;
     sample.subRegion = subRegion;
+    std::lock_guard<std::mutex> lock(m_timesMutex);
     m_times[region].push_back(sample);
   }
 
+  /**
+   * Thread-safe alternative to begin/end, e.g. for concurrently executed clusters.
+   */
   void addSample(unsigned region, unsigned numIters, unsigned subRegion,
                  timespec begin, timespec end) {
     Sample sample;
@@ -89,9 +95,30 @@ public:
     sample.end = std::move(end);
     sample.numIters = numIters;
     sample.subRegion = subRegion;
+    std::lock_guard<std::mutex> lock(m_timesMutex);
     m_times[region].push_back(sample);
   }
 
+  /**
+   * Counts iterations of a region which were handled by a reduced kernel (e.g. locked
+   * dynamic rupture faces). The fraction of skipped iterations is part of the summary.
+   */
+  void addSkippedIterations(unsigned region, unsigned numSkippedIters) {
+    std::lock_guard<std::mutex> lock(m_timesMutex);
+    m_skippedIters[region] += numSkippedIters;
+  }
+
+  /**
+   * Sums the time and the number of iterations per sub region over the samples of a region,
+   * starting with sample firstSample. The vectors are enlarged if required.
+   *
+   * @return Number of samples of the region, i.e. the first sample of the next call.
+   */
+  std::size_t accumulate(unsigned region,
+                         std::size_t firstSample,
+                         std::vector<double>& timePerSubRegion,
+                         std::vector<double>& iterationsPerSubRegion);
+
 #ifdef USE_MPI  
   void printSummary(MPI_Comm comm);
 #endif
@@ -110,6 +137,8 @@ private:
   std::vector<std::string> m_regions;
   std::vector<std::vector<Sample>> m_times;
   std::vector<bool> m_includeInSummary;
+  std::vector<unsigned long> m_skippedIters;
+  std::mutex m_timesMutex;
 };
 }
 
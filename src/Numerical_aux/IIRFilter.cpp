@@ -0,0 +1,35 @@
+#include "IIRFilter.h"
+
+#include <cmath>
+
+#include "utils/logger.h"
+
+std::vector<seissol::filter::Biquad> seissol::filter::designButterworthLowPass(unsigned order,
+                                                                              double cutoff) {
+  if (order % 2 != 0) {
+    logError() << "The order of the Butterworth filter must be even, got" << order;
+  }
+  if (cutoff <= 0.0 || cutoff >= 0.5) {
+    logError() << "The cutoff of the Butterworth filter must be between 0 and the Nyquist frequency.";
+  }
+
+  // Prewarped analog cutoff
+  const double k = std::tan(M_PI * cutoff);
+
+  std::vector<Biquad> sections;
+  sections.reserve(order / 2);
+  for (unsigned i = 0; i < order / 2; ++i) {
+    // Quality factor of the i-th pair of Butterworth poles
+    const double q = 1.0 / (2.0 * std::cos(M_PI * (2 * i + 1) / (2.0 * order)));
+    const double norm = 1.0 / (1.0 + k / q + k * k);
+
+    Biquad section{};
+    section.b0 = k * k * norm;
+    section.b1 = 2.0 * section.b0;
+    section.b2 = section.b0;
+    section.a1 = 2.0 * (k * k - 1.0) * norm;
+    section.a2 = (1.0 - k / q + k * k) * norm;
+    sections.push_back(section);
+  }
+  return sections;
+}
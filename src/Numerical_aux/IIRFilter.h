@@ -0,0 +1,62 @@
+#ifndef SEISSOL_IIRFILTER_H
+#define SEISSOL_IIRFILTER_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace seissol::filter {
+
+/**
+ * Second order section: H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ */
+struct Biquad {
+  double b0;
+  double b1;
+  double b2;
+  double a1;
+  double a2;
+};
+
+/**
+ * Designs a Butterworth low-pass filter as a cascade of second order sections
+ * (bilinear transform with prewarping).
+ *
+ * @param order Filter order (must be even)
+ * @param cutoff Cutoff frequency relative to the sampling frequency (0 < cutoff < 0.5)
+ */
+std::vector<Biquad> designButterworthLowPass(unsigned order, double cutoff);
+
+/**
+ * Cascade of second order sections. The filter itself is stateless, the caller owns the state
+ * (stateSize() values per filtered signal), such that the state can be stored with the signal.
+ */
+class IIRCascade {
+  public:
+  IIRCascade() = default;
+
+  explicit IIRCascade(std::vector<Biquad> sections) : sections(std::move(sections)) {}
+
+  [[nodiscard]] std::size_t stateSize() const { return 2 * sections.size(); }
+
+  /**
+   * Filters one sample (transposed direct form II) and updates the state.
+   */
+  double apply(double x, double* state) const {
+    for (const auto& section : sections) {
+      const double y = section.b0 * x + state[0];
+      state[0] = section.b1 * x - section.a1 * y + state[1];
+      state[1] = section.b2 * x - section.a2 * y;
+      state += 2;
+      x = y;
+    }
+    return x;
+  }
+
+  private:
+  std::vector<Biquad> sections;
+};
+
+} // namespace seissol::filter
+
+#endif // SEISSOL_IIRFILTER_H
@@ -340,7 +340,7 @@ MODULE TypesDef
  END TYPE tPMLayer
 
   TYPE tGalerkin
-    INTEGER           :: clusteredLts                !< 0 = file, 1 = GTS, 2-n: multi-rate
+    INTEGER           :: clusteredLts                !< 0 = automatic multi-rate, 1 = GTS, 2-n: multi-rate
     INTEGER           :: ltsWeightTypeId             !< 0 = exponential, 1 = balanced exponential, 2 = encoded
     INTEGER           :: CKMethod                    !< 0 = regular CK
                                                      !< 1 = local space-time DG
@@ -955,6 +955,7 @@ MODULE TypesDef
      INTEGER                                :: AbortStatus                      !< 0 = regular
                                                                                 !< 1 = lack of CPU time
                                                                                 !< 2 = other error
+     LOGICAL                                :: MemoryDryRun = .FALSE.           !< Initialization stopped after the memory layout (SEISSOL_MEMORY_DRY_RUN)
 !     LOGICAL                                :: MetisWeights                     !< Run Seissol to compute METIS weights only
      INTEGER                                :: FaultOutputFlag                  !< Flag if fault output is required or not (1 or 0)
 #ifdef HDF
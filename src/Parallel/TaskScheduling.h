@@ -0,0 +1,70 @@
+#ifndef SEISSOL_TASKSCHEDULING_H
+#define SEISSOL_TASKSCHEDULING_H
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "utils/env.h"
+
+namespace seissol::parallel {
+
+/**
+ * Returns true if the time clusters should be executed as concurrent OpenMP tasks
+ * instead of one cluster at a time (SEISSOL_TASK_BASED_SCHEDULING=1).
+ * Only available for CPU builds with OpenMP.
+ */
+inline bool useTaskBasedScheduling() {
+#if defined(_OPENMP) && !defined(ACL_DEVICE)
+  static const bool useTasks = utils::Env::get<int>("SEISSOL_TASK_BASED_SCHEDULING", 0) != 0;
+  return useTasks;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Number of cells (or faces) which are processed by one task (SEISSOL_TASK_CHUNK_SIZE).
+ */
+inline unsigned taskChunkSize() {
+  static const unsigned chunkSize =
+      std::max(1u, utils::Env::get<unsigned>("SEISSOL_TASK_CHUNK_SIZE", 256u));
+  return chunkSize;
+}
+
+/**
+ * Calls body(i) for all i in [0, size).
+ *
+ * Outside of a parallel region, this is a statically scheduled worksharing loop, i.e. it behaves
+ * exactly like a plain "omp parallel for". If called from within a task (task-based cluster
+ * scheduling), the range is split into chunks of taskChunkSize() iterations which are executed as
+ * tasks, such that chunks of different clusters may run concurrently.
+ * The function returns once all iterations are done.
+ */
+template <typename F>
+void forEach(unsigned size, F&& body) {
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const unsigned chunkSize = taskChunkSize();
+    const unsigned numberOfChunks = (size + chunkSize - 1) / chunkSize;
+#pragma omp taskloop grainsize(1) default(shared)
+    for (unsigned chunk = 0; chunk < numberOfChunks; ++chunk) {
+      const unsigned end = std::min(size, (chunk + 1) * chunkSize);
+      for (unsigned i = chunk * chunkSize; i < end; ++i) {
+        body(i);
+      }
+    }
+    return;
+  }
+#pragma omp parallel for schedule(static)
+#endif
+  for (unsigned i = 0; i < size; ++i) {
+    body(i);
+  }
+}
+
+} // namespace seissol::parallel
+
+#endif // SEISSOL_TASKSCHEDULING_H
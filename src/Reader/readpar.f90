@@ -726,7 +726,8 @@ CONTAINS
     INTENT(INOUT)                          :: IO, EQN, DISC, BND, MPI
     INTEGER                                :: FL, BackgroundType, Nucleation, RF_output_on, DS_output_on, &
                                               OutputPointType, read_fault_file,refPointMethod, &
-                                              thermalPress, SlipRateOutputType, readStat
+                                              thermalPress, SlipRateOutputType, readStat, &
+                                              RS_NewtonFaceBlocks, TP_GridPoints
     LOGICAL                                :: fileExists
 
     CHARACTER(600)                         :: FileName_BackgroundStress
@@ -746,7 +747,7 @@ CONTAINS
                                                 RS_sr0, RS_b, RS_iniSlipRate1, RS_iniSlipRate2, pc_vstar, &
                                                 thermalPress, TP_thermalDiffusivity, TP_heatCapacity, TP_undrainedTPResponse, TP_IniTemp, TP_IniPressure, &
                                                 pc_prakashLength, t_0, RS_muW, NucRS_sv0, r_s, RF_output_on, DS_output_on, &
-                                                OutputPointType, SlipRateOutputType, ModelFileName
+                                                OutputPointType, SlipRateOutputType, ModelFileName, RS_NewtonFaceBlocks, TP_GridPoints
     !------------------------------------------------------------------------
 
     ! Setting default values
@@ -773,6 +774,7 @@ CONTAINS
     t_0 = 0
     pc_prakashLength = 0
     RS_muW = 0
+    RS_NewtonFaceBlocks = 1
     NucRS_sv0 = 0
     r_s = 0
     thermalPress = 0
@@ -781,6 +783,7 @@ CONTAINS
     TP_undrainedTPResponse = 0
     TP_IniTemp = 0.0d0
     TP_IniPressure = 0.0d0
+    TP_GridPoints = 60
     ModelFileName = ''
 
     !FileName_BackgroundStress = 'tpv16_input_file.txt'
@@ -1898,6 +1901,10 @@ ALLOCATE( SpacePositionx(nDirac), &
     INTEGER                    :: vertexWeightElement
     INTEGER                    :: vertexWeightDynamicRupture
     INTEGER                    :: vertexWeightFreeSurfaceWithGravity
+    INTEGER                    :: vertexWeightCalibration
+    CHARACTER(LEN=600)         :: vertexWeightCacheFile
+    CHARACTER(LEN=600)         :: measuredCostsFile
+    REAL                       :: loadImbalanceThreshold
     CHARACTER(LEN=600)          :: Name
     LOGICAL                    :: file_exits
     !------------------------------------------------------------------------
@@ -1911,7 +1918,9 @@ ALLOCATE( SpacePositionx(nDirac), &
     NAMELIST                         /MeshNml/ MeshFile, meshgenerator, periodic, &
                                             periodic_direction, displacement, ScalingMatrixX, &
                                             ScalingMatrixY, ScalingMatrixZ, &
-                                            vertexWeightElement, vertexWeightDynamicRupture, vertexWeightFreeSurfaceWithGravity
+                                            vertexWeightElement, vertexWeightDynamicRupture, vertexWeightFreeSurfaceWithGravity, &
+                                            vertexWeightCalibration, vertexWeightCacheFile, &
+                                            measuredCostsFile, loadImbalanceThreshold
     !------------------------------------------------------------------------
     !
     logInfo(*) '<--------------------------------------------------------->'
@@ -1938,6 +1947,10 @@ ALLOCATE( SpacePositionx(nDirac), &
     vertexWeightElement = 100
     vertexWeightDynamicRupture = 100
     vertexWeightFreeSurfaceWithGravity = 100
+    vertexWeightCalibration = 0
+    vertexWeightCacheFile = ''
+    measuredCostsFile = ''
+    loadImbalanceThreshold = 0.1
     !
     READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = MeshNml)
     IF (readStat.NE.0) THEN
@@ -2128,7 +2141,7 @@ ALLOCATE( SpacePositionx(nDirac), &
     disc%galerkin%clusteredLts = ClusteredLts
     select case( disc%galerkin%clusteredLts )
     case(0)
-      logError(*) 'TODO: Using clustered LTS with clustering provided file input'
+      logInfo(*) 'Using multi-rate clustered LTS with automatic rate selection'
     case(1)
       logInfo(*) 'Using GTS'
     case default
@@ -2136,7 +2149,7 @@ ALLOCATE( SpacePositionx(nDirac), &
     endselect
 
     disc%galerkin%ltsWeightTypeId = LtsWeightTypeId
-    if ((DISC%Galerkin%clusteredLts > 0) .and. (DISC%Galerkin%ltsWeightTypeId > 0)) then
+    if ((DISC%Galerkin%clusteredLts .ge. 0) .and. (DISC%Galerkin%ltsWeightTypeId > 0)) then
         logInfo(*) 'Using memory balancing for LTS scheme of type', DISC%Galerkin%ltsWeightTypeId
     end if
 
@@ -2268,6 +2281,15 @@ ALLOCATE( SpacePositionx(nDirac), &
       !!
       character(LEN=64)                :: checkPointBackend
       character(LEN=64)                :: xdmfWriterBackend
+      !> The receiver output back-end ('ascii' or 'binary'), evaluated in ReceiverWriter
+      character(LEN=64)                :: ReceiverOutputBackend
+      !> Decimation factor and anti-alias filter order of the receivers, evaluated in ReceiverCluster
+      INTEGER                          :: ReceiverDecimation
+      INTEGER                          :: ReceiverFilterOrder
+      !> The precision of the wave field and free surface output ('native' or 'float32') and the
+      !> number of mantissa bits kept in float32 output (0: all), evaluated in PrecisionXdmfWriter
+      character(LEN=64)                :: OutputPrecision
+      INTEGER                          :: OutputSignificantBits
       INTEGER                          :: EnergyOutput
       INTEGER                          :: EnergyTerminalOutput
       real                             :: EnergyOutputInterval
@@ -2278,7 +2300,9 @@ ALLOCATE( SpacePositionx(nDirac), &
                                                 FaultOutputFlag, &
                                                 checkPointInterval, checkPointFile, checkPointBackend, OutputRegionBounds, OutputGroups, IntegrationMask, &
                                                 SurfaceOutput, SurfaceOutputRefinement, SurfaceOutputInterval, xdmfWriterBackend, &
-                                                ReceiverOutputInterval, nRecordPoints, &
+                                                OutputPrecision, OutputSignificantBits, &
+                                                ReceiverOutputInterval, nRecordPoints, ReceiverOutputBackend, &
+                                                ReceiverDecimation, ReceiverFilterOrder, &
                                                 EnergyOutput, EnergyTerminalOutput, EnergyOutputInterval
 
               !------------------------------------------------------------------------
@@ -2314,6 +2338,11 @@ ALLOCATE( SpacePositionx(nDirac), &
       SurfaceOutputRefinement = 0
       SurfaceOutputInterval = 1.0e99
       ReceiverOutputInterval = 1.0e99
+      ReceiverOutputBackend = 'ascii'
+      ReceiverDecimation = 1
+      ReceiverFilterOrder = 8
+      OutputPrecision = 'native'
+      OutputSignificantBits = 0
       iPlasticityMask(1:6) = 0
       iPlasticityMask(7) = 1
 
@@ -2705,6 +2734,8 @@ ALLOCATE( SpacePositionx(nDirac), &
             call exit(134)
 #endif
             logInfo0(*) 'Using SIONlib checkpoint backend'
+        case ("compressed")
+            logInfo0(*) 'Using compressed checkpoint backend'
         case ("none")
             io%checkpoint%interval = 0
         case default
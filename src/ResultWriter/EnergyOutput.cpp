@@ -1,4 +1,9 @@
 #include "EnergyOutput.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
 #include <Kernels/DynamicRupture.h>
 #include <Numerical_aux/Quadrature.h>
 #include "DynamicRupture/Misc.h"
@@ -58,6 +63,31 @@ void EnergyOutput::init(GlobalData* newGlobal,
 
   isPlasticityEnabled = newIsPlasticityEnabled;
 
+  const auto& elements = meshReader->getElements();
+  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
+    const auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
+    if (std::any_of(std::begin(cellInformation.faceTypes),
+                    std::end(cellInformation.faceTypes),
+                    [](FaceType faceType) { return faceType == FaceType::freeSurfaceGravity; })) {
+      gravitationalElements.push_back(elementId);
+    }
+  }
+
+#ifndef ACL_DEVICE
+  // Cell volumes in the order of the DOFs of the LTS tree
+  const auto& vertices = meshReader->getVertices();
+  const auto numberOfCells = ltsTree->getNumberOfCells(lts->dofs.mask);
+  std::vector<double> cellVolumes(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    const auto meshId = ltsLut->meshId(lts->dofs.mask, cell);
+    if (meshId != std::numeric_limits<unsigned>::max()) {
+      cellVolumes[cell] = MeshTools::volume(elements[meshId], vertices);
+    }
+  }
+  SeisSol::main.timeManager().getEnergyAccumulator().init(
+      global, reinterpret_cast<const real*>(ltsTree->var(lts->dofs)), std::move(cellVolumes));
+#endif
+
   Modules::registerHook(*this, SIMULATION_START);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
   setSyncInterval(newSyncPointInterval);
@@ -67,8 +97,10 @@ void EnergyOutput::syncPoint(double time) {
   assert(isEnabled);
   const auto rank = MPI::mpi.rank();
   logInfo(rank) << "Writing energy output at time" << time;
-  computeEnergies();
+  computeEnergies(time);
   reduceEnergies();
+  // The next energies are accumulated by the time clusters
+  SeisSol::main.timeManager().getEnergyAccumulator().request(time + syncInterval());
   if (isTerminalOutputEnabled) {
     printEnergies();
   }
@@ -180,114 +212,70 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
   }
 }
 
-void EnergyOutput::computeEnergies() {
-  energiesStorage.energies.fill(0.0);
+void EnergyOutput::computeVolumeEnergies(VolumeEnergies& volumeEnergies) {
+  double acousticEnergy = 0.0;
+  double acousticKineticEnergy = 0.0;
+  double elasticEnergy = 0.0;
+  double elasticKineticEnergy = 0.0;
+  double plasticMoment = 0.0;
+
+  std::vector<Element> const& elements = meshReader->getElements();
+  std::vector<Vertex> const& vertices = meshReader->getVertices();
+
+#if defined(_OPENMP) && !defined(__NVCOMPILER)
+#pragma omp parallel for schedule(static) reduction(+ : acousticEnergy, acousticKineticEnergy, elasticEnergy, elasticKineticEnergy, plasticMoment) shared(elements, vertices, lts, ltsLut, global)
+#endif
+  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
+    const real volume = MeshTools::volume(elements[elementId], vertices);
+    const CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
+    const real* pstrain = isPlasticityEnabled
+                              ? static_cast<const real*>(ltsLut->lookup(lts->pstrain, elementId))
+                              : nullptr;
+
+    VolumeEnergies cellEnergies;
+    addCellEnergies(
+        global, ltsLut->lookup(lts->dofs, elementId), pstrain, material, volume, cellEnergies);
+    acousticEnergy += cellEnergies.acousticEnergy;
+    acousticKineticEnergy += cellEnergies.acousticKineticEnergy;
+    elasticEnergy += cellEnergies.elasticEnergy;
+    elasticKineticEnergy += cellEnergies.elasticKineticEnergy;
+    plasticMoment += cellEnergies.plasticMoment;
+  }
 
+  volumeEnergies.acousticEnergy = acousticEnergy;
+  volumeEnergies.acousticKineticEnergy = acousticKineticEnergy;
+  volumeEnergies.elasticEnergy = elasticEnergy;
+  volumeEnergies.elasticKineticEnergy = elasticKineticEnergy;
+  volumeEnergies.plasticMoment = plasticMoment;
+}
+
+void EnergyOutput::computeGravitationalEnergy() {
+#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
   auto& totalGravitationalEnergyLocal = energiesStorage.gravitationalEnergy();
-  auto& totalAcousticEnergyLocal = energiesStorage.acousticEnergy();
-  auto& totalAcousticKineticEnergyLocal = energiesStorage.acousticKineticEnergy();
-  auto& totalElasticEnergyLocal = energiesStorage.elasticEnergy();
-  auto& totalElasticKineticEnergyLocal = energiesStorage.elasticKineticEnergy();
-  auto& totalPlasticMoment = energiesStorage.plasticMoment();
 
   std::vector<Element> const& elements = meshReader->getElements();
   std::vector<Vertex> const& vertices = meshReader->getVertices();
 
   const auto g = SeisSol::main.getGravitationSetup().acceleration;
 
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+  double quadraturePointsTri[numQuadraturePointsTri][2];
+  double quadratureWeightsTri[numQuadraturePointsTri];
+  seissol::quadrature::TriangleQuadrature(
+      quadraturePointsTri, quadratureWeightsTri, quadPolyDegree);
+
   // Note: Default(none) is not possible, clang requires data sharing attribute for g, gcc forbids
   // it
 #if defined(_OPENMP) && !defined(__NVCOMPILER)
-#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal, totalAcousticEnergyLocal, totalAcousticKineticEnergyLocal, totalElasticEnergyLocal, totalElasticKineticEnergyLocal, totalPlasticMoment) shared(elements, vertices, lts, ltsLut, global)
+#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal) shared(elements, vertices, lts, ltsLut, quadratureWeightsTri)
 #endif
-  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
-    real volume = MeshTools::volume(elements[elementId], vertices);
+  for (std::size_t i = 0; i < gravitationalElements.size(); ++i) {
+    const auto elementId = gravitationalElements[i];
     CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
-#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
     auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
     auto& faceDisplacements = ltsLut->lookup(lts->faceDisplacements, elementId);
 
-    constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
-    constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
-
-    double quadraturePointsTet[numQuadraturePointsTet][3];
-    double quadratureWeightsTet[numQuadraturePointsTet];
-    seissol::quadrature::TetrahedronQuadrature(
-        quadraturePointsTet, quadratureWeightsTet, quadPolyDegree);
-
-    constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
-    double quadraturePointsTri[numQuadraturePointsTri][2];
-    double quadratureWeightsTri[numQuadraturePointsTri];
-    seissol::quadrature::TriangleQuadrature(
-        quadraturePointsTri, quadratureWeightsTri, quadPolyDegree);
-
-    // Needed to weight the integral.
-    const auto jacobiDet = 6 * volume;
-
-    alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
-    auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
-    // Evaluate numerical solution at quad. nodes
-    kernel::evalAtQP krnl;
-    krnl.evalAtQP = global->evalAtQPMatrix;
-    krnl.dofsQP = numericalSolutionData;
-    krnl.Q = ltsLut->lookup(lts->dofs, elementId);
-    krnl.execute();
-
-#ifdef MULTIPLE_SIMULATIONS
-    auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
-#else
-    auto numSub = numericalSolution;
-#endif
-    for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
-      constexpr int uIdx = 6;
-      const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
-      const auto rho = material.local.rho;
-
-      const auto u = numSub(qp, uIdx + 0);
-      const auto v = numSub(qp, uIdx + 1);
-      const auto w = numSub(qp, uIdx + 2);
-      const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
-
-      if (std::abs(material.local.mu) < 10e-14) {
-        // Acoustic
-        constexpr int pIdx = 0;
-        const auto K = material.local.lambda;
-        const auto p = numSub(qp, pIdx);
-
-        const double curAcousticEnergy = (p * p) / (2 * K);
-        totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
-        totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
-      } else {
-        // Elastic
-        totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
-        auto getStressIndex = [](int i, int j) {
-          const static auto lookup = std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
-          return lookup[i][j];
-        };
-        auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
-
-        const auto lambda = material.local.lambda;
-        const auto mu = material.local.mu;
-        const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
-        auto computeStrain = [&](int i, int j) {
-          double strain = 0.0;
-          const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
-          if (i == j) {
-            strain += factor * sumUniaxialStresses;
-          }
-          strain += 1.0 / (2.0 * mu) * getStress(i, j);
-          return strain;
-        };
-        double curElasticEnergy = 0.0;
-        for (int i = 0; i < 3; ++i) {
-          for (int j = 0; j < 3; ++j) {
-            curElasticEnergy += getStress(i, j) * computeStrain(i, j);
-          }
-        }
-        totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
-      }
-    }
-
     auto* boundaryMappings = ltsLut->lookup(lts->boundaryMapping, elementId);
     // Compute gravitational energy
     for (int face = 0; face < 4; ++face) {
@@ -336,20 +324,28 @@ void EnergyOutput::computeEnergies() {
         totalGravitationalEnergyLocal += curWeight * curEnergy;
       }
     }
+  }
 #endif
+}
 
-    if (isPlasticityEnabled) {
-      // plastic moment
-      real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
-#ifdef USE_ANISOTROPIC
-      real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
-#else
-      real mu = material.local.mu;
-#endif
-      totalPlasticMoment += mu * volume * pstrainCell[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
-    }
+void EnergyOutput::computeEnergies(double time) {
+  energiesStorage.energies.fill(0.0);
+
+  // The volume energies were accumulated by the time clusters if this is a regular output time,
+  // otherwise (e.g. at the start of the simulation) they are computed here
+  auto& timeManager = SeisSol::main.timeManager();
+  VolumeEnergies volumeEnergies;
+  if (!timeManager.getEnergyAccumulator().energies(
+          time, timeManager.getTimeTolerance(), volumeEnergies)) {
+    computeVolumeEnergies(volumeEnergies);
   }
+  energiesStorage.acousticEnergy() = volumeEnergies.acousticEnergy;
+  energiesStorage.acousticKineticEnergy() = volumeEnergies.acousticKineticEnergy;
+  energiesStorage.elasticEnergy() = volumeEnergies.elasticEnergy;
+  energiesStorage.elasticKineticEnergy() = volumeEnergies.elasticKineticEnergy;
+  energiesStorage.plasticMoment() = volumeEnergies.plasticMoment;
 
+  computeGravitationalEnergy();
   computeDynamicRuptureEnergies();
 }
 
@@ -5,6 +5,7 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include <Initializer/DynamicRupture.h>
@@ -13,6 +14,7 @@
 #include <Initializer/LTS.h>
 #include <Initializer/tree/Lut.hpp>
 
+#include "VolumeEnergy.h"
 #include "Modules/Module.h"
 #include "Modules/Modules.h"
 
@@ -67,7 +69,11 @@ class EnergyOutput : public Module {
 
   void computeDynamicRuptureEnergies();
 
-  void computeEnergies();
+  void computeVolumeEnergies(VolumeEnergies& volumeEnergies);
+
+  void computeGravitationalEnergy();
+
+  void computeEnergies(double time);
 
   void reduceEnergies();
 
@@ -93,6 +99,9 @@ class EnergyOutput : public Module {
   seissol::initializers::LTS* lts = nullptr;
   seissol::initializers::Lut* ltsLut = nullptr;
 
+  //! Elements with faces with a gravitational free surface boundary condition
+  std::vector<std::size_t> gravitationalElements;
+
   EnergiesStorage energiesStorage{};
 };
 
@@ -0,0 +1,139 @@
+#include "FaultReceiverWriter.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "Parallel/Pin.h"
+#include "SeisSol.h"
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+void FaultReceiverWriter::init(const std::string& outputPrefix,
+                               const std::vector<std::string>& columnNames,
+                               const std::vector<std::uint64_t>& receiverIds,
+                               const std::vector<std::array<double, 3>>& coordinates,
+                               std::uint64_t maxSamples) {
+  using namespace binary_fault_receiver;
+  assert(receiverIds.size() == coordinates.size());
+
+  const int rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Initializing binary fault receiver output.";
+
+  m_numberOfColumns = columnNames.size();
+  m_numberOfReceivers = receiverIds.size();
+  m_maxSamples = maxSamples;
+
+  // Initialize the asynchronous module
+  FaultReceiverAsyncModule::init();
+
+  // Everything of the file header following the fixed size part
+  std::vector<char> header(m_numberOfColumns * ColumnNameLength +
+                               m_numberOfReceivers * (sizeof(std::uint64_t) + 3 * sizeof(double)),
+                           '\0');
+  char* position = header.data();
+  for (const auto& name : columnNames) {
+    name.copy(position, ColumnNameLength - 1);
+    position += ColumnNameLength;
+  }
+  std::memcpy(position, receiverIds.data(), m_numberOfReceivers * sizeof(std::uint64_t));
+  position += m_numberOfReceivers * sizeof(std::uint64_t);
+  for (const auto& point : coordinates) {
+    std::memcpy(position, point.data(), 3 * sizeof(double));
+    position += 3 * sizeof(double);
+  }
+
+  unsigned int bufferId = addSyncBuffer(outputPrefix.c_str(), outputPrefix.size() + 1, true);
+  assert(bufferId == FaultReceiverWriterExecutor::OUTPUT_PREFIX); NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(header.data(), header.size(), true);
+  assert(bufferId == FaultReceiverWriterExecutor::HEADER);
+  bufferId = addBuffer(0L, segmentSize(m_maxSamples));
+  assert(bufferId == FaultReceiverWriterExecutor::SEGMENT);
+  seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer(
+      "async I/O", "fault receivers", segmentSize(m_maxSamples));
+
+  m_isPending = true;
+
+  logInfo(rank) << "Initializing binary fault receiver output. Done.";
+}
+
+void FaultReceiverWriter::open(bool isRestart, double restartTime) {
+  if (!m_isPending) {
+    return;
+  }
+
+  sendBuffer(FaultReceiverWriterExecutor::OUTPUT_PREFIX);
+  sendBuffer(FaultReceiverWriterExecutor::HEADER);
+
+  FaultReceiverWriterInitParam param;
+  param.numberOfColumns = m_numberOfColumns;
+  param.numberOfReceivers = m_numberOfReceivers;
+  param.rank = seissol::MPI::mpi.rank();
+  param.isRestart = isRestart ? 1 : 0;
+  param.restartTime = restartTime;
+  callInit(param);
+
+  removeBuffer(FaultReceiverWriterExecutor::OUTPUT_PREFIX);
+  removeBuffer(FaultReceiverWriterExecutor::HEADER);
+
+  m_isPending = false;
+  m_enabled = true;
+}
+
+double* FaultReceiverWriter::segmentBuffer() {
+  m_stopwatch.start();
+
+  // Wait until the previous segment is written
+  wait();
+
+  m_stopwatch.pause();
+
+  return FaultReceiverAsyncModule::managedBuffer<double*>(FaultReceiverWriterExecutor::SEGMENT);
+}
+
+void FaultReceiverWriter::sendSegment(std::uint64_t numberOfSamples) {
+  if (numberOfSamples > m_maxSamples) {
+    logError() << "Fault receiver segment exceeds the segment buffer.";
+  }
+
+  m_stopwatch.start();
+
+  sendBuffer(FaultReceiverWriterExecutor::SEGMENT, segmentSize(numberOfSamples));
+
+  FaultReceiverWriterParam param;
+  param.numberOfSamples = numberOfSamples;
+  call(param);
+
+  m_stopwatch.pause();
+}
+
+void FaultReceiverWriter::setUp() {
+  setExecutor(m_executor);
+  if (isAffinityNecessary()) {
+    const auto freeCpus = SeisSol::main.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Fault receiver writer thread affinity:"
+                                      << parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+    setAffinityIfNecessary(freeCpus);
+  }
+}
+
+void FaultReceiverWriter::close() {
+  if (m_enabled) {
+    wait();
+  }
+
+  finalize();
+
+  m_isPending = false;
+  if (!m_enabled) {
+    return;
+  }
+  m_enabled = false;
+
+  m_stopwatch.printTime("Time fault receiver writer frontend:");
+}
+
+} // namespace seissol::writer
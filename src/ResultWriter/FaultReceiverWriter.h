@@ -0,0 +1,98 @@
+#ifndef SEISSOL_FAULTRECEIVERWRITER_H
+#define SEISSOL_FAULTRECEIVERWRITER_H
+
+#include "Parallel/MPI.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "async/Module.h"
+
+#include "FaultReceiverWriterExecutor.h"
+#include "Modules/Module.h"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol::writer {
+
+/**
+ * Hands segments of the on-fault receiver cache to an asynchronous writer.
+ *
+ * The segment buffer is managed by ASYNC: While a segment is written in the background,
+ * the caller keeps filling its receiver cache. Only when the next segment is ready, the
+ * frontend waits for the previous write to complete.
+ */
+using FaultReceiverAsyncModule =
+    async::Module<FaultReceiverWriterExecutor, FaultReceiverWriterInitParam, FaultReceiverWriterParam>;
+
+class FaultReceiverWriter : private FaultReceiverAsyncModule, public seissol::Module {
+  public:
+  /**
+   * Collective on all ranks. The files are opened by open().
+   *
+   * @param columnNames Names of the columns (including the time)
+   * @param receiverIds Global (1-based) index of each local receiver
+   * @param coordinates Coordinates of each local receiver
+   * @param maxSamples Maximum number of samples per segment
+   */
+  void init(const std::string& outputPrefix,
+            const std::vector<std::string>& columnNames,
+            const std::vector<std::uint64_t>& receiverIds,
+            const std::vector<std::array<double, 3>>& coordinates,
+            std::uint64_t maxSamples);
+
+  /**
+   * Opens the files, once it is known whether the simulation restarts from a checkpoint.
+   * Collective on all ranks; does nothing if init was not called.
+   *
+   * @param isRestart Continue the existing files from restartTime instead of backing them up
+   */
+  void open(bool isRestart, double restartTime);
+
+  /**
+   * Waits until the previous segment is written.
+   *
+   * @return Buffer for the next segment with the layout
+   *  double times[samples], values[receivers][samples][columns - 1]
+   */
+  double* segmentBuffer();
+
+  /**
+   * Writes the segment in the segment buffer asynchronously.
+   */
+  void sendSegment(std::uint64_t numberOfSamples);
+
+  [[nodiscard]] bool isEnabled() const { return m_enabled; }
+
+  /**
+   * Called by ASYNC on all ranks
+   */
+  void setUp();
+
+  void tearDown() { m_executor.finalize(); }
+
+  void close();
+
+  private:
+  [[nodiscard]] std::uint64_t segmentSize(std::uint64_t numberOfSamples) const {
+    return numberOfSamples * (1 + m_numberOfReceivers * (m_numberOfColumns - 1)) * sizeof(double);
+  }
+
+  //! init was called, but the files are not opened yet
+  bool m_isPending = false;
+  bool m_enabled = false;
+
+  std::uint64_t m_numberOfColumns = 0;
+  std::uint64_t m_numberOfReceivers = 0;
+  std::uint64_t m_maxSamples = 0;
+
+  FaultReceiverWriterExecutor m_executor;
+
+  /** Frontend stopwatch */
+  Stopwatch m_stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_FAULTRECEIVERWRITER_H
@@ -0,0 +1,225 @@
+#include "FaultReceiverWriterExecutor.h"
+
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "DynamicRupture/Output/OutputAux.hpp"
+#include "utils/logger.h"
+
+void seissol::writer::FaultReceiverWriterExecutor::execInit(
+    const async::ExecInfo& info, const FaultReceiverWriterInitParam& param) {
+  using namespace binary_fault_receiver;
+
+  if (m_initialized) {
+    logError() << "Fault receiver writer already initialized.";
+  }
+
+  m_numberOfColumns = param.numberOfColumns;
+  m_numberOfReceivers = param.numberOfReceivers;
+  // All ranks are initialized, since printing the stopwatch is collective
+  m_initialized = true;
+
+  // Ranks without fault receivers do not write a file
+  if (m_numberOfReceivers == 0) {
+    return;
+  }
+
+  std::stringstream fileName;
+  fileName << static_cast<const char*>(info.buffer(OUTPUT_PREFIX)) << "-faultreceivers";
+#ifdef PARALLEL
+  fileName << '-' << std::setw(5) << std::setfill('0') << param.rank;
+#endif // PARALLEL
+  const auto baseName = fileName.str();
+  m_fileName = baseName + ".bin";
+
+  const auto* headerData = static_cast<const char*>(info.buffer(HEADER));
+  const bool isContinued = param.isRestart != 0 && std::filesystem::exists(m_fileName) &&
+                           truncateAfter(param.restartTime, headerData, info.bufferSize(HEADER));
+  if (!isContinued) {
+    dr::filesystem_aux::generateBackupFileIfNecessary(baseName, "bin");
+    dr::filesystem_aux::generateBackupFileIfNecessary(baseName, "bin.idx");
+  }
+
+  m_file.open(m_fileName, std::ios::binary | std::ios::app);
+  if (!m_file) {
+    logError() << "Could not open fault receiver file" << m_fileName;
+  }
+  m_file.seekp(0, std::ios::end);
+  m_fileSize = static_cast<std::uint64_t>(m_file.tellp());
+
+  m_indexFile.open(m_fileName + ".idx", std::ios::binary | std::ios::app);
+  if (!m_indexFile) {
+    logError() << "Could not open fault receiver index file" << m_fileName + ".idx";
+  }
+
+  if (m_fileSize == 0) {
+    FileHeader header{};
+    std::memcpy(header.magic, FileMagic, sizeof(FileMagic));
+    header.numberOfColumns = m_numberOfColumns;
+    header.numberOfReceivers = m_numberOfReceivers;
+    header.rank = static_cast<std::uint64_t>(param.rank);
+#ifdef PARALLEL
+    header.flags |= RankInFileName;
+#endif // PARALLEL
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+    m_file.write(headerData, static_cast<std::streamsize>(info.bufferSize(HEADER)));
+    m_file.flush();
+    if (!m_file) {
+      logError() << "Could not write to fault receiver file" << m_fileName;
+    }
+    m_fileSize = sizeof(FileHeader) + info.bufferSize(HEADER);
+  }
+}
+
+bool seissol::writer::FaultReceiverWriterExecutor::truncateAfter(double restartTime,
+                                                                const char* header,
+                                                                std::uint64_t headerSize) {
+  using namespace binary_fault_receiver;
+
+  std::fstream file(m_fileName, std::ios::binary | std::ios::in | std::ios::out);
+  FileHeader fileHeader{};
+  std::vector<char> fileHeaderData(headerSize);
+  file.read(reinterpret_cast<char*>(&fileHeader), sizeof(FileHeader));
+  file.read(fileHeaderData.data(), static_cast<std::streamsize>(headerSize));
+  if (!file || std::memcmp(fileHeader.magic, FileMagic, sizeof(FileMagic)) != 0 ||
+      fileHeader.numberOfColumns != m_numberOfColumns ||
+      fileHeader.numberOfReceivers != m_numberOfReceivers ||
+      std::memcmp(fileHeaderData.data(), header, headerSize) != 0) {
+    logWarning() << "The fault receivers do not match" << m_fileName
+                 << "; starting a new file instead of continuing it.";
+    return false;
+  }
+
+  // Keep the segments up to the restart time; a partially written segment has no index entry
+  std::vector<IndexEntry> entries;
+  {
+    std::ifstream indexFile(m_fileName + ".idx", std::ios::binary);
+    IndexEntry entry{};
+    while (indexFile.read(reinterpret_cast<char*>(&entry), sizeof(IndexEntry))) {
+      if (entry.firstTime > restartTime) {
+        break;
+      }
+      entries.push_back(entry);
+    }
+  }
+
+  std::uint64_t fileSize = sizeof(FileHeader) + headerSize;
+  const std::uint64_t valuesPerSample = m_numberOfReceivers * (m_numberOfColumns - 1);
+  for (auto& entry : entries) {
+    const std::uint64_t samples = entry.numberOfSamples;
+    if (entry.lastTime > restartTime) {
+      // Rewrite the last segment with the samples up to the restart time only
+      std::vector<double> times(samples);
+      std::vector<double> values(samples * valuesPerSample);
+      file.seekg(static_cast<std::streamoff>(entry.offset + sizeof(SegmentHeader)));
+      file.read(reinterpret_cast<char*>(times.data()),
+                static_cast<std::streamsize>(times.size() * sizeof(double)));
+      file.read(reinterpret_cast<char*>(values.data()),
+                static_cast<std::streamsize>(values.size() * sizeof(double)));
+
+      std::uint64_t keptSamples = 0;
+      while (keptSamples < samples && times[keptSamples] <= restartTime) {
+        ++keptSamples;
+      }
+      // values[receivers][samples][columns - 1]
+      const std::uint64_t valuesPerReceiver = m_numberOfColumns - 1;
+      for (std::uint64_t receiver = 0; receiver < m_numberOfReceivers; ++receiver) {
+        std::memmove(values.data() + receiver * keptSamples * valuesPerReceiver,
+                     values.data() + receiver * samples * valuesPerReceiver,
+                     keptSamples * valuesPerReceiver * sizeof(double));
+      }
+
+      SegmentHeader segmentHeader{};
+      std::memcpy(segmentHeader.magic, SegmentMagic, sizeof(SegmentMagic));
+      segmentHeader.numberOfSamples = keptSamples;
+      file.seekp(static_cast<std::streamoff>(entry.offset));
+      file.write(reinterpret_cast<const char*>(&segmentHeader), sizeof(SegmentHeader));
+      file.write(reinterpret_cast<const char*>(times.data()),
+                 static_cast<std::streamsize>(keptSamples * sizeof(double)));
+      file.write(reinterpret_cast<const char*>(values.data()),
+                 static_cast<std::streamsize>(keptSamples * valuesPerSample * sizeof(double)));
+
+      entry.numberOfSamples = keptSamples;
+      entry.lastTime = keptSamples > 0 ? times[keptSamples - 1] : entry.firstTime;
+    }
+    fileSize = entry.offset + sizeof(SegmentHeader) +
+               entry.numberOfSamples * (1 + valuesPerSample) * sizeof(double);
+  }
+  if (!entries.empty() && entries.back().numberOfSamples == 0) {
+    fileSize = entries.back().offset;
+    entries.pop_back();
+  }
+  file.close();
+  if (!file) {
+    logError() << "Could not truncate fault receiver file" << m_fileName;
+  }
+
+  std::filesystem::resize_file(m_fileName, fileSize);
+  std::ofstream indexFile(m_fileName + ".idx", std::ios::binary | std::ios::trunc);
+  indexFile.write(reinterpret_cast<const char*>(entries.data()),
+                  static_cast<std::streamsize>(entries.size() * sizeof(IndexEntry)));
+  if (!indexFile) {
+    logError() << "Could not truncate fault receiver index file" << m_fileName + ".idx";
+  }
+  return true;
+}
+
+void seissol::writer::FaultReceiverWriterExecutor::exec(const async::ExecInfo& info,
+                                                        const FaultReceiverWriterParam& param) {
+  using namespace binary_fault_receiver;
+
+  if (!m_file.is_open() || param.numberOfSamples == 0) {
+    return;
+  }
+
+  m_stopwatch.start();
+
+  const auto* times = static_cast<const double*>(info.buffer(SEGMENT));
+  const std::uint64_t segmentSize =
+      param.numberOfSamples * (1 + m_numberOfReceivers * (m_numberOfColumns - 1)) * sizeof(double);
+  if (segmentSize > info.bufferSize(SEGMENT)) {
+    logError() << "Fault receiver segment exceeds the segment buffer.";
+  }
+
+  SegmentHeader header{};
+  std::memcpy(header.magic, SegmentMagic, sizeof(SegmentMagic));
+  header.numberOfSamples = param.numberOfSamples;
+  m_file.write(reinterpret_cast<const char*>(&header), sizeof(SegmentHeader));
+  m_file.write(reinterpret_cast<const char*>(times), static_cast<std::streamsize>(segmentSize));
+  m_file.flush();
+  if (!m_file) {
+    logError() << "Could not write to fault receiver file" << m_fileName;
+  }
+
+  // The index entry is only written after the segment is complete
+  IndexEntry entry{};
+  entry.offset = m_fileSize;
+  entry.numberOfSamples = param.numberOfSamples;
+  entry.firstTime = times[0];
+  entry.lastTime = times[param.numberOfSamples - 1];
+  m_indexFile.write(reinterpret_cast<const char*>(&entry), sizeof(IndexEntry));
+  m_indexFile.flush();
+
+  m_fileSize += sizeof(SegmentHeader) + segmentSize;
+
+  m_stopwatch.pause();
+}
+
+void seissol::writer::FaultReceiverWriterExecutor::finalize() {
+  if (m_initialized) {
+    m_stopwatch.printTime("Time fault receiver writer backend:");
+  }
+
+  if (m_file.is_open()) {
+    m_file.close();
+  }
+  if (m_indexFile.is_open()) {
+    m_indexFile.close();
+  }
+
+  m_initialized = false;
+}
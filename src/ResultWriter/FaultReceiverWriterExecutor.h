@@ -0,0 +1,130 @@
+#ifndef SEISSOL_FAULTRECEIVERWRITEREXECUTOR_H
+#define SEISSOL_FAULTRECEIVERWRITEREXECUTOR_H
+
+#include "Parallel/MPI.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "async/ExecInfo.h"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol::writer {
+
+/**
+ * Layout of the binary fault receiver file of one rank (native endianness):
+ *
+ * File header:
+ *   char[8]                 "SSFREC01"
+ *   uint64                  number of columns (including the time)
+ *   uint64                  number of receivers of the rank
+ *   uint64                  rank
+ *   uint64                  flags (see Flags)
+ *   char[16] x columns      column names
+ *   uint64 x receivers      global receiver index (1-based, as in the legacy file names)
+ *   double[3] x receivers   receiver coordinates
+ *
+ * Followed by one segment per flush of the receiver cache:
+ *   char[8]                 "SSFRSEG1"
+ *   uint64                  number of samples
+ *   double[samples]         times
+ *   double[receivers][samples][columns - 1]   values
+ *
+ * The index file (same name with the additional extension ".idx") holds one IndexEntry per
+ * segment, such that a segment can be found without reading the preceding ones.
+ */
+namespace binary_fault_receiver {
+constexpr char FileMagic[8] = {'S', 'S', 'F', 'R', 'E', 'C', '0', '1'};
+constexpr char SegmentMagic[8] = {'S', 'S', 'F', 'R', 'S', 'E', 'G', '1'};
+constexpr std::size_t ColumnNameLength = 16;
+
+struct FileHeader {
+  char magic[8];
+  std::uint64_t numberOfColumns;
+  std::uint64_t numberOfReceivers;
+  std::uint64_t rank;
+  std::uint64_t flags;
+};
+
+struct SegmentHeader {
+  char magic[8];
+  std::uint64_t numberOfSamples;
+};
+
+enum Flags : std::uint64_t {
+  //! Legacy file names contain the rank
+  RankInFileName = 1,
+};
+
+struct IndexEntry {
+  //! offset of the segment header in the data file
+  std::uint64_t offset;
+  std::uint64_t numberOfSamples;
+  double firstTime;
+  double lastTime;
+};
+} // namespace binary_fault_receiver
+
+struct FaultReceiverWriterInitParam {
+  std::uint64_t numberOfColumns;
+  std::uint64_t numberOfReceivers;
+  int rank;
+  //! 1 if the simulation restarts from a checkpoint at restartTime
+  int isRestart;
+  double restartTime;
+};
+
+struct FaultReceiverWriterParam {
+  std::uint64_t numberOfSamples;
+};
+
+/**
+ * Appends the segments of the fault receiver cache of one rank to a binary file.
+ *
+ * A fresh run backs up existing files. A restart continues the existing files if their header
+ * matches the receivers; samples after the restart time are removed.
+ */
+class FaultReceiverWriterExecutor {
+  public:
+  enum BufferIds {
+    OUTPUT_PREFIX = 0,
+    //! Column names, global receiver indices and coordinates as laid out in the file header
+    HEADER = 1,
+    //! Times and values of one segment as laid out in the file
+    SEGMENT = 2,
+  };
+
+  void execInit(const async::ExecInfo& info, const FaultReceiverWriterInitParam& param);
+
+  void exec(const async::ExecInfo& info, const FaultReceiverWriterParam& param);
+
+  void finalize();
+
+  private:
+  /**
+   * Validates the header of an existing file and removes all samples after restartTime.
+   *
+   * @return false if the file can not be continued
+   */
+  bool truncateAfter(double restartTime, const char* header, std::uint64_t headerSize);
+
+  bool m_initialized = false;
+
+  std::uint64_t m_numberOfColumns = 0;
+  std::uint64_t m_numberOfReceivers = 0;
+
+  std::string m_fileName;
+  std::ofstream m_file;
+  std::ofstream m_indexFile;
+
+  //! Current end of the data file
+  std::uint64_t m_fileSize = 0;
+
+  /** Backend stopwatch */
+  Stopwatch m_stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_FAULTRECEIVERWRITEREXECUTOR_H
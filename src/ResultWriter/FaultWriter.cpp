@@ -144,6 +144,8 @@ void seissol::writer::FaultWriter::init(const unsigned int* cells, const double*
 			addBuffer(dataBuffer[m_numVariables++], nCells * sizeof(real));
 		}
 	}
+	seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer(
+		"async I/O", "fault", m_numVariables * nCells * sizeof(real));
 
 	//
 	// Send all buffers for initialization
@@ -131,7 +131,8 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
                                                 seissol::solver::FreeSurfaceIntegrator* freeSurfaceIntegrator,
                                                 char const*                             outputPrefix,
                                                 double                                  interval,
-                                                xdmfwriter::BackendType                 backend )
+                                                xdmfwriter::BackendType                 backend,
+                                                const OutputPrecisionParams&            precision )
 {
 	if (!m_enabled)
 		return;
@@ -170,6 +171,9 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 		addBuffer(displacement, nCells * sizeof(real));
 	}
 	addBuffer(m_freeSurfaceIntegrator->locationFlags.data(), nCells * sizeof(double));
+	seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer("async I/O", "free surface",
+		(m_freeSurfaceIntegrator->velocities.size() + m_freeSurfaceIntegrator->displacements.size()) * nCells * sizeof(real)
+		+ nCells * sizeof(double));
 
 	//
 	// Send all buffers for initialization
@@ -183,6 +187,7 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 	FreeSurfaceInitParam param;
 	param.timestep = seissol::SeisSol::main.checkPointManager().header().value(m_timestepComp);
   param.backend = backend;
+  param.precision = precision;
 	callInit(param);
 
 	// Remove unused buffers
@@ -78,9 +78,10 @@ void seissol::writer::FreeSurfaceWriterExecutor::execInit(const async::ExecInfo
 		}
 
 		// TODO get the timestep from the checkpoint
-		m_xdmfWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>(param.backend,
-		                                                                              outputName.c_str(),
-		                                                                              param.timestep);
+		m_xdmfWriter = new PrecisionXdmfWriter<xdmfwriter::TRIANGLE>(param.backend,
+		                                                             outputName.c_str(),
+		                                                             param.timestep,
+		                                                             param.precision);
 
 #ifdef USE_MPI
 		m_xdmfWriter->setComm(m_comm);
@@ -40,7 +40,7 @@
 #ifndef FREESURFACEWRITEREXECUTOR_H
 #define FREESURFACEWRITEREXECUTOR_H
 
-#include "xdmfwriter/XdmfWriter.h"
+#include "PrecisionXdmfWriter.h"
 #include "async/ExecInfo.h"
 
 #include "Monitoring/Stopwatch.h"
@@ -53,6 +53,7 @@ struct FreeSurfaceInitParam
 {
 	int timestep;
   xdmfwriter::BackendType backend;
+  OutputPrecisionParams precision;
 };
 
 struct FreeSurfaceParam
@@ -76,7 +77,7 @@ private:
 	MPI_Comm m_comm;
 #endif // USE_MPI
 
-	xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>* m_xdmfWriter;
+	PrecisionXdmfWriter<xdmfwriter::TRIANGLE>* m_xdmfWriter;
   unsigned m_numVariables;
 
 	/** Backend stopwatch */
@@ -0,0 +1,123 @@
+#ifndef SEISSOL_OUTPUTPRECISION_H
+#define SEISSOL_OUTPUTPRECISION_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+enum class OutputPrecision {
+  //! Values are written with the precision of the solver (real)
+  Native,
+  //! Values are converted to float32 before writing
+  Float32
+};
+
+struct OutputPrecisionParams {
+  OutputPrecision precision = OutputPrecision::Native;
+  //! Number of mantissa bits kept in float32 output (0 keeps all 23 bits)
+  unsigned significantBits = 0;
+};
+
+inline OutputPrecision parseOutputPrecision(const std::string& name) {
+  if (name == "native") {
+    return OutputPrecision::Native;
+  }
+  if (name == "float32") {
+    return OutputPrecision::Float32;
+  }
+  logError() << "Unknown output precision" << name << ". Use native or float32.";
+  return OutputPrecision::Native;
+}
+
+/**
+ * Size and error of the values converted for one snapshot.
+ */
+struct ConversionStatistics {
+  //! size of the values in the precision of the solver
+  std::uint64_t nativeBytes = 0;
+  //! size of the values handed to the writer (the writers do not compress)
+  std::uint64_t storedBytes = 0;
+  double maxError = 0.0;
+  double maxValue = 0.0;
+
+  void reset() { *this = ConversionStatistics(); }
+
+  /**
+   * Size of the native values relative to the written values; only depends on the precision.
+   * Rounding the mantissa does not reduce the size until a lossless filter is applied.
+   */
+  [[nodiscard]] double sizeReduction() const {
+    return storedBytes == 0 ? 1.0 : static_cast<double>(nativeBytes) / storedBytes;
+  }
+};
+
+/**
+ * Rounds the mantissa of a float to the nearest value with the given number of significant
+ * bits (ties to even). The relative error is bounded by 2^-(significantBits+1). The trailing
+ * zero bits make the output well compressible by lossless filters (e.g. h5repack).
+ */
+inline float roundMantissa(float value, unsigned significantBits) {
+  constexpr unsigned MantissaBits = std::numeric_limits<float>::digits - 1;
+  if (significantBits == 0 || significantBits >= MantissaBits || !std::isfinite(value)) {
+    return value;
+  }
+
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const unsigned dropBits = MantissaBits - significantBits;
+  const std::uint32_t dropMask = (std::uint32_t(1) << dropBits) - 1;
+  bits += (dropMask >> 1) + ((bits >> dropBits) & 1);
+  bits &= ~dropMask;
+
+  float rounded;
+  std::memcpy(&rounded, &bits, sizeof(rounded));
+  // Rounding the largest floats up overflows to infinity, truncate instead
+  if (!std::isfinite(rounded)) {
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits &= ~dropMask;
+    std::memcpy(&rounded, &bits, sizeof(rounded));
+  }
+  return rounded;
+}
+
+/**
+ * Converts values to float32 with the given number of significant bits and records the
+ * size and maximum (absolute) error in the statistics.
+ */
+template <typename T>
+void convertToFloat(const T* values,
+                    float* converted,
+                    std::size_t size,
+                    unsigned significantBits,
+                    ConversionStatistics& statistics) {
+  double maxError = 0.0;
+  double maxValue = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : maxError, maxValue)
+#endif
+  for (std::size_t i = 0; i < size; i++) {
+    converted[i] = roundMantissa(static_cast<float>(values[i]), significantBits);
+    if (std::isfinite(values[i])) {
+      maxError = std::max(maxError,
+                          std::abs(static_cast<double>(values[i]) - static_cast<double>(converted[i])));
+      maxValue = std::max(maxValue, std::abs(static_cast<double>(values[i])));
+    }
+  }
+
+  statistics.nativeBytes += size * sizeof(T);
+  statistics.storedBytes += size * sizeof(float);
+  statistics.maxError = std::max(statistics.maxError, maxError);
+  statistics.maxValue = std::max(statistics.maxValue, maxValue);
+}
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_OUTPUTPRECISION_H
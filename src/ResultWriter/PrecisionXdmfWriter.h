@@ -0,0 +1,136 @@
+#ifndef SEISSOL_PRECISIONXDMFWRITER_H
+#define SEISSOL_PRECISIONXDMFWRITER_H
+
+#include "Parallel/MPI.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/logger.h"
+
+#include "xdmfwriter/XdmfWriter.h"
+
+#include "OutputPrecision.h"
+
+namespace seissol::writer {
+
+/**
+ * XDMF writer that stores the cell data either in native precision or converted to float32.
+ *
+ * The conversion is done in the writer (i.e. on the I/O thread), such that the solver buffers
+ * remain in native precision.
+ */
+template <enum xdmfwriter::TopoType Topo>
+class PrecisionXdmfWriter {
+  public:
+  PrecisionXdmfWriter(xdmfwriter::BackendType backend,
+                      const char* outputPrefix,
+                      unsigned int timestep,
+                      const OutputPrecisionParams& precision)
+      : m_precision(precision) {
+    if (m_precision.precision == OutputPrecision::Float32) {
+      m_floatWriter = std::make_unique<xdmfwriter::XdmfWriter<Topo, double, float>>(
+          backend, outputPrefix, timestep);
+    } else {
+      m_nativeWriter = std::make_unique<xdmfwriter::XdmfWriter<Topo, double, real>>(
+          backend, outputPrefix, timestep);
+    }
+  }
+
+#ifdef USE_MPI
+  void setComm(MPI_Comm comm) {
+    m_comm = comm;
+    forward([comm](auto& writer) { writer.setComm(comm); });
+  }
+#endif // USE_MPI
+
+  template <typename... Args>
+  void init(Args&&... args) {
+    forward([&](auto& writer) { writer.init(std::forward<Args>(args)...); });
+  }
+
+  template <typename... Args>
+  void setMesh(unsigned int numCells, Args&&... args) {
+    m_numCells = numCells;
+    forward([&](auto& writer) { writer.setMesh(numCells, std::forward<Args>(args)...); });
+  }
+
+  void writeClusteringInfo(const unsigned int* clustering) {
+    forward([clustering](auto& writer) { writer.writeClusteringInfo(clustering); });
+  }
+
+  void addTimeStep(double time) {
+    m_time = time;
+    m_statistics.reset();
+    forward([time](auto& writer) { writer.addTimeStep(time); });
+  }
+
+  void writeCellData(unsigned int id, const real* data) {
+    if (m_floatWriter) {
+      m_buffer.resize(m_numCells);
+      convertToFloat(data, m_buffer.data(), m_numCells, m_precision.significantBits, m_statistics);
+      m_floatWriter->writeCellData(id, m_buffer.data());
+    } else {
+      m_nativeWriter->writeCellData(id, data);
+    }
+  }
+
+  /**
+   * Flushes the snapshot and reports the written size and the maximum conversion error
+   */
+  void flush() {
+    forward([](auto& writer) { writer.flush(); });
+
+    if (m_floatWriter) {
+      ConversionStatistics statistics = m_statistics;
+      int rank = 0;
+#ifdef USE_MPI
+      MPI_Comm_rank(m_comm, &rank);
+      std::uint64_t bytes[2] = {statistics.nativeBytes, statistics.storedBytes};
+      double errors[2] = {statistics.maxError, statistics.maxValue};
+      MPI_Reduce(rank == 0 ? MPI_IN_PLACE : bytes, bytes, 2, MPI_UINT64_T, MPI_SUM, 0, m_comm);
+      MPI_Reduce(rank == 0 ? MPI_IN_PLACE : errors, errors, 2, MPI_DOUBLE, MPI_MAX, 0, m_comm);
+      statistics.nativeBytes = bytes[0];
+      statistics.storedBytes = bytes[1];
+      statistics.maxError = errors[0];
+      statistics.maxValue = errors[1];
+#endif // USE_MPI
+      logInfo(rank) << "Reduced precision output at time" << m_time << ":"
+                    << statistics.storedBytes << "bytes written instead of" << statistics.nativeBytes
+                    << "(size reduction" << statistics.sizeReduction() << "), max. error"
+                    << statistics.maxError << "(max. value" << statistics.maxValue << ")";
+    }
+  }
+
+  private:
+  template <typename Func>
+  void forward(Func&& func) {
+    if (m_floatWriter) {
+      func(*m_floatWriter);
+    } else {
+      func(*m_nativeWriter);
+    }
+  }
+
+  OutputPrecisionParams m_precision;
+
+  std::unique_ptr<xdmfwriter::XdmfWriter<Topo, double, real>> m_nativeWriter;
+  std::unique_ptr<xdmfwriter::XdmfWriter<Topo, double, float>> m_floatWriter;
+
+  //! Staging buffer for the converted cell data
+  std::vector<float> m_buffer;
+  unsigned int m_numCells = 0;
+
+  double m_time = 0.0;
+  ConversionStatistics m_statistics;
+
+#ifdef USE_MPI
+  MPI_Comm m_comm = MPI_COMM_NULL;
+#endif // USE_MPI
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_PRECISIONXDMFWRITER_H
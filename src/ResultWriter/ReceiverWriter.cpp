@@ -39,7 +39,10 @@
 
 #include "ReceiverWriter.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <cstring>
 #include <iterator>
 #include <sstream>
 #include <iomanip>
@@ -47,11 +50,13 @@
 #include <sys/stat.h>
 #include <Parallel/MPI.h>
 #include <Modules/Modules.h>
+#include "SeisSol.h"
 
 #include <sstream>
 #include <string>
 #include <fstream>
 #include <regex>
+#include <unordered_map>
 
 Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
   std::regex rgx("\\s+");
@@ -88,6 +93,17 @@ std::vector<Eigen::Vector3d> seissol::writer::parseReceiverFile(const std::strin
   return points;
 }
 
+seissol::writer::ReceiverOutputBackend seissol::writer::parseReceiverOutputBackend(const std::string& name) {
+  if (name == "ascii") {
+    return ReceiverOutputBackend::Ascii;
+  }
+  if (name == "binary") {
+    return ReceiverOutputBackend::Binary;
+  }
+  logError() << "Unknown receiver output backend" << name << ". Use ascii or binary.";
+  return ReceiverOutputBackend::Ascii;
+}
+
 std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   std::stringstream fns;
   fns << std::setfill('0') << m_fileNamePrefix << "-receiver-" << std::setw(5) << (pointId+1);
@@ -98,16 +114,30 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
-                                                   Eigen::Vector3d const& point   ) {
-  auto name = fileName(pointId);
-
+std::vector<std::string> seissol::writer::ReceiverWriter::columnNames() {
   std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "v1", "v2", "v3"});
 #ifdef USE_POROELASTIC
   std::array<std::string, 4> additionalNames({"p", "v1_f", "v2_f", "v3_f"});
   names.insert(names.end() ,additionalNames.begin(), additionalNames.end());
 #endif
 
+#ifdef MULTIPLE_SIMULATIONS
+  std::vector<std::string> simulationNames;
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : names) {
+      simulationNames.push_back(name + std::to_string(sim));
+    }
+  }
+  return simulationNames;
+#else
+  return names;
+#endif
+}
+
+void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
+                                                   Eigen::Vector3d const& point   ) {
+  auto name = fileName(pointId);
+
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
   // Write header if file does not exist
@@ -116,17 +146,9 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     file.open(name);
     file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1) << "\"" << std::endl;
     file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (auto const& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
-    }
-#else
-    for (auto const& name : names) {
+    for (auto const& name : columnNames()) {
       file << ",\"" << name << "\"";
     }
-#endif
     file << std::endl;
     for (int d = 0; d < 3; ++d) {
       file << "# x" << (d+1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
@@ -135,12 +157,229 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   }
 }
 
-void seissol::writer::ReceiverWriter::syncPoint(double)
+void seissol::writer::ReceiverWriter::initBinaryOutput(std::vector<Eigen::Vector3d> const& points) {
+  using namespace binary_receiver;
+
+  // Initialize the asynchronous module
+  async::Module<ReceiverWriterExecutor, ReceiverWriterInitParam, ReceiverWriterParam>::init();
+
+  auto names = columnNames();
+  names.insert(names.begin(), "Time");
+  std::vector<char> paddedNames(names.size() * ColumnNameLength, '\0');
+  for (size_t i = 0; i < names.size(); ++i) {
+    names[i].copy(&paddedNames[i * ColumnNameLength], ColumnNameLength - 1);
+  }
+
+  std::vector<double> coordinates(3 * points.size());
+  for (size_t point = 0; point < points.size(); ++point) {
+    for (int d = 0; d < 3; ++d) {
+      coordinates[3 * point + d] = points[point][d];
+    }
+  }
+
+  unsigned int bufferId = addSyncBuffer(m_fileNamePrefix.c_str(), m_fileNamePrefix.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::OUTPUT_PREFIX); NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(paddedNames.data(), paddedNames.size(), true);
+  assert(bufferId == ReceiverWriterExecutor::COLUMN_NAMES);
+  bufferId = addSyncBuffer(coordinates.data(), coordinates.size() * sizeof(double), true);
+  assert(bufferId == ReceiverWriterExecutor::COORDINATES);
+
+  // Size of the record buffer: The number of samples per receiver and synchronization
+  // point is bounded by the number of sampling intervals in a synchronization interval.
+  const size_t maxSamples = static_cast<size_t>(syncInterval() / (m_samplingInterval * std::max(m_decimation.factor, 1u))) + 2;
+  m_recordBufferSize = sizeof(uint64_t);
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      const auto numberOfReceivers = static_cast<size_t>(std::distance(cluster.begin(), cluster.end()));
+      m_recordBufferSize += numberOfReceivers * (sizeof(RecordHeader) + maxSamples * cluster.ncols() * sizeof(double));
+    }
+  }
+  bufferId = addBuffer(0L, m_recordBufferSize);
+  assert(bufferId == ReceiverWriterExecutor::RECORDS);
+  seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer(
+      "async I/O", "receivers", m_recordBufferSize);
+
+  sendBuffer(ReceiverWriterExecutor::OUTPUT_PREFIX);
+  sendBuffer(ReceiverWriterExecutor::COLUMN_NAMES);
+  sendBuffer(ReceiverWriterExecutor::COORDINATES);
+
+  ReceiverWriterInitParam param;
+  param.numberOfColumns = names.size();
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::OUTPUT_PREFIX);
+  removeBuffer(ReceiverWriterExecutor::COLUMN_NAMES);
+  removeBuffer(ReceiverWriterExecutor::COORDINATES);
+}
+
+void seissol::writer::ReceiverWriter::setUp() {
+  setExecutor(m_executor);
+  if (isAffinityNecessary()) {
+    const auto freeCpus = SeisSol::main.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Receiver writer thread affinity:" <<
+      parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+  }
+}
+
+bool seissol::writer::ReceiverWriter::isBinaryOutputEnabled() const {
+  // The record buffer is only allocated if the binary output was initialized
+  return m_backend == ReceiverOutputBackend::Binary && m_recordBufferSize > 0;
+}
+
+void seissol::writer::ReceiverWriter::close() {
+  if (isBinaryOutputEnabled()) {
+    wait();
+  }
+
+  finalize();
+
+  if (isBinaryOutputEnabled()) {
+    m_stopwatch.printTime("Time receiver writer frontend:");
+  }
+}
+
+size_t seissol::writer::ReceiverWriter::numberOfLocalReceivers() const {
+  size_t numberOfReceivers = 0;
+  for (auto const& [layer, clusters] : m_receiverClusters) {
+    for (auto const& cluster : clusters) {
+      numberOfReceivers += cluster.numberOfReceivers();
+    }
+  }
+  return numberOfReceivers;
+}
+
+bool seissol::writer::ReceiverWriter::hasFilterState() const {
+  return m_decimation.factor > 1 && m_decimation.filterOrder > 0;
+}
+
+size_t seissol::writer::ReceiverWriter::filterStateSize() const {
+  // Number of receivers, followed by the point id, the size and the state of each receiver
+  size_t size = 1;
+  for (auto const& [layer, clusters] : m_receiverClusters) {
+    for (auto const& cluster : clusters) {
+      for (auto const& receiver : cluster) {
+        size += 2 + receiver.filterState.size();
+      }
+    }
+  }
+  return size;
+}
+
+void seissol::writer::ReceiverWriter::storeFilterState(double* buffer) const {
+  *buffer++ = numberOfLocalReceivers();
+  for (auto const& [layer, clusters] : m_receiverClusters) {
+    for (auto const& cluster : clusters) {
+      for (auto const& receiver : cluster) {
+        *buffer++ = receiver.pointId;
+        *buffer++ = receiver.filterState.size();
+        buffer = std::copy(receiver.filterState.begin(), receiver.filterState.end(), buffer);
+      }
+    }
+  }
+}
+
+void seissol::writer::ReceiverWriter::loadFilterState(double const* buffer) {
+  // The same receivers require the same size
+  double const* end = buffer + filterStateSize();
+  const auto numberOfReceivers = static_cast<size_t>(*buffer++);
+  if (numberOfReceivers != numberOfLocalReceivers()) {
+    logError() << "The receiver filter state in the checkpoint contains" << numberOfReceivers
+      << "receivers instead of" << numberOfLocalReceivers();
+  }
+
+  std::unordered_map<unsigned, std::pair<double const*, size_t>> states;
+  for (size_t i = 0; i < numberOfReceivers; ++i) {
+    if (end - buffer < 2 || static_cast<size_t>(buffer[1]) > static_cast<size_t>(end - buffer - 2)) {
+      logError() << "The receiver filter state in the checkpoint does not match the receivers.";
+    }
+    const auto pointId = static_cast<unsigned>(buffer[0]);
+    const auto stateSize = static_cast<size_t>(buffer[1]);
+    states[pointId] = {buffer + 2, stateSize};
+    buffer += 2 + stateSize;
+  }
+
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      for (auto& receiver : cluster) {
+        auto state = states.find(receiver.pointId);
+        if (state == states.end() || state->second.second != receiver.filterState.size()) {
+          logError() << "The receiver filter state in the checkpoint does not match receiver"
+            << receiver.pointId + 1;
+        }
+        std::copy_n(state->second.first, state->second.second, receiver.filterState.begin());
+      }
+    }
+  }
+  logInfo(seissol::MPI::mpi.rank()) << "Receiver filter state loaded from the checkpoint.";
+}
+
+void seissol::writer::ReceiverWriter::syncPoint(double currentTime)
 {
+  if (m_backend == ReceiverOutputBackend::Binary) {
+    // All ranks take part in the collective write, even without local receivers
+    if (isBinaryOutputEnabled()) {
+      writeBinary(currentTime);
+    }
+    return;
+  }
+
   if (m_receiverClusters.empty()) {
     return;
   }
 
+  writeAscii();
+}
+
+void seissol::writer::ReceiverWriter::writeBinary(double time)
+{
+  using namespace binary_receiver;
+
+  m_stopwatch.start();
+
+  // Wait until the previous records are written
+  wait();
+
+  auto* buffer = async::Module<ReceiverWriterExecutor, ReceiverWriterInitParam, ReceiverWriterParam>::managedBuffer<char*>(ReceiverWriterExecutor::RECORDS);
+  const uint64_t rank = seissol::MPI::mpi.rank();
+  uint64_t size = 0;
+  char* position = buffer + sizeof(size);
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      auto ncols = cluster.ncols();
+      for (auto &receiver : cluster) {
+        assert(receiver.output.size() % ncols == 0);
+        const size_t recordSize = sizeof(RecordHeader) + receiver.output.size() * sizeof(double);
+        if (sizeof(size) + size + recordSize > m_recordBufferSize) {
+          logError() << "Receiver output exceeds the record buffer.";
+        }
+
+        RecordHeader header{receiver.pointId, rank, receiver.output.size() / ncols};
+        std::memcpy(position, &header, sizeof(RecordHeader));
+        auto* samples = reinterpret_cast<double*>(position + sizeof(RecordHeader));
+        std::copy(receiver.output.begin(), receiver.output.end(), samples);
+
+        position += recordSize;
+        size += recordSize;
+        receiver.output.clear();
+      }
+    }
+  }
+  std::memcpy(buffer, &size, sizeof(size));
+
+  sendBuffer(ReceiverWriterExecutor::RECORDS, sizeof(size) + size);
+
+  ReceiverWriterParam param;
+  param.time = time;
+  call(param);
+
+  m_stopwatch.pause();
+}
+
+void seissol::writer::ReceiverWriter::writeAscii()
+{
   m_stopwatch.start();
 
   for (auto& [layer, clusters] : m_receiverClusters) {
@@ -170,11 +409,19 @@ void seissol::writer::ReceiverWriter::syncPoint(double)
   logInfo(rank) << "Wrote receivers in" << time << "seconds.";
 }
 void seissol::writer::ReceiverWriter::init(std::string receiverFileName, std::string fileNamePrefix,
-                                           double syncPointInterval, double samplingInterval)
+                                           double syncPointInterval, double samplingInterval,
+                                           ReceiverOutputBackend backend,
+                                           kernels::ReceiverDecimation const& decimation)
 {
   m_receiverFileName = std::move(receiverFileName);
   m_fileNamePrefix = std::move(fileNamePrefix);
   m_samplingInterval = samplingInterval;
+  m_backend = backend;
+  m_decimation = decimation;
+  if (m_decimation.factor > 1) {
+    logInfo(seissol::MPI::mpi.rank()) << "Receivers are decimated by a factor of" << m_decimation.factor
+      << "with a Butterworth filter of order" << m_decimation.filterOrder;
+  }
   setSyncInterval(syncPointInterval);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 }
@@ -222,11 +469,26 @@ void seissol::writer::ReceiverWriter::addPoints(MeshReader const& mesh,
       auto& clusters = m_receiverClusters[layer];
       // Make sure that needed empty clusters are initialized.
       for (unsigned c = clusters.size(); c <= cluster; ++c) {
-        clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval());
+        clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval(), m_decimation);
       }
 
-      writeHeader(point, points[point]);
+      if (m_backend == ReceiverOutputBackend::Ascii) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  if (m_backend == ReceiverOutputBackend::Binary) {
+    m_points = std::move(points);
+  }
+}
+
+void seissol::writer::ReceiverWriter::initOutput() {
+  if (m_backend == ReceiverOutputBackend::Binary && !m_points.empty()) {
+    logInfo(seissol::MPI::mpi.rank()) << "Initializing binary receiver output.";
+    initBinaryOutput(m_points);
+  }
+  m_points.clear();
+  m_points.shrink_to_fit();
 }
@@ -50,6 +50,8 @@
 #include <Kernels/Receiver.h>
 #include <Modules/Module.h>
 #include <Monitoring/Stopwatch.h>
+#include <async/Module.h>
+#include "ReceiverWriterExecutor.h"
 
 struct LocalIntegrationData;
 struct GlobalData;
@@ -57,10 +59,22 @@ namespace seissol::writer {
     Eigen::Vector3d parseReceiverLine(const std::string& line);
     std::vector<Eigen::Vector3d> parseReceiverFile(const std::string& receiverFileName);
 
-    class ReceiverWriter : public seissol::Module {
+    enum class ReceiverOutputBackend {
+      //! One ASCII file per receiver and rank
+      Ascii,
+      //! One binary file for all receivers, written asynchronously
+      Binary
+    };
+
+    ReceiverOutputBackend parseReceiverOutputBackend(const std::string& name);
+
+    class ReceiverWriter : private async::Module<ReceiverWriterExecutor, ReceiverWriterInitParam, ReceiverWriterParam>,
+                           public seissol::Module {
     public:
       void init(std::string receiverFileName, std::string fileNamePrefix,
-                double syncPointInterval, double samplingInterval);
+                double syncPointInterval, double samplingInterval,
+                ReceiverOutputBackend backend = ReceiverOutputBackend::Ascii,
+                kernels::ReceiverDecimation const& decimation = kernels::ReceiverDecimation());
 
       void addPoints(
           const MeshReader& mesh,
@@ -77,6 +91,43 @@ namespace seissol::writer {
         }
         return nullptr;
       }
+      /**
+       * Called by ASYNC on all ranks
+       */
+      void setUp();
+
+      void tearDown() {
+        m_executor.finalize();
+      }
+
+      void close();
+
+      /**
+       * Initializes the binary output. Separate from addPoints, such that the receivers
+       * are known before the checkpoint is initialized.
+       */
+      void initOutput();
+
+      /**
+       * @return True if the receivers are decimated with an anti-alias filter
+       */
+      [[nodiscard]] bool hasFilterState() const;
+
+      /**
+       * @return Number of values to store the filter states of all local receivers
+       */
+      [[nodiscard]] size_t filterStateSize() const;
+
+      /**
+       * Packs the filter states of all local receivers, e.g. for the checkpoint
+       */
+      void storeFilterState(double* buffer) const;
+
+      /**
+       * Restores the filter states packed by storeFilterState
+       */
+      void loadFilterState(double const* buffer);
+
       //
       // Hooks
       //
@@ -84,11 +135,24 @@ namespace seissol::writer {
 
     private:
       [[nodiscard]] std::string fileName(unsigned pointId) const;
+      [[nodiscard]] static std::vector<std::string> columnNames();
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
+      void initBinaryOutput(std::vector<Eigen::Vector3d> const& points);
+      [[nodiscard]] bool isBinaryOutputEnabled() const;
+      void writeAscii();
+      void writeBinary(double time);
+      [[nodiscard]] size_t numberOfLocalReceivers() const;
 
       std::string m_receiverFileName;
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
+      ReceiverOutputBackend m_backend = ReceiverOutputBackend::Ascii;
+      kernels::ReceiverDecimation m_decimation;
+      ReceiverWriterExecutor m_executor;
+      //! All receivers, until the binary output is initialized
+      std::vector<Eigen::Vector3d> m_points;
+      //! Size of the managed record buffer of the binary backend
+      size_t      m_recordBufferSize = 0;
       // Map needed because LayerType enum casts weirdly to int.
       std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
       Stopwatch   m_stopwatch;
@@ -0,0 +1,176 @@
+#include "ReceiverWriterExecutor.h"
+
+#include <climits>
+#include <cstring>
+#include <vector>
+
+#include "utils/logger.h"
+
+void seissol::writer::ReceiverWriterExecutor::execInit(const async::ExecInfo& info,
+                                                       const ReceiverWriterInitParam& param) {
+  using namespace binary_receiver;
+
+  if (m_initialized) {
+    logError() << "Receiver writer already initialized.";
+  }
+
+  int rank = 0;
+#ifdef USE_MPI
+  // All ranks take part in the collective writes, even if they have no receivers
+  MPI_Comm_dup(seissol::MPI::mpi.comm(), &m_comm);
+  MPI_Comm_rank(m_comm, &rank);
+#endif // USE_MPI
+
+  m_fileName = std::string(static_cast<const char*>(info.buffer(OUTPUT_PREFIX))) + "-receivers.bin";
+
+#ifdef USE_MPI
+  if (MPI_File_open(m_comm,
+                    m_fileName.c_str(),
+                    MPI_MODE_CREATE | MPI_MODE_RDWR,
+                    MPI_INFO_NULL,
+                    &m_file) != MPI_SUCCESS) {
+    logError() << "Could not open receiver file" << m_fileName;
+  }
+  MPI_Offset fileSize = 0;
+  MPI_File_get_size(m_file, &fileSize);
+  m_fileSize = fileSize;
+#else
+  // Create the file if it does not exist yet
+  std::ofstream(m_fileName, std::ios::binary | std::ios::app).close();
+  m_file.open(m_fileName, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+  if (!m_file) {
+    logError() << "Could not open receiver file" << m_fileName;
+  }
+  m_fileSize = static_cast<std::uint64_t>(m_file.tellp());
+#endif // USE_MPI
+
+  // Existing files (e.g. after restarting from a checkpoint) are continued
+  if (m_fileSize == 0) {
+    const auto numberOfReceivers = info.bufferSize(COORDINATES) / (3 * sizeof(double));
+
+    FileHeader header{};
+    std::memcpy(header.magic, FileMagic, sizeof(FileMagic));
+    header.numberOfColumns = param.numberOfColumns;
+    header.numberOfReceivers = numberOfReceivers;
+#ifdef PARALLEL
+    header.flags |= RankInFileName;
+#endif
+
+    std::vector<char> buffer(sizeof(FileHeader) + info.bufferSize(COLUMN_NAMES) +
+                             info.bufferSize(COORDINATES));
+    char* position = buffer.data();
+    std::memcpy(position, &header, sizeof(FileHeader));
+    position += sizeof(FileHeader);
+    std::memcpy(position, info.buffer(COLUMN_NAMES), info.bufferSize(COLUMN_NAMES));
+    position += info.bufferSize(COLUMN_NAMES);
+    std::memcpy(position, info.buffer(COORDINATES), info.bufferSize(COORDINATES));
+
+    if (rank == 0) {
+      writeAt(0, buffer.data(), buffer.size(), false);
+    }
+    m_fileSize = buffer.size();
+  }
+
+  m_initialized = true;
+
+  logInfo(rank) << "Initializing binary receiver output. Done.";
+}
+
+void seissol::writer::ReceiverWriterExecutor::exec(const async::ExecInfo& info,
+                                                   const ReceiverWriterParam& param) {
+  using namespace binary_receiver;
+
+  if (!m_initialized) {
+    return;
+  }
+
+  m_stopwatch.start();
+
+  // The first 8 bytes contain the size of the records
+  const auto* buffer = static_cast<const char*>(info.buffer(RECORDS));
+  std::uint64_t localSize = 0;
+  std::memcpy(&localSize, buffer, sizeof(localSize));
+
+  int rank = 0;
+  std::uint64_t localOffset = 0;
+  std::uint64_t totalSize = localSize;
+#ifdef USE_MPI
+  MPI_Comm_rank(m_comm, &rank);
+  MPI_Exscan(&localSize, &localOffset, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+  if (rank == 0) {
+    localOffset = 0;
+  }
+  MPI_Allreduce(&localSize, &totalSize, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+#endif // USE_MPI
+
+  if (rank == 0) {
+    ChunkHeader header{};
+    std::memcpy(header.magic, ChunkMagic, sizeof(ChunkMagic));
+    header.time = param.time;
+    header.size = totalSize;
+    writeAt(m_fileSize, &header, sizeof(ChunkHeader), false);
+  }
+  writeAt(m_fileSize + sizeof(ChunkHeader) + localOffset,
+          buffer + sizeof(localSize),
+          localSize,
+          true);
+  m_fileSize += sizeof(ChunkHeader) + totalSize;
+
+  m_stopwatch.pause();
+}
+
+void seissol::writer::ReceiverWriterExecutor::writeAt(std::uint64_t offset,
+                                                      const void* data,
+                                                      std::size_t size,
+                                                      bool collective) {
+#ifdef USE_MPI
+  if (size > static_cast<std::size_t>(INT_MAX)) {
+    logError() << "Receiver output of a single rank exceeds" << INT_MAX
+               << "bytes. Decrease ReceiverOutputInterval.";
+  }
+  MPI_Status status;
+  int error;
+  if (collective) {
+    error = MPI_File_write_at_all(
+        m_file, offset, data, static_cast<int>(size), MPI_BYTE, &status);
+  } else {
+    error = MPI_File_write_at(m_file, offset, data, static_cast<int>(size), MPI_BYTE, &status);
+  }
+  if (error != MPI_SUCCESS) {
+    logError() << "Could not write to receiver file" << m_fileName;
+  }
+#else
+  m_file.seekp(static_cast<std::streamoff>(offset));
+  m_file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+  if (!m_file) {
+    logError() << "Could not write to receiver file" << m_fileName;
+  }
+#endif // USE_MPI
+}
+
+void seissol::writer::ReceiverWriterExecutor::finalize() {
+  if (m_initialized) {
+    m_stopwatch.printTime("Time receiver writer backend:"
+#ifdef USE_MPI
+                          ,
+                          m_comm
+#endif // USE_MPI
+    );
+  }
+
+#ifdef USE_MPI
+  if (m_file != MPI_FILE_NULL) {
+    MPI_File_close(&m_file);
+  }
+  if (m_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_comm);
+    m_comm = MPI_COMM_NULL;
+  }
+#else
+  if (m_file.is_open()) {
+    m_file.close();
+  }
+#endif // USE_MPI
+
+  m_initialized = false;
+}
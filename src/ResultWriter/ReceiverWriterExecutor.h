@@ -0,0 +1,119 @@
+#ifndef SEISSOL_RECEIVERWRITEREXECUTOR_H
+#define SEISSOL_RECEIVERWRITEREXECUTOR_H
+
+#include "Parallel/MPI.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "async/ExecInfo.h"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol::writer {
+
+/**
+ * Layout of the binary receiver file (native endianness):
+ *
+ * File header:
+ *   char[8]                 "SSRECV01"
+ *   uint64                  number of columns (including the time)
+ *   uint64                  number of receivers
+ *   uint64                  flags (see Flags)
+ *   char[16] x columns      column names
+ *   double[3] x receivers   receiver coordinates
+ *
+ * Followed by one chunk per synchronization point:
+ *   char[8]                 "SSCHUNK1"
+ *   double                  time of the synchronization point
+ *   uint64                  size of the records in bytes (excluding this chunk header)
+ *   records
+ *
+ * Record (one per receiver and chunk):
+ *   uint64                  point id (0-based line in the receiver file)
+ *   uint64                  rank which wrote the record
+ *   uint64                  number of samples
+ *   double[columns] x samples
+ */
+namespace binary_receiver {
+constexpr char FileMagic[8] = {'S', 'S', 'R', 'E', 'C', 'V', '0', '1'};
+constexpr char ChunkMagic[8] = {'S', 'S', 'C', 'H', 'U', 'N', 'K', '1'};
+constexpr std::size_t ColumnNameLength = 16;
+
+struct FileHeader {
+  char magic[8];
+  std::uint64_t numberOfColumns;
+  std::uint64_t numberOfReceivers;
+  std::uint64_t flags;
+};
+
+struct ChunkHeader {
+  char magic[8];
+  double time;
+  std::uint64_t size;
+};
+
+struct RecordHeader {
+  std::uint64_t pointId;
+  std::uint64_t rank;
+  std::uint64_t numberOfSamples;
+};
+
+enum Flags : std::uint64_t {
+  //! Legacy file names contain the rank
+  RankInFileName = 1,
+};
+} // namespace binary_receiver
+
+struct ReceiverWriterInitParam {
+  std::uint64_t numberOfColumns;
+};
+
+struct ReceiverWriterParam {
+  double time;
+};
+
+/**
+ * Writes the receivers of all ranks into a single binary file.
+ * Each rank sends its records for one synchronization point in one buffer.
+ * Records of all ranks are appended collectively to the file.
+ */
+class ReceiverWriterExecutor {
+  public:
+  enum BufferIds {
+    OUTPUT_PREFIX = 0,
+    COLUMN_NAMES = 1,
+    COORDINATES = 2,
+    RECORDS = 3,
+  };
+
+  void execInit(const async::ExecInfo& info, const ReceiverWriterInitParam& param);
+
+  void exec(const async::ExecInfo& info, const ReceiverWriterParam& param);
+
+  void finalize();
+
+  private:
+  void writeAt(std::uint64_t offset, const void* data, std::size_t size, bool collective);
+
+  bool m_initialized = false;
+
+  std::string m_fileName;
+
+#ifdef USE_MPI
+  MPI_Comm m_comm = MPI_COMM_NULL;
+  MPI_File m_file = MPI_FILE_NULL;
+#else
+  std::fstream m_file;
+#endif // USE_MPI
+
+  //! Current end of the file
+  std::uint64_t m_fileSize = 0;
+
+  /** Backend stopwatch */
+  Stopwatch m_stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RECEIVERWRITEREXECUTOR_H
@@ -0,0 +1,166 @@
+#include "VolumeEnergy.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include <generated_code/init.h>
+#include <generated_code/kernel.h>
+#include <Numerical_aux/Quadrature.h>
+
+namespace seissol::writer {
+
+namespace {
+constexpr auto QuadPolyDegree = CONVERGENCE_ORDER + 1;
+constexpr auto NumQuadraturePointsTet = QuadPolyDegree * QuadPolyDegree * QuadPolyDegree;
+
+struct TetrahedronQuadratureWeights {
+  double weights[NumQuadraturePointsTet];
+
+  TetrahedronQuadratureWeights() {
+    double points[NumQuadraturePointsTet][3];
+    seissol::quadrature::TetrahedronQuadrature(points, weights, QuadPolyDegree);
+  }
+};
+} // namespace
+
+void addCellEnergies(const GlobalData* global,
+                     const real* dofs,
+                     const real* pstrain,
+                     const CellMaterialData& material,
+                     double volume,
+                     VolumeEnergies& energies) {
+#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
+  // The quadrature rule is the same for all cells
+  static const TetrahedronQuadratureWeights quadrature;
+
+  // Needed to weight the integral.
+  const auto jacobiDet = 6 * volume;
+
+  alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+  auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
+  // Evaluate numerical solution at quad. nodes
+  kernel::evalAtQP krnl;
+  krnl.evalAtQP = global->evalAtQPMatrix;
+  krnl.dofsQP = numericalSolutionData;
+  krnl.Q = dofs;
+  krnl.execute();
+
+#ifdef MULTIPLE_SIMULATIONS
+  auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
+#else
+  auto numSub = numericalSolution;
+#endif
+  for (size_t qp = 0; qp < NumQuadraturePointsTet; ++qp) {
+    constexpr int uIdx = 6;
+    const auto curWeight = jacobiDet * quadrature.weights[qp];
+    const auto rho = material.local.rho;
+
+    const auto u = numSub(qp, uIdx + 0);
+    const auto v = numSub(qp, uIdx + 1);
+    const auto w = numSub(qp, uIdx + 2);
+    const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
+
+    if (std::abs(material.local.mu) < 10e-14) {
+      // Acoustic
+      constexpr int pIdx = 0;
+      const auto K = material.local.lambda;
+      const auto p = numSub(qp, pIdx);
+
+      const double curAcousticEnergy = (p * p) / (2 * K);
+      energies.acousticEnergy += curWeight * curAcousticEnergy;
+      energies.acousticKineticEnergy += curWeight * curKineticEnergy;
+    } else {
+      // Elastic
+      energies.elasticKineticEnergy += curWeight * curKineticEnergy;
+      auto getStressIndex = [](int i, int j) {
+        const static auto lookup =
+            std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
+        return lookup[i][j];
+      };
+      auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
+
+      const auto lambda = material.local.lambda;
+      const auto mu = material.local.mu;
+      const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
+      auto computeStrain = [&](int i, int j) {
+        double strain = 0.0;
+        const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+        if (i == j) {
+          strain += factor * sumUniaxialStresses;
+        }
+        strain += 1.0 / (2.0 * mu) * getStress(i, j);
+        return strain;
+      };
+      double curElasticEnergy = 0.0;
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          curElasticEnergy += getStress(i, j) * computeStrain(i, j);
+        }
+      }
+      energies.elasticEnergy += curWeight * 0.5 * curElasticEnergy;
+    }
+  }
+#endif
+
+  if (pstrain != nullptr) {
+    // plastic moment
+#ifdef USE_ANISOTROPIC
+    real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
+#else
+    real mu = material.local.mu;
+#endif
+    energies.plasticMoment += mu * volume * pstrain[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+  }
+}
+
+void VolumeEnergyAccumulator::init(const GlobalData* global,
+                                   const real* dofs,
+                                   std::vector<double> cellVolumes) {
+  this->global = global;
+  this->dofs = dofs;
+  this->cellVolumes = std::move(cellVolumes);
+#ifdef _OPENMP
+  slots.resize(omp_get_max_threads());
+#else
+  slots.resize(1);
+#endif
+}
+
+void VolumeEnergyAccumulator::request(double time) {
+  if (isEnabled()) {
+    requestedTimes.insert(time);
+  }
+}
+
+void VolumeEnergyAccumulator::beginInterval(double synchronizationTime, double timeTolerance) {
+  active = false;
+  while (!requestedTimes.empty() &&
+         *requestedTimes.begin() < synchronizationTime + timeTolerance) {
+    active = active || std::abs(*requestedTimes.begin() - synchronizationTime) < timeTolerance;
+    requestedTimes.erase(requestedTimes.begin());
+  }
+  if (active) {
+    accumulatedTime = synchronizationTime;
+    accumulatedCells.store(0);
+    for (auto& slot : slots) {
+      slot.energies = VolumeEnergies();
+    }
+  }
+}
+
+bool VolumeEnergyAccumulator::energies(double time,
+                                       double timeTolerance,
+                                       VolumeEnergies& energies) const {
+  if (!isEnabled() || std::abs(time - accumulatedTime) >= timeTolerance ||
+      accumulatedCells.load() != cellVolumes.size()) {
+    return false;
+  }
+  energies = VolumeEnergies();
+  for (const auto& slot : slots) {
+    energies += slot.energies;
+  }
+  return true;
+}
+
+} // namespace seissol::writer
@@ -0,0 +1,132 @@
+#ifndef SEISSOL_VOLUMEENERGY_H
+#define SEISSOL_VOLUMEENERGY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Initializer/typedefs.hpp"
+#include "Kernels/precision.hpp"
+
+namespace seissol::writer {
+
+/**
+ * Energies of the volume (without the gravitational energy, which is a surface integral)
+ */
+struct VolumeEnergies {
+  double acousticEnergy = 0.0;
+  double acousticKineticEnergy = 0.0;
+  double elasticEnergy = 0.0;
+  double elasticKineticEnergy = 0.0;
+  double plasticMoment = 0.0;
+
+  VolumeEnergies& operator+=(const VolumeEnergies& other) {
+    acousticEnergy += other.acousticEnergy;
+    acousticKineticEnergy += other.acousticKineticEnergy;
+    elasticEnergy += other.elasticEnergy;
+    elasticKineticEnergy += other.elasticKineticEnergy;
+    plasticMoment += other.plasticMoment;
+    return *this;
+  }
+};
+
+/**
+ * Adds the energies of one cell (evaluated with a quadrature rule) to energies.
+ *
+ * @param pstrain The plastic strain of the cell (nullptr without plasticity)
+ */
+void addCellEnergies(const GlobalData* global,
+                     const real* dofs,
+                     const real* pstrain,
+                     const CellMaterialData& material,
+                     double volume,
+                     VolumeEnergies& energies);
+
+/**
+ * Accumulates the volume energies while the time clusters do their last update before an
+ * energy output time.
+ *
+ * The energy output requests the time of its next output. The time manager activates the
+ * accumulation in advanceInTime if the next synchronization time is this time. Each time cluster
+ * then adds the energies of its cells directly after their neighboring integration in the last
+ * time step before this time, i.e. while the DOFs are still in the cache. The energies are
+ * accumulated in one slot per thread, such that the synchronization point only needs to sum the
+ * slots. The energies are read from the DOFs themselves; no copy of the DOFs is made.
+ */
+class VolumeEnergyAccumulator {
+  public:
+  /**
+   * @param dofs The DOFs of the LTS tree
+   * @param cellVolumes The volume of each cell of the LTS tree
+   */
+  void init(const GlobalData* global, const real* dofs, std::vector<double> cellVolumes);
+
+  [[nodiscard]] bool isEnabled() const { return global != nullptr; }
+
+  /**
+   * Requests the energies at the given time. Ignored if the accumulator is disabled.
+   */
+  void request(double time);
+
+  /**
+   * Called before the clusters advance to the next synchronization time.
+   * Activates the accumulation if the energies were requested for this time.
+   */
+  void beginInterval(double synchronizationTime, double timeTolerance);
+
+  /**
+   * True, if the clusters have to accumulate the energies when they reach the current
+   * synchronization time.
+   */
+  [[nodiscard]] bool isActive() const { return active; }
+
+  /**
+   * Adds the energies of one cell. Thread-safe.
+   */
+  void addCell(const real* cellDofs, const real* pstrain, const CellMaterialData& material) {
+#ifdef _OPENMP
+    auto& slot = slots[omp_get_thread_num()];
+#else
+    auto& slot = slots[0];
+#endif
+    const auto cell = static_cast<std::size_t>(cellDofs - dofs) / tensor::Q::size();
+    addCellEnergies(global, cellDofs, pstrain, material, cellVolumes[cell], slot.energies);
+  }
+
+  /**
+   * Marks the cells of one layer as accumulated. Thread-safe for different layers.
+   */
+  void finishLayer(std::size_t numberOfCells) { accumulatedCells += numberOfCells; }
+
+  /**
+   * Sums the energies of all threads if they were accumulated for all cells at the given time.
+   *
+   * @return False if no complete accumulation exists for the given time.
+   */
+  bool energies(double time, double timeTolerance, VolumeEnergies& energies) const;
+
+  private:
+  struct alignas(64) Slot {
+    VolumeEnergies energies;
+  };
+
+  const GlobalData* global = nullptr;
+  const real* dofs = nullptr;
+  std::vector<double> cellVolumes;
+  std::vector<Slot> slots;
+
+  std::set<double> requestedTimes;
+  bool active = false;
+  double accumulatedTime = -1.0;
+  std::atomic<std::size_t> accumulatedCells{0};
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_VOLUMEENERGY_H
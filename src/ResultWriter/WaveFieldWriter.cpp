@@ -38,9 +38,14 @@
  * @section DESCRIPTION
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "SeisSol.h"
 #include "WaveFieldWriter.h"
 #include "Geometry/MeshReader.h"
@@ -159,7 +164,8 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
                                             int* plasticityMask,
                                             const double* outputRegionBounds,
                                             const std::unordered_set<int>& outputGroups,
-                                            xdmfwriter::BackendType backend) {
+                                            xdmfwriter::BackendType backend,
+                                            const OutputPrecisionParams& precision) {
   if (!m_enabled)
     return;
 
@@ -183,6 +189,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
       addSyncBuffer(m_outputPrefix.c_str(), m_outputPrefix.size() + 1, true);
 
   param.backend = backend;
+  param.precision = precision;
 
   //
   // High order I/O
@@ -318,9 +325,11 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
   // Create data buffers
   bool first = false;
+  size_t dataBufferSize = 0;
   for (unsigned int i = 0; i < m_numVariables; i++) {
     if (m_outputFlags[i]) {
       unsigned int id = addBuffer(0L, meshRefiner->getNumCells() * sizeof(real));
+      dataBufferSize += meshRefiner->getNumCells() * sizeof(real);
       if (!first) {
         param.bufferIds[VARIABLE0] = id;
         first = true;
@@ -371,6 +380,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
     for (int i = 1; i < numLowVars; i++)
       addBuffer(0L, pLowMeshRefiner->getNumCells() * sizeof(real));
+    dataBufferSize += numLowVars * pLowMeshRefiner->getNumCells() * sizeof(real);
 
     // Save number of cells
     m_numLowCells = pLowMeshRefiner->getNumCells();
@@ -380,6 +390,8 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
     param.bufferIds[LOWVERTICES] = -1;
     param.bufferIds[LOWVARIABLE0] = -1;
   }
+  seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer(
+      "async I/O", "wave field", dataBufferSize);
 
   //
   // Send all buffers for initialization
@@ -431,6 +443,50 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   m_variableBufferIds[0] = param.bufferIds[VARIABLE0];
   m_variableBufferIds[1] = param.bufferIds[LOWVARIABLE0];
 
+  // Written variables in the order of the buffers
+  const unsigned int numDofVariables =
+      m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+  for (unsigned int i = 0; i < m_numVariables; i++) {
+    if (m_outputFlags[i]) {
+      if (i < numDofVariables) {
+        m_dofVariables.push_back(i);
+      } else {
+        m_pstrainVariables.push_back(i - numDofVariables);
+      }
+    }
+  }
+
+#ifndef ACL_DEVICE
+  m_deferred = seissol::SeisSol::main.timeManager().useNonBlockingSync();
+#endif
+  if (m_deferred) {
+    m_numOutputCells = numElems;
+    m_dofsPerCell = numVars * numAlignedDOF;
+    m_pstrainPerCell = WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES * numAlignedDOF;
+    m_stagedDofs.resize(m_dofVariables.empty() ? 0 : std::size_t(m_numOutputCells) * m_dofsPerCell);
+    m_stagedPStrain.resize(m_pstrainVariables.empty() ? 0 : std::size_t(m_numOutputCells) * m_pstrainPerCell);
+    m_stagedMap.resize(m_numOutputCells);
+    for (unsigned int c = 0; c < m_numOutputCells; c++) {
+      m_stagedMap[c] = c;
+    }
+    m_deferredValues.resize(std::size_t(m_numCells) *
+                            (m_dofVariables.size() + m_pstrainVariables.size()));
+    unsigned int numLowVariables = 0;
+    if (integrals) {
+      numLowVariables = std::count(m_lowOutputFlags,
+                                   m_lowOutputFlags + WaveFieldWriterExecutor::NUM_INTEGRATED_VARIABLES,
+                                   true);
+    }
+    m_deferredLowValues.resize(std::size_t(m_numLowCells) * numLowVariables);
+
+    logInfo(rank) << "Wave field output is evaluated from a staged copy (SEISSOL_NONBLOCKING_SYNC).";
+    seissol::SeisSol::main.getMemoryManager().getMemoryFootprint().setBuffer(
+        "output",
+        "wave field staging",
+        (m_stagedDofs.size() + m_stagedPStrain.size() + m_deferredValues.size() +
+         m_deferredLowValues.size()) * sizeof(real));
+  }
+
   delete meshRefiner;
 }
 
@@ -444,6 +500,20 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
   const int rank = seissol::MPI::mpi.rank();
 
+  if (m_deferred) {
+    // Only blocks if the previous output is not evaluated or written yet
+    flush();
+
+    logInfo(rank) << "Staging wave field at time" << utils::nospace << time << '.';
+    stage(time);
+
+    // Update last time step
+    seissol::SeisSol::main.checkPointManager().header().value(m_timestepComp)++;
+
+    m_stopwatch.pause();
+    return;
+  }
+
   SCOREP_USER_REGION_DEFINE(r_wait);
   SCOREP_USER_REGION_BEGIN(r_wait, "wavfieldwriter_wait", SCOREP_USER_REGION_TYPE_COMMON);
   logInfo(rank) << "Waiting for last wave field.";
@@ -452,33 +522,39 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
   logInfo(rank) << "Writing wave field at time" << utils::nospace << time << '.';
 
+  // Evaluate all requested variables in one pass over the DOFs
+  std::vector<real*> dofBuffers;
+  std::vector<real*> pstrainBuffers;
   unsigned int nextId = m_variableBufferIds[0];
-  for (unsigned int i = 0; i < m_numVariables; i++) {
-    if (!m_outputFlags[i])
-      continue;
-
+  for (std::size_t i = 0; i < m_dofVariables.size() + m_pstrainVariables.size(); i++) {
     real* managedBuffer =
         async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
             real*>(nextId);
-    if (i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) {
-      m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
+    if (i < m_dofVariables.size()) {
+      dofBuffers.push_back(managedBuffer);
     } else {
-      m_variableSubsamplerPStrain->get(
-          m_pstrain,
-          m_map,
-          i - (m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES),
-          managedBuffer);
+      pstrainBuffers.push_back(managedBuffer);
     }
-    for (unsigned int j = 0; j < m_numCells; j++) {
-      if (!std::isfinite(managedBuffer[j])) {
-        logError() << "Detected Inf/NaN in volume output. Aborting.";
-      }
-    }
-    sendBuffer(nextId, m_numCells * sizeof(real));
-
     nextId++;
   }
 
+  bool isFinite = true;
+  if (!m_dofVariables.empty()) {
+    isFinite = m_variableSubsampler->getMultiple(m_dofs, m_map, m_dofVariables, dofBuffers.data());
+  }
+  if (!m_pstrainVariables.empty()) {
+    isFinite = m_variableSubsamplerPStrain->getMultiple(
+                   m_pstrain, m_map, m_pstrainVariables, pstrainBuffers.data()) &&
+               isFinite;
+  }
+  if (!isFinite) {
+    logError() << "Detected Inf/NaN in volume output. Aborting.";
+  }
+
+  for (unsigned int id = m_variableBufferIds[0]; id < nextId; id++) {
+    sendBuffer(id, m_numCells * sizeof(real));
+  }
+
   // nextId is required in a manner similar to above for writing integrated variables
   nextId = 0;
 
@@ -513,6 +589,118 @@ void seissol::writer::WaveFieldWriter::write(double time) {
   logInfo(rank) << "Writing wave field at time" << utils::nospace << time << ". Done.";
 }
 
+void seissol::writer::WaveFieldWriter::stage(double time) {
+  // The copies are taken while the clusters wait at the synchronization point
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+  for (unsigned int c = 0; c < m_numOutputCells; c++) {
+    if (!m_stagedDofs.empty()) {
+      std::copy_n(m_dofs + std::size_t(m_map[c]) * m_dofsPerCell,
+                  m_dofsPerCell,
+                  m_stagedDofs.data() + std::size_t(c) * m_dofsPerCell);
+    }
+    if (!m_stagedPStrain.empty()) {
+      std::copy_n(m_pstrain + std::size_t(m_map[c]) * m_pstrainPerCell,
+                  m_pstrainPerCell,
+                  m_stagedPStrain.data() + std::size_t(c) * m_pstrainPerCell);
+    }
+  }
+
+  // The integrals are only gathered, which is as cheap as a copy
+  if (m_integrals) {
+    unsigned int nextId = 0;
+    for (unsigned int i = 0; i < WaveFieldWriterExecutor::NUM_INTEGRATED_VARIABLES; i++) {
+      if (!m_lowOutputFlags[i])
+        continue;
+      real* values = m_deferredLowValues.data() + std::size_t(nextId) * m_numLowCells;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+      for (unsigned int j = 0; j < m_numLowCells; j++)
+        values[j] = m_integrals[m_map[j] * m_numIntegratedVariables + nextId];
+      nextId++;
+    }
+  }
+
+  m_deferredTime = time;
+  m_deferredThread = std::thread([this]() {
+    // Runs next to the time stepping: one thread, on the free CPUs if there are any
+    const auto& pinning = seissol::SeisSol::main.getPinning();
+    if (!parallel::Pinning::freeCPUsMaskEmpty(pinning.getFreeCPUsMask())) {
+      pinning.pinToFreeCPUs();
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif // _OPENMP
+
+    std::vector<real*> dofBuffers;
+    std::vector<real*> pstrainBuffers;
+    real* values = m_deferredValues.data();
+    for (std::size_t i = 0; i < m_dofVariables.size(); i++, values += m_numCells) {
+      dofBuffers.push_back(values);
+    }
+    for (std::size_t i = 0; i < m_pstrainVariables.size(); i++, values += m_numCells) {
+      pstrainBuffers.push_back(values);
+    }
+
+    bool isFinite = true;
+    if (!m_dofVariables.empty()) {
+      isFinite = m_variableSubsampler->getMultiple(
+          m_stagedDofs.data(), m_stagedMap.data(), m_dofVariables, dofBuffers.data());
+    }
+    if (!m_pstrainVariables.empty()) {
+      isFinite = m_variableSubsamplerPStrain->getMultiple(m_stagedPStrain.data(),
+                                                          m_stagedMap.data(),
+                                                          m_pstrainVariables,
+                                                          pstrainBuffers.data()) &&
+                 isFinite;
+    }
+    m_deferredIsFinite = isFinite;
+  });
+}
+
+void seissol::writer::WaveFieldWriter::flush() {
+  if (!m_deferredThread.joinable())
+    return;
+
+  const int rank = seissol::MPI::mpi.rank();
+
+  SCOREP_USER_REGION_DEFINE(r_wait);
+  SCOREP_USER_REGION_BEGIN(r_wait, "wavfieldwriter_wait", SCOREP_USER_REGION_TYPE_COMMON);
+  m_deferredThread.join();
+  if (!m_deferredIsFinite) {
+    logError() << "Detected Inf/NaN in volume output. Aborting.";
+  }
+  wait();
+  SCOREP_USER_REGION_END(r_wait);
+
+  const std::size_t numHighVariables = m_dofVariables.size() + m_pstrainVariables.size();
+  for (std::size_t i = 0; i < numHighVariables; i++) {
+    const unsigned int id = m_variableBufferIds[0] + i;
+    real* managedBuffer =
+        async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
+            real*>(id);
+    std::copy_n(m_deferredValues.data() + i * m_numCells, m_numCells, managedBuffer);
+    sendBuffer(id, m_numCells * sizeof(real));
+  }
+  const std::size_t numLowVariables = m_numLowCells > 0 ? m_deferredLowValues.size() / m_numLowCells : 0;
+  for (std::size_t i = 0; i < numLowVariables; i++) {
+    const unsigned int id = m_variableBufferIds[1] + i;
+    real* managedBuffer =
+        async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
+            real*>(id);
+    std::copy_n(m_deferredLowValues.data() + i * m_numLowCells, m_numLowCells, managedBuffer);
+    sendBuffer(id, m_numLowCells * sizeof(real));
+  }
+
+  WaveFieldParam param;
+  param.time = m_deferredTime;
+  call(param);
+
+  logInfo(rank) << "Writing wave field at time" << utils::nospace << m_deferredTime << ". Done.";
+}
+
 void seissol::writer::WaveFieldWriter::simulationStart() { syncPoint(0.0); }
 
 void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) { write(currentTime); }
@@ -46,6 +46,7 @@
 #include <algorithm>
 #include <cassert>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <unordered_set>
@@ -129,6 +130,48 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
 	/** The stopwatch for the frontend */
 	Stopwatch m_stopwatch;
 
+	/**
+	 * Deferred output (SEISSOL_NONBLOCKING_SYNC, CPU builds): At the output time, the DOFs of the
+	 * output cells are copied into a staging buffer. The variables are evaluated from this copy by
+	 * a separate thread while the time stepping continues, and they are handed to ASYNC at the
+	 * next output time (or when the writer is flushed).
+	 */
+	bool m_deferred;
+
+	/** Number of (unrefined) output cells */
+	unsigned int m_numOutputCells;
+
+	/** Number of reals of the DOFs and the plastic strain of one cell */
+	unsigned int m_dofsPerCell;
+	unsigned int m_pstrainPerCell;
+
+	/** Written DOF and plastic strain variables */
+	std::vector<unsigned int> m_dofVariables;
+	std::vector<unsigned int> m_pstrainVariables;
+
+	/** Staged DOFs and plastic strain of the output cells (in the order of the output cells) */
+	std::vector<real> m_stagedDofs;
+	std::vector<real> m_stagedPStrain;
+
+	/** Identity map for the staged copies */
+	std::vector<unsigned int> m_stagedMap;
+
+	/** Evaluated high order and low order variables of the deferred output */
+	std::vector<real> m_deferredValues;
+	std::vector<real> m_deferredLowValues;
+
+	/** Evaluates the staged copy */
+	std::thread m_deferredThread;
+
+	/** Time of the deferred output */
+	double m_deferredTime;
+
+	/** False if the deferred output contains Inf/NaN */
+	bool m_deferredIsFinite;
+
+	/** Copies the DOFs and the integrals and starts the evaluation of the deferred output */
+	void stage(double time);
+
 	/** Checks if a vertex given by the vertexCoords lies inside the boxBounds */
 	/*   The boxBounds is in the format: xMin, xMax, yMin, yMax, zMin, zMax */
 	bool vertexInBox(const double * const boxBounds, const double * const vertexCoords) {
@@ -156,7 +199,10 @@ public:
       m_lowOutputFlags(0L),
       m_numCells(0), m_numLowCells(0),
       m_dofs(0L), m_pstrain(0L), m_integrals(0L),
-      m_map(0L)
+      m_map(0L),
+      m_deferred(false),
+      m_numOutputCells(0), m_dofsPerCell(0), m_pstrainPerCell(0),
+      m_deferredTime(0.0), m_deferredIsFinite(true)
 	{
 	}
 
@@ -205,21 +251,29 @@ public:
             int* plasticityMask,
             const double* outputRegionBounds,
             const std::unordered_set<int>& outputGroups,
-            xdmfwriter::BackendType backend);
+            xdmfwriter::BackendType backend,
+            const OutputPrecisionParams& precision);
 
 	/**
 	 * Write a time step
 	 */
 	void write(double time);
 
+	/**
+	 * Hands a deferred output to ASYNC, waits for its evaluation if necessary
+	 */
+	void flush();
+
 	/**
 	 * Close wave field writer and free resources
 	 */
 	void close()
 	{
 		// Cleanup the executor
-		if (m_enabled)
+		if (m_enabled) {
+			flush();
 			wait();
+		}
 
 		finalize();
 
@@ -47,7 +47,7 @@
 
 #include "utils/logger.h"
 
-#include "xdmfwriter/XdmfWriter.h"
+#include "PrecisionXdmfWriter.h"
 
 #include "async/ExecInfo.h"
 
@@ -80,6 +80,7 @@ struct WaveFieldInitParam
 
 	int bufferIds[BUFFERTAG_MAX+1];
   xdmfwriter::BackendType backend;
+	OutputPrecisionParams precision;
 };
 
 struct WaveFieldParam
@@ -91,10 +92,10 @@ class WaveFieldWriterExecutor
 {
 private:
 	/** The XMDF Writer used for the wave field */
-	xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>* m_waveFieldWriter;
+	PrecisionXdmfWriter<xdmfwriter::TETRAHEDRON>* m_waveFieldWriter;
 
 	/** The XDMF Writer for low order data */
-	xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>* m_lowWaveFieldWriter;
+	PrecisionXdmfWriter<xdmfwriter::TETRAHEDRON>* m_lowWaveFieldWriter;
 
 	/** Buffer id for the first variable for high and low order output */
 	unsigned int m_variableBufferIds[2];
@@ -198,8 +199,8 @@ public:
 #endif // USE_MPI
 
 		// Initialize the I/O handler and write the mesh
-		m_waveFieldWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>(
-			type, outputPrefix, param.timestep);
+		m_waveFieldWriter = new PrecisionXdmfWriter<xdmfwriter::TETRAHEDRON>(
+			type, outputPrefix, param.timestep, param.precision);
 
 #ifdef USE_MPI
 		m_waveFieldWriter->setComm(m_comm);
@@ -242,8 +243,8 @@ public:
 				}
 			}
 
-			m_lowWaveFieldWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>(
-				type, (std::string(outputPrefix)+"-low").c_str());
+			m_lowWaveFieldWriter = new PrecisionXdmfWriter<xdmfwriter::TETRAHEDRON>(
+				type, (std::string(outputPrefix)+"-low").c_str(), 0, param.precision);
 
 #ifdef USE_MPI
 		m_lowWaveFieldWriter->setComm(m_comm);
@@ -58,6 +58,7 @@
 #include "ResultWriter/AsyncIO.h"
 #include "ResultWriter/WaveFieldWriter.h"
 #include "ResultWriter/FaultWriter.h"
+#include "ResultWriter/FaultReceiverWriter.h"
 #include "ResultWriter/EnergyOutput.h"
 
 #include "ResultWriter/AnalysisWriter.h"
@@ -136,6 +137,9 @@ private:
   //! Receiver writer module
   writer::ReceiverWriter m_receiverWriter;
 
+  //! Binary fault receiver writer module
+  writer::FaultReceiverWriter m_faultReceiverWriter;
+
   //! Energy writer module
   writer::EnergyOutput m_energyOutput;
 
@@ -253,6 +257,14 @@ public:
 		return m_receiverWriter;
 	}
 
+	/**
+	 * Get the binary fault receiver writer module
+	 */
+	writer::FaultReceiverWriter& faultReceiverWriter()
+	{
+		return m_faultReceiverWriter;
+	}
+
   /**
    * Get the energy writer module
    */
@@ -53,11 +53,11 @@
 void seissol::solver::FreeSurfaceIntegrator::SurfaceLTS::addTo(seissol::initializers::LTSTree& surfaceLtsTree)
 {
   seissol::initializers::LayerMask ghostMask(Ghost);
-  surfaceLtsTree.addVar(             dofs, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar( displacementDofs, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar(             side, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar(           meshId, ghostMask,                 1,      seissol::memory::Standard );
-  surfaceLtsTree.addVar(  boundaryMapping, ghostMask,                 1,      seissol::memory::Standard );
+  surfaceLtsTree.addVar(             dofs, ghostMask,                 1,      seissol::memory::Standard, "dofs" );
+  surfaceLtsTree.addVar( displacementDofs, ghostMask,                 1,      seissol::memory::Standard, "displacementDofs" );
+  surfaceLtsTree.addVar(             side, ghostMask,                 1,      seissol::memory::Standard, "side" );
+  surfaceLtsTree.addVar(           meshId, ghostMask,                 1,      seissol::memory::Standard, "meshId" );
+  surfaceLtsTree.addVar(  boundaryMapping, ghostMask,                 1,      seissol::memory::Standard, "boundaryMapping" );
 }
 
 seissol::solver::FreeSurfaceIntegrator::FreeSurfaceIntegrator()
@@ -49,8 +49,11 @@
 #include <Initializer/CellLocalMatrices.h>
 #include <Initializer/InitialFieldProjection.h>
 #include <Initializer/ParameterDB.h>
+#include <Initializer/InputAux.hpp>
+#include <Initializer/MemoryAllocator.h>
 #include <Initializer/time_stepping/common.hpp>
 #include <Initializer/typedefs.hpp>
+#include <Initializer/BatchRecorders/Recorders.h>
 #include <Equations/Setup.h>
 #include <Numerical_aux/BasisFunction.h>
 #include <Monitoring/FlopCounter.hpp>
@@ -77,8 +80,8 @@ extern "C" {
     e_interoperability.initializeClusteredLts( i_clustering, enableFreeSurfaceIntegration, usePlasticity );
   }
 
-  void c_interoperability_initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
-    e_interoperability.initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity);
+  bool c_interoperability_initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
+    return e_interoperability.initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity);
   }
 
 
@@ -415,8 +418,8 @@ void seissol::Interoperability::setTimeStepWidth( int    i_meshId,
 void seissol::Interoperability::initializeClusteredLts(int clustering,
                                                        bool enableFreeSurfaceIntegration,
                                                        bool usePlasticity) {
-  // assert a valid clustering
-  assert(clustering > 0 );
+  // assert a valid clustering (0 selects the rate automatically)
+  assert(clustering >= 0 );
 
   // either derive a GTS or LTS layout
   if(clustering == 1 ) {
@@ -475,9 +478,12 @@ void seissol::Interoperability::initializeClusteredLts(int clustering,
                                                          m_ltsTree->var(m_lts->cellInformation) );
 }
 
-void seissol::Interoperability::initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
+bool seissol::Interoperability::initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
   // initialize memory layout
-  seissol::SeisSol::main.getMemoryManager().initializeMemoryLayout(enableFreeSurfaceIntegration);
+  if (!seissol::SeisSol::main.getMemoryManager().initializeMemoryLayout(enableFreeSurfaceIntegration)) {
+    // Memory dry run, the caller stops the initialization
+    return false;
+  }
 
   // add clusters
   seissol::SeisSol::main.timeManager().addClusters(m_timeStepping,
@@ -491,6 +497,12 @@ void seissol::Interoperability::initializeMemoryLayout(int clustering, bool enab
 
   // initialize face lts trees
   seissol::SeisSol::main.getMemoryManager().fixateBoundaryLtsTree();
+
+  if (seissol::memory::useMemoryAudit()) {
+    seissol::SeisSol::main.getMemoryManager().auditMemory();
+  }
+
+  return true;
 }
 
 void seissol::Interoperability::initFaultOutputManager() {
@@ -788,6 +800,10 @@ void seissol::Interoperability::initializeCellLocalMatrices(bool usePlasticity)
                                          memoryManager.getBoundary());
 
   memoryManager.recordExecutionPaths(usePlasticity);
+#else
+  if (initializers::recording::useHostBatchedNeighborIntegration()) {
+    memoryManager.recordExecutionPaths(usePlasticity);
+  }
 #endif
 }
 
@@ -857,6 +873,8 @@ void seissol::Interoperability::enableCheckPointing( double i_checkPointInterval
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::MPIO_ASYNC);
   else if (strcmp(i_checkPointBackend, "sionlib") == 0)
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::SIONLIB);
+  else if (strcmp(i_checkPointBackend, "compressed") == 0)
+	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::COMPRESSED);
   else
 	  logError() << "Unknown checkpoint backend";
   seissol::SeisSol::main.checkPointManager().setFilename( i_checkPointFilename );
@@ -879,7 +897,48 @@ seissol::Interoperability::initializeIO(int numSides, int numBndGP, int refineme
                                         double energySyncInterval)
 {
   auto type = writer::backendType(xdmfWriterBackend);
+
+  const auto& outputParams = (*seissol::SeisSol::main.getInputParams())["output"];
+  writer::OutputPrecisionParams outputPrecision;
+  outputPrecision.precision = writer::parseOutputPrecision(
+      seissol::initializers::getWithDefault(outputParams, "outputprecision", std::string("native")));
+  outputPrecision.significantBits =
+      seissol::initializers::getWithDefault(outputParams, "outputsignificantbits", 0u);
+  if (outputPrecision.significantBits > 23) {
+    logError() << "OutputSignificantBits must be between 0 (all bits) and 23.";
+  }
   
+  // Locate the receivers before the checkpoint is initialized, which also stores the state of
+  // their anti-alias filters
+  auto& receiverWriter = seissol::SeisSol::main.receiverWriter();
+  const auto receiverOutputBackend = seissol::writer::parseReceiverOutputBackend(
+      seissol::initializers::getWithDefault((*seissol::SeisSol::main.getInputParams())["output"],
+                                            "receiveroutputbackend",
+                                            std::string("ascii")));
+  kernels::ReceiverDecimation receiverDecimation;
+  receiverDecimation.factor =
+      seissol::initializers::getWithDefault(outputParams, "receiverdecimation", 1u);
+  receiverDecimation.filterOrder =
+      seissol::initializers::getWithDefault(outputParams, "receiverfilterorder", 8u);
+  if (receiverDecimation.factor == 0) {
+    logError() << "ReceiverDecimation must be at least 1.";
+  }
+  receiverWriter.init(std::string(receiverFileName),
+                      std::string(freeSurfaceFilename),
+                      receiverSyncInterval,
+                      receiverSamplingInterval,
+                      receiverOutputBackend,
+                      receiverDecimation);
+  receiverWriter.addPoints(
+    seissol::SeisSol::main.meshReader(),
+    m_ltsLut,
+    *m_lts,
+    m_globalData
+  );
+  if (receiverWriter.hasFilterState() && seissol::SeisSol::main.checkPointManager().isEnabled()) {
+    seissol::SeisSol::main.checkPointManager().setAuxiliarySize(receiverWriter.filterStateSize());
+  }
+
 	// Initialize checkpointing
 	int faultTimeStep;
 
@@ -915,6 +974,8 @@ seissol::Interoperability::initializeIO(int numSides, int numBndGP, int refineme
 			seissol::SeisSol::main.checkPointManager().header().time());
 		seissol::SeisSol::main.faultWriter().setTimestep(faultTimeStep);
 	}
+	seissol::SeisSol::main.faultReceiverWriter().open(hasCheckpoint,
+		hasCheckpoint ? seissol::SeisSol::main.checkPointManager().header().time() : 0.0);
 
   constexpr auto numberOfQuantities = tensor::Q::Shape[ sizeof(tensor::Q::Shape) / sizeof(tensor::Q::Shape[0]) - 1];
 
@@ -936,27 +997,26 @@ seissol::Interoperability::initializeIO(int numSides, int numBndGP, int refineme
       seissol::SeisSol::main.postProcessor().getIntegrals(m_ltsTree),
       m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask)[0],
       refinement, outputMask, plasticityMask, outputRegionBounds,outputGroups,
-			type);
+			type, outputPrecision);
 
 	// Initialize free surface output
 	seissol::SeisSol::main.freeSurfaceWriter().init(
 		seissol::SeisSol::main.meshReader(),
 		&seissol::SeisSol::main.freeSurfaceIntegrator(),
-		freeSurfaceFilename, freeSurfaceInterval, type);
+		freeSurfaceFilename, freeSurfaceInterval, type, outputPrecision);
 
 
-  auto& receiverWriter = seissol::SeisSol::main.receiverWriter();
   // Initialize receiver output
-  receiverWriter.init(std::string(receiverFileName),
-                      std::string(freeSurfaceFilename),
-                      receiverSyncInterval,
-                      receiverSamplingInterval);
-  receiverWriter.addPoints(
-    seissol::SeisSol::main.meshReader(),
-    m_ltsLut,
-    *m_lts,
-    m_globalData
-  );
+  receiverWriter.initOutput();
+  if (hasCheckpoint && receiverWriter.hasFilterState()) {
+    auto& checkPointManager = seissol::SeisSol::main.checkPointManager();
+    if (checkPointManager.isAuxiliaryLoaded()) {
+      receiverWriter.loadFilterState(checkPointManager.auxiliary());
+    } else {
+      logWarning(seissol::MPI::mpi.rank()) << "The checkpoint contains no receiver filter state."
+        << "The filters start from a zero state.";
+    }
+  }
   seissol::SeisSol::main.timeManager().setReceiverClusters(receiverWriter);
 
   auto& energyOutput = seissol::SeisSol::main.energyOutput();
@@ -1090,6 +1150,14 @@ void seissol::Interoperability::finalizeIO()
 	seissol::SeisSol::main.checkPointManager().close();
 	seissol::SeisSol::main.faultWriter().close();
 	seissol::SeisSol::main.freeSurfaceWriter().close();
+	seissol::SeisSol::main.receiverWriter().close();
+
+	// Remaining fault receiver samples are handed to the writer before it is closed
+	auto* faultOutputManager = seissol::SeisSol::main.getMemoryManager().getFaultOutputManager();
+	if (faultOutputManager != nullptr) {
+		faultOutputManager->flushPickpointDataToFile();
+	}
+	seissol::SeisSol::main.faultReceiverWriter().close();
 }
 
 void seissol::Interoperability::deallocateMemoryManager() {
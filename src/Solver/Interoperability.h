@@ -153,7 +153,12 @@ class seissol::Interoperability {
     * @param enableFreeSurfaceIntegration
     **/
    void initializeClusteredLts(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity);
-   void initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity);
+   /**
+    * Sets up the memory layout and the time clusters.
+    *
+    * @return false if a memory dry run (SEISSOL_MEMORY_DRY_RUN) stopped before the time clusters were set up.
+    **/
+   bool initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity);
    void initFaultOutputManager();
 
 #if defined(USE_NETCDF) && !defined(NETCDF_PASSIVE)
@@ -87,6 +87,9 @@ void seissol::Simulator::setCurrentTime( double i_currentTime ) {
 void seissol::Simulator::simulate() {
   SCOREP_USER_REGION( "simulate", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+  // All solver and output buffers are allocated at this point
+  seissol::SeisSol::main.getMemoryManager().reportMemoryFootprint();
+
   auto* faultOutputManager = seissol::SeisSol::main.timeManager().getFaultOutputManager();
   faultOutputManager->writePickpointOutput(0.0, 0.0);
 
@@ -119,8 +122,13 @@ void seissol::Simulator::simulate() {
     if (upcomingTime < m_currentTime + l_timeTolerance)
       logError() << "Simulator did not advance in time from" << m_currentTime << "to" << upcomingTime;
 
+    // Only checkpoints and the end of the simulation require a global synchronization;
+    // all other synchronization points are used for output
+    const bool isCheckPoint = std::abs( upcomingTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance;
+    const bool isFinalTime = upcomingTime > m_finalTime - l_timeTolerance;
+
     // update the DOFs
-    seissol::SeisSol::main.timeManager().advanceInTime( upcomingTime );
+    seissol::SeisSol::main.timeManager().advanceInTime( upcomingTime, isCheckPoint || isFinalTime );
 
     // update current time
     m_currentTime = upcomingTime;
@@ -133,9 +141,18 @@ void seissol::Simulator::simulate() {
 
     // write checkpoint if required
     if( std::abs( m_currentTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance ) {
+      // The checkpoint counts the wave field outputs, hence a deferred output has to be written first
+      seissol::SeisSol::main.waveFieldWriter().flush();
       const unsigned int faultTimeStep = seissol::SeisSol::main.faultWriter().timestep();
-      seissol::SeisSol::main.checkPointManager().write(m_currentTime, faultTimeStep);
+      auto& checkPointManager = seissol::SeisSol::main.checkPointManager();
+      if (checkPointManager.hasAuxiliary()) {
+        seissol::SeisSol::main.receiverWriter().storeFilterState(checkPointManager.auxiliary());
+      }
+      checkPointManager.write(m_currentTime, faultTimeStep);
       m_checkPointTime += m_checkPointInterval;
+      seissol::SeisSol::main.timeManager().exportCellCosts();
+    } else if (isFinalTime) {
+      seissol::SeisSol::main.timeManager().exportCellCosts();
     }
     upcomingTime = std::min(upcomingTime, m_checkPointTime + m_checkPointInterval);
 
@@ -92,13 +92,13 @@ module f_ftoc_bind_interoperability
   end interface
 
   interface
-    subroutine c_interoperability_initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity) bind( C, name='c_interoperability_initializeMemoryLayout' )
+    logical(kind=c_bool) function c_interoperability_initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity) bind( C, name='c_interoperability_initializeMemoryLayout' )
       use iso_c_binding
       implicit none
       integer(kind=c_int), value  :: clustering
       logical(kind=c_bool), value :: enableFreeSurfaceIntegration
       logical(kind=c_bool), value :: usePlasticity
-    end subroutine
+    end function
   end interface
 
   interface c_interoperability_initFaultOutputManager
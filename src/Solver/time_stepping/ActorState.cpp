@@ -72,7 +72,7 @@ long ClusterTimes::computeStepsUntilSyncTime(double oldSyncTime, double newSyncT
   return static_cast<long>(std::ceil(timeStepRate*timeDiff/maxTimeStepSize));
 }
 
-NeighborCluster::NeighborCluster(double maxTimeStepSize, int timeStepRate) {
+NeighborCluster::NeighborCluster(double maxTimeStepSize, long timeStepRate) {
   ct.maxTimeStepSize = maxTimeStepSize;
   ct.timeStepRate = timeStepRate;
 }
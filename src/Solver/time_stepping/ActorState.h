@@ -85,7 +85,7 @@ struct NeighborCluster {
   std::shared_ptr<MessageQueue> inbox = nullptr;
   std::shared_ptr<MessageQueue> outbox = nullptr;
 
-  NeighborCluster(double maxTimeStepSize, int timeStepRate);
+  NeighborCluster(double maxTimeStepSize, long timeStepRate);
 
 };
 
@@ -0,0 +1,239 @@
+#include "Parallel/MPI.h"
+
+#include "CellCostExporter.h"
+
+#include <algorithm>
+#include <numeric>
+
+#ifdef USE_HDF
+#include <hdf5.h>
+#endif // USE_HDF
+
+#include "SeisSol.h"
+#include "TimeCluster.h"
+#include <Solver/Interoperability.h>
+#include <utils/logger.h>
+
+extern seissol::Interoperability e_interoperability;
+
+namespace seissol::time_stepping {
+
+double ClusterCosts::costPerCellUpdate() const {
+  const double weightedUpdates = cellUpdates + yieldSurcharge * yieldingUpdates;
+  return weightedUpdates > 0.0 ? computeTime / weightedUpdates : 0.0;
+}
+
+double ClusterCosts::costPerFaceUpdate() const {
+  return faceUpdates > 0.0 ? dynamicRuptureTime / faceUpdates : 0.0;
+}
+
+double ClusterCosts::cellCost(unsigned numberOfYields, unsigned numberOfDynamicRuptureFaces) const {
+  const double updatesPerCell = cells > 0.0 ? cellUpdates / cells : 0.0;
+  const double yieldFraction = updatesPerCell > 0.0 ? numberOfYields / updatesPerCell : 0.0;
+  return costPerCellUpdate() * (1.0 + yieldSurcharge * yieldFraction) +
+         0.5 * numberOfDynamicRuptureFaces * costPerFaceUpdate();
+}
+
+void CellCostExporter::init(LoopStatistics& loopStatistics,
+                            std::string const& costsFile,
+                            double threshold) {
+  if (costsFile.empty()) {
+    return;
+  }
+
+  const int rank = seissol::MPI::mpi.rank();
+#if defined(USE_HDF) && defined(USE_MPI)
+  const auto& elements = seissol::SeisSol::main.meshReader().getElements();
+  const bool hasGlobalIds = std::all_of(elements.begin(), elements.end(), [](const Element& element) {
+    return element.globalId >= 0;
+  });
+  if (!hasGlobalIds) {
+    logWarning(rank) << "Measuring the costs of the cells requires a PUML mesh. Disabling the export of the cell costs.";
+    return;
+  }
+
+  this->loopStatistics = &loopStatistics;
+  this->costsFile = costsFile;
+  this->threshold = threshold;
+  regions[Local] = loopStatistics.getRegion("computeLocalIntegration");
+  regions[Neighbor] = loopStatistics.getRegion("computeNeighboringIntegration");
+  regions[DynamicRupture] = loopStatistics.getRegion("computeDynamicRupture");
+  logInfo(rank) << "Writing the measured costs to" << costsFile << "if the load imbalance exceeds"
+                << 100.0 * threshold << "%.";
+#else
+  logWarning(rank) << "Measuring the costs of the cells requires HDF5 and MPI. Disabling the export of the cell costs.";
+#endif
+}
+
+void CellCostExporter::check(std::vector<std::unique_ptr<TimeCluster>> const& clusters) {
+  if (!isEnabled()) {
+    return;
+  }
+
+  const auto clusterCosts = collectClusterCosts(clusters);
+  double computeTime = 0.0;
+  for (const auto& costs : clusterCosts) {
+    computeTime += costs.computeTime + costs.dynamicRuptureTime;
+  }
+  double maxTime = computeTime;
+  double sumTime = computeTime;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &maxTime, 1, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &sumTime, 1, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  const double meanTime = sumTime / seissol::MPI::mpi.size();
+  const double imbalance = maxTime > 0.0 ? 1.0 - meanTime / maxTime : 0.0;
+
+  const int rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Load imbalance since the last check:" << 100.0 * imbalance << "%";
+  if (imbalance > threshold) {
+    logInfo(rank) << "The load imbalance exceeds" << 100.0 * threshold
+                  << "%. Exporting the measured costs of the cells for the partitioning of a later run.";
+    writeCosts(computeElementCosts(clusters, clusterCosts));
+  }
+
+  for (const auto& cluster : clusters) {
+    cluster->resetNumberOfYields();
+  }
+}
+
+std::vector<ClusterCosts>
+    CellCostExporter::collectClusterCosts(std::vector<std::unique_ptr<TimeCluster>> const& clusters) {
+  std::array<std::vector<double>, NumRegions> times;
+  std::array<std::vector<double>, NumRegions> iterations;
+  for (int region = 0; region < NumRegions; ++region) {
+    firstSamples[region] = loopStatistics->accumulate(
+        regions[region], firstSamples[region], times[region], iterations[region]);
+  }
+
+  std::vector<ClusterCosts> clusterCosts;
+  const auto costsOf = [&clusterCosts](std::size_t globalClusterId) -> ClusterCosts& {
+    if (globalClusterId >= clusterCosts.size()) {
+      clusterCosts.resize(globalClusterId + 1);
+    }
+    return clusterCosts[globalClusterId];
+  };
+
+  // Local and neighboring integration are executed once per cell update
+  for (std::size_t id = 0; id < times[Local].size(); ++id) {
+    costsOf(id).computeTime += times[Local][id];
+    costsOf(id).cellUpdates += iterations[Local][id];
+  }
+  for (std::size_t id = 0; id < times[Neighbor].size(); ++id) {
+    costsOf(id).computeTime += times[Neighbor][id];
+  }
+  for (std::size_t id = 0; id < times[DynamicRupture].size(); ++id) {
+    costsOf(id).dynamicRuptureTime += times[DynamicRupture][id];
+    costsOf(id).faceUpdates += iterations[DynamicRupture][id];
+  }
+
+  for (const auto& cluster : clusters) {
+    auto& costs = costsOf(cluster->getGlobalClusterId());
+    const auto& numberOfYields = cluster->getNumberOfYields();
+    costs.cells += cluster->getClusterData().getNumberOfCells();
+    costs.yieldingUpdates += std::accumulate(numberOfYields.begin(), numberOfYields.end(), 0.0);
+    costs.yieldSurcharge = std::max(costs.yieldSurcharge, cluster->getPlasticYieldSurcharge());
+  }
+
+  return clusterCosts;
+}
+
+std::vector<double>
+    CellCostExporter::computeElementCosts(std::vector<std::unique_ptr<TimeCluster>> const& clusters,
+                                          std::vector<ClusterCosts> const& clusterCosts) {
+  const auto& elements = seissol::SeisSol::main.meshReader().getElements();
+  auto& memoryManager = seissol::SeisSol::main.getMemoryManager();
+  const auto* lts = memoryManager.getLts();
+  const auto* firstCellInformation = memoryManager.getLtsTree()->var(lts->cellInformation);
+  const auto* lut = e_interoperability.getLtsLut();
+
+  // Duplicated cells of the copy layer are updated more than once
+  std::vector<double> elementCosts(elements.size(), 0.0);
+  for (const auto& cluster : clusters) {
+    auto& layer = cluster->getClusterData();
+    const auto* cellInformation = layer.var(lts->cellInformation);
+    const auto firstLtsId = static_cast<unsigned>(cellInformation - firstCellInformation);
+    const auto& numberOfYields = cluster->getNumberOfYields();
+    const auto& costs = clusterCosts[cluster->getGlobalClusterId()];
+
+    for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+      const auto numberOfDynamicRuptureFaces = std::count(cellInformation[cell].faceTypes,
+                                                          cellInformation[cell].faceTypes + 4,
+                                                          FaceType::dynamicRupture);
+      const unsigned yields = numberOfYields.empty() ? 0 : numberOfYields[cell];
+      elementCosts[lut->ltsToMesh(firstLtsId + cell)] +=
+          costs.cellCost(yields, static_cast<unsigned>(numberOfDynamicRuptureFaces));
+    }
+  }
+
+  // Normalize, such that the weights do not depend on the length of the interval
+  double sumCosts = std::accumulate(elementCosts.begin(), elementCosts.end(), 0.0);
+  double numberOfElements = elements.size();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &sumCosts, 1, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfElements, 1, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  if (sumCosts > 0.0) {
+    const double meanCost = sumCosts / numberOfElements;
+    for (auto& cost : elementCosts) {
+      cost /= meanCost;
+    }
+  }
+  return elementCosts;
+}
+
+void CellCostExporter::writeCosts(std::vector<double> const& elementCosts) {
+#if defined(USE_HDF) && defined(USE_MPI)
+  const int rank = seissol::MPI::mpi.rank();
+  const auto& elements = seissol::SeisSol::main.meshReader().getElements();
+
+  unsigned long numberOfElements = elements.size();
+  unsigned long totalNumberOfElements = 0;
+  MPI_Allreduce(&numberOfElements, &totalNumberOfElements, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+
+  std::vector<hsize_t> coordinates(numberOfElements);
+  for (unsigned long i = 0; i < numberOfElements; ++i) {
+    coordinates[i] = elements[i].globalId;
+  }
+
+  hid_t plistId = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plistId, seissol::MPI::mpi.comm(), MPI_INFO_NULL);
+  hid_t file = H5Fcreate(costsFile.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plistId);
+  H5Pclose(plistId);
+  if (file < 0) {
+    logError() << "Could not create" << costsFile;
+  }
+
+  const hsize_t dim[] = {static_cast<hsize_t>(totalNumberOfElements)};
+  hid_t filespace = H5Screate_simple(1, dim, nullptr);
+  hid_t dataset = H5Dcreate(file, "/cost", H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  // The elements are scattered over the file
+  const hsize_t dimMem[] = {static_cast<hsize_t>(numberOfElements)};
+  hid_t memspace = H5Screate_simple(1, dimMem, nullptr);
+  if (numberOfElements > 0) {
+    H5Sselect_elements(filespace, H5S_SELECT_SET, numberOfElements, coordinates.data());
+  } else {
+    H5Sselect_none(filespace);
+    H5Sselect_none(memspace);
+  }
+
+  plistId = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plistId, H5FD_MPIO_COLLECTIVE);
+  const herr_t status = H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, plistId, elementCosts.data());
+  if (status < 0) {
+    logError() << "Could not write the measured costs to" << costsFile;
+  }
+
+  H5Pclose(plistId);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(dataset);
+  H5Fclose(file);
+
+  logInfo(rank) << "Measured costs written to" << costsFile
+                << "(used for the next partitioning of the mesh without a cached partition).";
+#endif // defined(USE_HDF) && defined(USE_MPI)
+}
+
+} // namespace seissol::time_stepping
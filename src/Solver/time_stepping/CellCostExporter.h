@@ -0,0 +1,107 @@
+#ifndef SEISSOL_CELLCOSTEXPORTER_H
+#define SEISSOL_CELLCOSTEXPORTER_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Monitoring/LoopStatistics.h"
+
+namespace seissol::time_stepping {
+
+class TimeCluster;
+
+/**
+ * Measured costs of one global time cluster on this rank (copy and interior layer).
+ */
+struct ClusterCosts {
+  //! time spent in the local and neighboring integration
+  double computeTime = 0.0;
+  //! number of cell updates
+  double cellUpdates = 0.0;
+  //! number of cells
+  double cells = 0.0;
+  //! number of cell updates with plastic yielding
+  double yieldingUpdates = 0.0;
+  //! additional cost of a cell update with yielding relative to a cell update without yielding
+  double yieldSurcharge = 0.0;
+  //! time spent in dynamic rupture
+  double dynamicRuptureTime = 0.0;
+  //! number of dynamic rupture face updates
+  double faceUpdates = 0.0;
+
+  /**
+   * Time of one cell update without plastic yielding.
+   */
+  [[nodiscard]] double costPerCellUpdate() const;
+
+  /**
+   * Time of one dynamic rupture face update.
+   */
+  [[nodiscard]] double costPerFaceUpdate() const;
+
+  /**
+   * Average time of one update of a cell, including its plastic yielding and its share of the
+   * dynamic rupture faces (each face is shared with the neighboring cell).
+   *
+   * @param numberOfYields Number of updates of the cell with plastic yielding.
+   * @param numberOfDynamicRuptureFaces Number of dynamic rupture faces of the cell.
+   */
+  [[nodiscard]] double cellCost(unsigned numberOfYields, unsigned numberOfDynamicRuptureFaces) const;
+};
+
+/**
+ * Exports the measured costs of the cells for the partitioning of a later run.
+ *
+ * The costs are derived from the loop statistics of the time clusters. If the load imbalance
+ * between the ranks exceeds a threshold, the costs of all cells are written to a file, which is
+ * indexed by the global cell id. The LTS weights use these costs instead of the vertex weights of
+ * the parameter file the next time the mesh is partitioned.
+ * This is an export tool only: the mesh is never repartitioned within a run, and a restart from a
+ * checkpoint reuses the partition of the checkpoint.
+ */
+class CellCostExporter {
+  public:
+  /**
+   * @param costsFile File for the measured costs; the monitor is disabled if empty.
+   * @param threshold Imbalance (1 - mean / max of the compute time) at which the costs are written.
+   */
+  void init(LoopStatistics& loopStatistics, std::string const& costsFile, double threshold);
+
+  [[nodiscard]] bool isEnabled() const { return loopStatistics != nullptr; }
+
+  /**
+   * Computes the imbalance since the last check and exports the costs if it exceeds the threshold.
+   * Collective; all ranks have to call this function at the same synchronization point.
+   */
+  void check(std::vector<std::unique_ptr<TimeCluster>> const& clusters);
+
+  private:
+  enum Region { Local = 0, Neighbor, DynamicRupture, NumRegions };
+
+  /**
+   * Measured costs per global cluster id since the last check.
+   */
+  std::vector<ClusterCosts> collectClusterCosts(std::vector<std::unique_ptr<TimeCluster>> const& clusters);
+
+  /**
+   * Measured costs per mesh element, normalized by the global mean.
+   */
+  std::vector<double> computeElementCosts(std::vector<std::unique_ptr<TimeCluster>> const& clusters,
+                                          std::vector<ClusterCosts> const& clusterCosts);
+
+  void writeCosts(std::vector<double> const& elementCosts);
+
+  LoopStatistics* loopStatistics = nullptr;
+  std::string costsFile;
+  double threshold = 0.0;
+
+  std::array<unsigned, NumRegions> regions{};
+  std::array<std::size_t, NumRegions> firstSamples{};
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_CELLCOSTEXPORTER_H
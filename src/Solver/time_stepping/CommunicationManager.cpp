@@ -1,5 +1,6 @@
 #include "CommunicationManager.h"
 
+#include "Parallel/MPI.h"
 #include "Parallel/Pin.h"
 
 seissol::time_stepping::AbstractCommunicationManager::AbstractCommunicationManager(
@@ -14,9 +15,14 @@ void seissol::time_stepping::AbstractCommunicationManager::reset(double newSyncT
 }
 
 bool seissol::time_stepping::AbstractCommunicationManager::poll() {
+  bool isStateChanged = false;
+  return poll(isStateChanged);
+}
+
+bool seissol::time_stepping::AbstractCommunicationManager::poll(bool& isStateChanged) {
   bool finished = true;
   for (auto& ghostCluster : ghostClusters) {
-    ghostCluster->act();
+    isStateChanged = ghostCluster->act().isStateChanged || isStateChanged;
     finished = finished && ghostCluster->synced();
   }
   return finished;
@@ -44,13 +50,17 @@ seissol::time_stepping::ThreadedCommunicationManager::ThreadedCommunicationManag
     const seissol::parallel::Pinning* pinning)
     : AbstractCommunicationManager(std::move(ghostClusters)),
       thread(),
-      shouldReset(false),
+      isSleeping(false),
       isFinished(false),
       pinning(pinning) {
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::progression() {
-  // Do nothing: Thread takes care of that.
+  // The thread progresses the ghost clusters; we only wake it up if it sleeps.
+  // A missed notification only delays the thread by SleepDuration.
+  if (isSleeping.load(std::memory_order_relaxed)) {
+    wakeUp.notify_one();
+  }
 }
 
 bool seissol::time_stepping::ThreadedCommunicationManager::checkIfFinished() const {
@@ -58,35 +68,108 @@ bool seissol::time_stepping::ThreadedCommunicationManager::checkIfFinished() con
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncTime) {
-  // Send signal to comm. thread to finish and wait.
-  shouldReset.store(true);
-  if (thread.joinable()) {
-    thread.join();
-  }
+  std::unique_lock<std::mutex> lock(mutex);
+  // Wait until the thread finished the last interval
+  parked.wait(lock, [this]() { return !isRunning; });
 
-  // Reset flags and reset ghost clusters
-  shouldReset.store(false);
   isFinished.store(false);
   AbstractCommunicationManager::reset(newSyncTime);
 
-  // Start a new communication thread.
-  // Note: Easier than keeping one alive, and not that expensive.
-  thread = std::thread([this](){
-    // Pin this thread to the last core
-    // We compute the mask outside the thread because otherwise
-    // it confuses profilers and debuggers!
-    pinning->pinToFreeCPUs();
-    while(!shouldReset.load() && !isFinished.load()) {
-      isFinished.store(this->poll());
+  if (!thread.joinable()) {
+    thread = std::thread([this]() { run(); });
+  }
+  isRunning = true;
+  lock.unlock();
+  wakeUp.notify_one();
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::run() {
+  // Pin this thread to the last core
+  // We compute the mask outside the thread because otherwise
+  // it confuses profilers and debuggers!
+  pinning->pinToFreeCPUs();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    wakeUp.wait(lock, [this]() { return isRunning || shouldStop; });
+    if (shouldStop) {
+      break;
+    }
+    lock.unlock();
+    const auto times = progressUntilFinished();
+    lock.lock();
+    totalTimes.useful += times.useful;
+    totalTimes.idle += times.idle;
+    totalTimes.sleep += times.sleep;
+    isRunning = false;
+    parked.notify_all();
+  }
+}
+
+seissol::time_stepping::ThreadedCommunicationManager::ThreadTimes
+    seissol::time_stepping::ThreadedCommunicationManager::progressUntilFinished() {
+  using Clock = std::chrono::steady_clock;
+
+  ThreadTimes times;
+  unsigned idleIterations = 0;
+  auto last = Clock::now();
+  while (!isFinished.load()) {
+    bool isStateChanged = false;
+    isFinished.store(poll(isStateChanged));
+
+    idleIterations = isStateChanged ? 0 : idleIterations + 1;
+    if (idleIterations > SpinIterations + YieldIterations) {
+      std::unique_lock<std::mutex> lock(mutex);
+      isSleeping.store(true, std::memory_order_relaxed);
+      wakeUp.wait_for(lock, SleepDuration);
+      isSleeping.store(false, std::memory_order_relaxed);
+    } else if (idleIterations > SpinIterations) {
+      std::this_thread::yield();
+    }
+
+    const auto now = Clock::now();
+    const double elapsed = std::chrono::duration<double>(now - last).count();
+    last = now;
+    if (isStateChanged) {
+      times.useful += elapsed;
+    } else if (idleIterations > SpinIterations + YieldIterations) {
+      times.sleep += elapsed;
+    } else {
+      times.idle += elapsed;
     }
-  });
+  }
+  return times;
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::printStatistics() const {
+  double times[3];
+  {
+    // The thread publishes its times when it parks; read them from a finished interval only
+    std::unique_lock<std::mutex> lock(mutex);
+    parked.wait(lock, [this]() { return !isRunning; });
+    times[0] = totalTimes.useful;
+    times[1] = totalTimes.idle;
+    times[2] = totalTimes.sleep;
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, times, 3, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+#endif
+  const double total = times[0] + times[1] + times[2];
+  if (total > 0.0) {
+    logInfo(seissol::MPI::mpi.rank())
+        << "Communication thread: useful progress" << 100.0 * times[0] / total
+        << "%, spinning" << 100.0 * times[1] / total
+        << "%, sleeping" << 100.0 * times[2] / total << "% (summed over all ranks).";
+  }
 }
 
 seissol::time_stepping::ThreadedCommunicationManager::~ThreadedCommunicationManager() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    shouldStop = true;
+  }
+  wakeUp.notify_one();
   if (thread.joinable()) {
     thread.join();
   }
 }
-
-
-
@@ -2,7 +2,10 @@
 #define SEISSOL_COMMUNICATIONMANAGER_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <Parallel/Pin.h>
@@ -17,12 +20,15 @@ public:
   virtual void progression() = 0;
   [[nodiscard]] virtual bool checkIfFinished() const = 0;
   virtual void reset(double newSyncTime);
+  virtual void printStatistics() const {}
 
   virtual ~AbstractCommunicationManager() = default;
 
 protected:
   explicit AbstractCommunicationManager(ghostClusters_t ghostClusters);
   bool poll();
+  //! same as poll(), isStateChanged is set to true if any ghost cluster changed its state
+  bool poll(bool& isStateChanged);
   ghostClusters_t ghostClusters;
 
 };
@@ -34,6 +40,12 @@ public:
   [[nodiscard]] bool checkIfFinished() const override;
 };
 
+/**
+ * Progresses the ghost clusters on a separate (pinned) thread.
+ * The thread is started once and parks on a condition variable between two synchronization points.
+ * If the ghost clusters make no progress, the thread first spins, then yields and finally
+ * sleeps until it is woken up by progression() or a timeout.
+ */
 class ThreadedCommunicationManager : public AbstractCommunicationManager {
 public:
   ThreadedCommunicationManager(ghostClusters_t ghostClusters,
@@ -41,14 +53,45 @@ public:
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
   void reset(double newSyncTime) override;
+  void printStatistics() const override;
 
   ~ThreadedCommunicationManager() override;
 
 private:
+  //! polls without progress before the thread yields
+  static constexpr unsigned SpinIterations = 1000;
+  //! polls without progress before the thread sleeps
+  static constexpr unsigned YieldIterations = 10000;
+  //! maximum sleep time, such that MPI requests are still progressed
+  static constexpr std::chrono::microseconds SleepDuration{50};
+
+  //! time spent by the thread during one interval
+  struct ThreadTimes {
+    //! time spent in polls which changed the state of a ghost cluster
+    double useful = 0.0;
+    //! time spent in polls without progress, spinning or yielding
+    double idle = 0.0;
+    //! time spent sleeping while no progress was made
+    double sleep = 0.0;
+  };
+
+  void run();
+  ThreadTimes progressUntilFinished();
+
   std::thread thread;
-  std::atomic<bool> shouldReset;
+  mutable std::mutex mutex;
+  //! wakes up the thread at the start of an interval or while it sleeps
+  std::condition_variable wakeUp;
+  //! signals reset() and printStatistics() that the thread finished its interval
+  mutable std::condition_variable parked;
+  bool isRunning = false;
+  bool shouldStop = false;
+  std::atomic<bool> isSleeping;
   std::atomic<bool> isFinished;
   const parallel::Pinning* pinning;
+
+  //! accumulated over all finished intervals; guarded by mutex
+  ThreadTimes totalTimes;
 };
 
 } // end namespace seissol::time_stepping
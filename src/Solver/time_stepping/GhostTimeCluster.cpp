@@ -3,64 +3,138 @@
 
 #include "GhostTimeCluster.h"
 
+#include <generated_code/tensor.h>
+#include <yateto.h>
+
+namespace {
+/**
+ * Datatype of a message with the packed buffers (reduced precision) followed by the derivatives
+ * of a copy or ghost region (full precision). The derivatives are sent from and received into the
+ * region directly. The displacements are absolute, i.e. the message starts at MPI_BOTTOM.
+ */
+MPI_Datatype createRegionType(seissol::kernels::mixed_precision::ReducedReal* packedBuffers,
+                              unsigned numberOfBuffers,
+                              real* derivatives,
+                              unsigned numberOfDerivatives) {
+  int blockLengths[2] = {static_cast<int>(numberOfBuffers * tensor::I::size()),
+                         static_cast<int>(numberOfDerivatives *
+                                          yateto::computeFamilySize<tensor::dQ>())};
+  MPI_Aint displacements[2];
+  MPI_Get_address(packedBuffers, &displacements[0]);
+  MPI_Get_address(derivatives, &displacements[1]);
+  MPI_Datatype types[2] = {MPI_FLOAT, MPI_C_REAL};
+
+  MPI_Datatype regionType;
+  MPI_Type_create_struct(2, blockLengths, displacements, types, &regionType);
+  MPI_Type_commit(&regionType);
+  return regionType;
+}
+} // namespace
+
 namespace seissol::time_stepping {
-void GhostTimeCluster::sendCopyLayer(){
-  SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
-  assert(ct.correctionTime > lastSendTime);
-  lastSendTime = ct.correctionTime;
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
-     MPI_Isend(meshStructure->copyRegions[region],
-                static_cast<int>(meshStructure->copyRegionSizes[region]),
-                MPI_C_REAL,
-                meshStructure->neighboringClusters[region][0],
-                timeData + meshStructure->sendIdentifiers[region],
-                seissol::MPI::mpi.comm(),
-                meshStructure->sendRequests + region
-               );
-      sendQueue.push_back(meshStructure->sendRequests + region);
+void GhostTimeCluster::RequestBatch::start() {
+  assert(numberOfPending == 0);
+  MPI_Startall(static_cast<int>(requests.size()), requests.data());
+  numberOfPending = static_cast<int>(requests.size());
+}
+
+bool GhostTimeCluster::RequestBatch::test() {
+  if (numberOfPending > 0) {
+    int numberOfCompleted = 0;
+    // Inactive requests (i.e. the ones completed before) are ignored
+    MPI_Testsome(static_cast<int>(requests.size()),
+                 requests.data(),
+                 &numberOfCompleted,
+                 completedIndices.data(),
+                 MPI_STATUSES_IGNORE);
+    if (numberOfCompleted != MPI_UNDEFINED) {
+      numberOfPending -= numberOfCompleted;
     }
   }
-} void GhostTimeCluster::receiveGhostLayer(){
-  SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
-  assert(ct.predictionTime > lastSendTime);
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-      MPI_Irecv(meshStructure->ghostRegions[region],
-                static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                MPI_C_REAL,
-                meshStructure->neighboringClusters[region][0],
-                timeData + meshStructure->receiveIdentifiers[region],
-                seissol::MPI::mpi.comm(),
-                meshStructure->receiveRequests + region
-               );
-      receiveQueue.push_back(meshStructure->receiveRequests + region );
+  return numberOfPending == 0;
+}
+
+void GhostTimeCluster::RequestBatch::free() {
+  // The shutdown may happen while requests are active, e.g. the receives of the next time step
+  if (numberOfPending > 0) {
+    for (auto& request : requests) {
+      int isCompleted = 0;
+      MPI_Request_get_status(request, &isCompleted, MPI_STATUS_IGNORE);
+      if (!isCompleted) {
+        MPI_Cancel(&request);
+      }
+    }
+    // Receives can be cancelled, but sends may not (e.g. Open MPI); they only complete once the
+    // other rank receives them. Hence, we do not wait forever.
+    constexpr double Timeout = 10.0;
+    const double deadline = MPI_Wtime() + Timeout;
+    int isCompleted = 0;
+    while (!isCompleted && MPI_Wtime() < deadline) {
+      MPI_Testall(static_cast<int>(requests.size()), requests.data(), &isCompleted, MPI_STATUSES_IGNORE);
     }
+    if (!isCompleted) {
+      logWarning(MPI::mpi.rank()) << "Freeing ghost layer requests which did not complete within"
+                                  << Timeout << "seconds.";
+    }
+    numberOfPending = 0;
+  }
+  for (auto& request : requests) {
+    MPI_Request_free(&request);
   }
+  requests.clear();
 }
 
+void GhostTimeCluster::packCopyLayer() {
+  for (auto& packed : packedCopyRegions) {
+    kernels::mixed_precision::packBuffers(meshStructure->copyRegions[packed.region],
+                                          packed.numberOfBuffers,
+                                          tensor::I::size(),
+                                          packed.data.data());
+  }
+}
 
-bool GhostTimeCluster::testQueue(std::list<MPI_Request*>& queue) {
-  for (auto request = queue.begin(); request != queue.end(); ) {
-    int testSuccess = 0;
-    MPI_Test(*request, &testSuccess, MPI_STATUS_IGNORE);
-    if (testSuccess) {
-      request = queue.erase(request);
-    } else {
-      ++request;
-    }
+void GhostTimeCluster::unpackGhostLayer() {
+  for (const auto& packed : packedGhostRegions) {
+    kernels::mixed_precision::unpackBuffers(packed.data.data(),
+                                            packed.numberOfBuffers,
+                                            tensor::I::size(),
+                                            meshStructure->ghostRegions[packed.region]);
+  }
+  ghostLayerUnpacked = true;
+}
+
+void GhostTimeCluster::sendCopyLayer(){
+  SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.correctionTime > lastSendTime);
+  lastSendTime = ct.correctionTime;
+  if (reducedPrecision) {
+    packCopyLayer();
   }
-  return queue.empty();
+  sendRequests.start();
 }
+
+void GhostTimeCluster::receiveGhostLayer(){
+  SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.predictionTime > lastSendTime);
+  assert(ghostLayerUnpacked);
+  receiveRequests.start();
+  ghostLayerUnpacked = !reducedPrecision;
+}
+
 bool GhostTimeCluster::testForGhostLayerReceives(){
   SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
-  return testQueue(receiveQueue);
+  const bool received = receiveRequests.test();
+  // Convert the ghost layer before the neighboring cluster may read it
+  if (received && !ghostLayerUnpacked) {
+    unpackGhostLayer();
+  }
+  return received;
 }
 
 
 bool GhostTimeCluster::testForCopyLayerSends(){
   SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
-  return testQueue(sendQueue);
+  return sendRequests.test();
 }
 
 ActResult GhostTimeCluster::act() {
@@ -117,14 +191,94 @@ void GhostTimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster
 }
 
 GhostTimeCluster::GhostTimeCluster(double maxTimeStepSize,
-                                   int timeStepRate,
+                                   long timeStepRate,
                                    int globalTimeClusterId,
                                    int otherGlobalTimeClusterId,
                                    const MeshStructure *meshStructure)
     : AbstractTimeCluster(maxTimeStepSize, timeStepRate),
       globalClusterId(globalTimeClusterId),
       otherGlobalClusterId(otherGlobalTimeClusterId),
-      meshStructure(meshStructure) {
+      meshStructure(meshStructure),
+      reducedPrecision(kernels::mixed_precision::useReducedPrecisionBuffers()) {
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      void* copyRegion = meshStructure->copyRegions[region];
+      void* ghostRegion = meshStructure->ghostRegions[region];
+      int copyRegionSize = static_cast<int>(meshStructure->copyRegionSizes[region]);
+      int ghostRegionSize = static_cast<int>(meshStructure->ghostRegionSizes[region]);
+      MPI_Datatype copyDatatype = MPI_C_REAL;
+      MPI_Datatype ghostDatatype = MPI_C_REAL;
+
+      if (reducedPrecision) {
+        // copy and ghost regions store the buffers followed by the derivatives
+        const unsigned numberOfCopyDerivatives =
+            meshStructure->numberOfCommunicatedCopyRegionDerivatives[region];
+        auto& packedCopy = packedCopyRegions.emplace_back();
+        packedCopy.region = region;
+        packedCopy.numberOfBuffers =
+            meshStructure->numberOfCopyRegionCells[region] - numberOfCopyDerivatives;
+        packedCopy.data.resize(packedCopy.numberOfBuffers * tensor::I::size());
+        copyDatatype = regionTypes.emplace_back(
+            createRegionType(packedCopy.data.data(),
+                             packedCopy.numberOfBuffers,
+                             meshStructure->copyRegions[region] +
+                                 packedCopy.numberOfBuffers * tensor::I::size(),
+                             numberOfCopyDerivatives));
+
+        const unsigned numberOfGhostDerivatives =
+            meshStructure->numberOfGhostRegionDerivatives[region];
+        auto& packedGhost = packedGhostRegions.emplace_back();
+        packedGhost.region = region;
+        packedGhost.numberOfBuffers =
+            meshStructure->numberOfGhostRegionCells[region] - numberOfGhostDerivatives;
+        packedGhost.data.resize(packedGhost.numberOfBuffers * tensor::I::size());
+        ghostDatatype = regionTypes.emplace_back(
+            createRegionType(packedGhost.data.data(),
+                             packedGhost.numberOfBuffers,
+                             meshStructure->ghostRegions[region] +
+                                 packedGhost.numberOfBuffers * tensor::I::size(),
+                             numberOfGhostDerivatives));
+
+        copyRegion = MPI_BOTTOM;
+        ghostRegion = MPI_BOTTOM;
+        copyRegionSize = 1;
+        ghostRegionSize = 1;
+      }
+
+      MPI_Request& sendRequest = sendRequests.requests.emplace_back(MPI_REQUEST_NULL);
+      MPI_Send_init(copyRegion,
+                    copyRegionSize,
+                    copyDatatype,
+                    meshStructure->neighboringClusters[region][0],
+                    timeData + meshStructure->sendIdentifiers[region],
+                    seissol::MPI::mpi.comm(),
+                    &sendRequest);
+      MPI_Request& receiveRequest = receiveRequests.requests.emplace_back(MPI_REQUEST_NULL);
+      MPI_Recv_init(ghostRegion,
+                    ghostRegionSize,
+                    ghostDatatype,
+                    meshStructure->neighboringClusters[region][0],
+                    timeData + meshStructure->receiveIdentifiers[region],
+                    seissol::MPI::mpi.comm(),
+                    &receiveRequest);
+    }
+  }
+  sendRequests.completedIndices.resize(sendRequests.requests.size());
+  receiveRequests.completedIndices.resize(receiveRequests.requests.size());
+}
+
+GhostTimeCluster::~GhostTimeCluster() {
+  // The time manager may be destroyed after MPI_Finalize
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    // Receives first: cancelling them does not depend on the other rank
+    receiveRequests.free();
+    sendRequests.free();
+    for (auto& regionType : regionTypes) {
+      MPI_Type_free(&regionType);
+    }
+  }
 }
 void GhostTimeCluster::reset() {
   AbstractTimeCluster::reset();
@@ -1,8 +1,9 @@
 #ifndef SEISSOL_GHOSTTIMECLUSTER_H
 #define SEISSOL_GHOSTTIMECLUSTER_H
 
-#include <list>
+#include <vector>
 #include "Initializer/typedefs.hpp"
+#include "Kernels/MixedPrecision.h"
 #include "AbstractTimeCluster.h"
 
 namespace seissol::time_stepping {
@@ -12,15 +13,52 @@ class GhostTimeCluster : public AbstractTimeCluster {
   const int globalClusterId;
   const int otherGlobalClusterId;
   const MeshStructure* meshStructure;
-  std::list<MPI_Request*> sendQueue;
-  std::list<MPI_Request*> receiveQueue;
+
+  /**
+   * Persistent requests for all regions shared with the other cluster.
+   * The requests are created once and started together every time step.
+   */
+  struct RequestBatch {
+    std::vector<MPI_Request> requests;
+    //! scratch memory for MPI_Testsome
+    std::vector<int> completedIndices;
+    //! number of started requests which are not completed yet
+    int numberOfPending = 0;
+
+    void start();
+    bool test();
+    //! cancels and completes pending requests (bounded wait) before freeing all requests
+    void free();
+  };
+  RequestBatch sendRequests;
+  RequestBatch receiveRequests;
+
+  /**
+   * The buffers of a copy or ghost region, which are exchanged in reduced precision
+   * (SEISSOL_MIXED_PRECISION). The derivatives of the region are exchanged in full precision in the
+   * same message (see regionTypes).
+   */
+  struct PackedRegion {
+    unsigned region;
+    unsigned numberOfBuffers;
+    std::vector<kernels::mixed_precision::ReducedReal> data;
+  };
+  const bool reducedPrecision;
+  std::vector<PackedRegion> packedCopyRegions;
+  std::vector<PackedRegion> packedGhostRegions;
+  //! datatypes of the messages with packed buffers and derivatives (absolute addresses)
+  std::vector<MPI_Datatype> regionTypes;
+  //! false while the received ghost layer is not converted yet
+  bool ghostLayerUnpacked = true;
 
   double lastSendTime = -1.0;
 
+  void packCopyLayer();
+  void unpackGhostLayer();
+
   void sendCopyLayer();
   void receiveGhostLayer();
 
-  static bool testQueue(std::list<MPI_Request*>& queue);
   bool testForCopyLayerSends();
   bool testForGhostLayerReceives();
 
@@ -36,11 +74,12 @@ class GhostTimeCluster : public AbstractTimeCluster {
 
  public:
   GhostTimeCluster(double maxTimeStepSize,
-                   int timeStepRate,
+                   long timeStepRate,
                    int globalTimeClusterId,
                    int otherGlobalTimeClusterId,
                    const MeshStructure* meshStructure
   );
+  ~GhostTimeCluster() override;
   void reset() override;
   ActResult act() override;
 
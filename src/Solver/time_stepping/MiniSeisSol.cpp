@@ -42,7 +42,18 @@
 
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
+#include <Kernels/Neighbor.h>
+#include <Kernels/DynamicRupture.h>
+#include <Kernels/Plasticity.h>
 #include <Monitoring/Stopwatch.h>
+#include <generated_code/tensor.h>
+#include <yateto.h>
+
+#include <algorithm>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 void seissol::localIntegration( struct GlobalData* globalData,
                                 initializers::LTS& lts,
@@ -53,13 +64,15 @@ void seissol::localIntegration( struct GlobalData* globalData,
   timeKernel.setHostGlobalData(globalData);
 
   real**                buffers                       = layer.var(lts.buffers);
+  CellMaterialData*     materialData                  = layer.var(lts.material);
+  CellBoundaryMapping (*boundaryMapping)[4]           = layer.var(lts.boundaryMapping);
 
   kernels::LocalData::Loader loader;
   loader.load(lts, layer);
-  kernels::LocalTmp tmp;
+  kernels::LocalTmp tmp{};
 
 #ifdef _OPENMP
-  #pragma omp parallel for private(tmp) schedule(static)
+  #pragma omp parallel for firstprivate(tmp) schedule(static)
 #endif
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
     auto data = loader.entry(cell);
@@ -71,13 +84,58 @@ void seissol::localIntegration( struct GlobalData* globalData,
     localKernel.computeIntegral(buffers[cell],
                                 data,
                                 tmp,
-                                nullptr,
-                                nullptr,
+                                &materialData[cell],
+                                &boundaryMapping[cell],
                                 0.0,
                                 0.0);
   }
 }
 
+void seissol::neighboringIntegration( struct GlobalData* globalData,
+                                      initializers::LTS& lts,
+                                      initializers::Layer& layer ) {
+  kernels::Neighbor neighborKernel;
+  neighborKernel.setHostGlobalData(globalData);
+
+  real*               (*faceNeighbors)[4]             = layer.var(lts.faceNeighbors);
+  CellDRMapping       (*drMapping)[4]                 = layer.var(lts.drMapping);
+
+  kernels::NeighborData::Loader loader;
+  loader.load(lts, layer);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    auto data = loader.entry(cell);
+    neighborKernel.computeNeighborsIntegral(data,
+                                            drMapping[cell],
+                                            faceNeighbors[cell],
+                                            faceNeighbors[cell]);
+  }
+}
+
+void seissol::plasticity( struct GlobalData* globalData,
+                          initializers::LTS& lts,
+                          initializers::Layer& layer ) {
+  real                (*dofs)[tensor::Q::size()]      = layer.var(lts.dofs);
+  PlasticityData*       plasticityData                = layer.var(lts.plasticity);
+  real                (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = layer.var(lts.pstrain);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    kernels::Plasticity::computePlasticity(0.5,
+                                           miniSeisSolTimeStep,
+                                           miniSeisSolTimeStep,
+                                           globalData,
+                                           &plasticityData[cell],
+                                           dofs[cell],
+                                           pstrain[cell]);
+  }
+}
+
 void seissol::fillWithStuff(  real* buffer,
                               unsigned nValues) {
 #ifdef _OPENMP
@@ -149,12 +207,44 @@ void seissol::fakeData(initializers::LTS& lts,
 #endif
 }
 
-double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity) {
-  struct GlobalData* globalData = memoryManager.getGlobalDataOnHost();
+void seissol::fakeBoundaryData(initializers::LTS& lts,
+                               initializers::Layer& layer,
+                               BoundaryFaceInformation* boundaryFaces) {
+  CellMaterialData*     materialData                  = layer.var(lts.material);
+  CellBoundaryMapping (*boundaryMapping)[4]           = layer.var(lts.boundaryMapping);
 
-  initializers::LTSTree ltsTree;
-  initializers::LTS     lts;
+  fillWithStuff(reinterpret_cast<real*>(boundaryFaces), sizeof(BoundaryFaceInformation)/sizeof(real) * 4 * layer.getNumberOfCells());
 
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    materialData[cell].local.rho = 1.0;
+    for (unsigned f = 0; f < 4; ++f) {
+      auto& face = boundaryFaces[4 * cell + f];
+      boundaryMapping[cell][f] = CellBoundaryMapping{face.nodes, face.TData, face.TinvData,
+                                                     face.easiBoundaryConstant, face.easiBoundaryMap};
+    }
+  }
+}
+
+void seissol::fakePlasticityData(initializers::LTS& lts,
+                                 initializers::Layer& layer) {
+  PlasticityData*       plasticityData                = layer.var(lts.plasticity);
+
+  fillWithStuff(reinterpret_cast<real*>(plasticityData), sizeof(PlasticityData)/sizeof(real) * layer.getNumberOfCells());
+  // Zero cohesion and friction: every element yields, i.e. we measure the worst case
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    plasticityData[cell].cohesionTimesCosAngularFriction = 0.0;
+    plasticityData[cell].sinAngularFriction = 0.0;
+    plasticityData[cell].mufactor = 1.0;
+  }
+}
+
+seissol::initializers::Layer& seissol::initializeFakeTree(initializers::LTSTree& ltsTree,
+                                                         initializers::LTS& lts,
+                                                         bool usePlasticity,
+                                                         unsigned numberOfCells) {
   lts.addTo(ltsTree, usePlasticity);
   ltsTree.setNumberOfTimeClusters(1);
   ltsTree.fixate();
@@ -162,7 +252,7 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   initializers::TimeCluster& cluster = ltsTree.child(0);
   cluster.child<Ghost>().setNumberOfCells(0);
   cluster.child<Copy>().setNumberOfCells(0);
-  cluster.child<Interior>().setNumberOfCells(50000);
+  cluster.child<Interior>().setNumberOfCells(numberOfCells);
 
   ltsTree.allocateVariables();
   ltsTree.touchVariables();
@@ -171,6 +261,16 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   
   layer.setBucketSize(lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
   ltsTree.allocateBuckets();
+
+  return layer;
+}
+
+double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity) {
+  struct GlobalData* globalData = memoryManager.getGlobalDataOnHost();
+
+  initializers::LTSTree ltsTree;
+  initializers::LTS     lts;
+  initializers::Layer& layer = initializeFakeTree(ltsTree, lts, usePlasticity, 50000);
   
   fakeData(lts, layer);
   
@@ -183,3 +283,118 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   }
   return stopwatch.stop();
 }
+
+namespace {
+/**
+ * Returns the run time of one call of kernel, divided by count.
+ */
+template<typename Kernel>
+double measure(Kernel&& kernel, unsigned count) {
+  constexpr unsigned NumberOfRepetitions = 10;
+  // Warm-up
+  kernel();
+
+  seissol::Stopwatch stopwatch;
+  stopwatch.start();
+  for (unsigned t = 0; t < NumberOfRepetitions; ++t) {
+    kernel();
+  }
+  return stopwatch.stop() / (NumberOfRepetitions * count);
+}
+} // namespace
+
+seissol::initializers::time_stepping::KernelCosts seissol::measureKernelCosts(initializers::MemoryManager& memoryManager,
+                                                                              bool usePlasticity) {
+  constexpr unsigned NumberOfCells = 20000;
+  constexpr unsigned NumberOfDynamicRuptureFaces = 2000;
+
+  struct GlobalData* globalData = memoryManager.getGlobalDataOnHost();
+  initializers::time_stepping::KernelCosts costs;
+
+  initializers::LTSTree ltsTree;
+  initializers::LTS     lts;
+  initializers::Layer& layer = initializeFakeTree(ltsTree, lts, usePlasticity, NumberOfCells);
+  fakeData(lts, layer);
+
+  costs.local = measure([&]() { localIntegration(globalData, lts, layer); }, NumberOfCells);
+  costs.neighbor = measure([&]() { neighboringIntegration(globalData, lts, layer); }, NumberOfCells);
+  if (usePlasticity) {
+    fakePlasticityData(lts, layer);
+    costs.plasticity = measure([&]() { plasticity(globalData, lts, layer); }, NumberOfCells);
+  }
+
+#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
+  {
+    // The additional costs of a face with gravitational free surface boundary condition
+    // w.r.t. a regular face in the local integration
+    memory::ManagedAllocator allocator;
+    auto* boundaryFaces = static_cast<BoundaryFaceInformation*>(
+        allocator.allocateMemory(4 * NumberOfCells * sizeof(BoundaryFaceInformation), ALIGNMENT));
+    fakeData(lts, layer, FaceType::freeSurfaceGravity);
+    fakeBoundaryData(lts, layer, boundaryFaces);
+    const double gravity = measure([&]() { localIntegration(globalData, lts, layer); }, NumberOfCells);
+    costs.freeSurfaceWithGravity = std::max(0.0, (gravity - costs.local) / 4.0);
+  }
+#endif
+
+  {
+    // Space-time interpolation of the dynamic rupture faces. The costs of the friction law are
+    // not included as they depend on the friction law and the state of the fault.
+    constexpr auto DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+    constexpr auto QInterpolatedSize = CONVERGENCE_ORDER * tensor::QInterpolated::size();
+    int numberOfThreads = 1;
+#ifdef _OPENMP
+    numberOfThreads = omp_get_max_threads();
+#endif
+
+    memory::ManagedAllocator allocator;
+    auto* derivatives = static_cast<real*>(
+        allocator.allocateMemory(NumberOfDynamicRuptureFaces * DerivativesSize * sizeof(real), ALIGNMENT));
+    auto* godunovData = static_cast<DRGodunovData*>(
+        allocator.allocateMemory(NumberOfDynamicRuptureFaces * sizeof(DRGodunovData), ALIGNMENT));
+    auto* qInterpolated = static_cast<real*>(
+        allocator.allocateMemory(2 * numberOfThreads * QInterpolatedSize * sizeof(real), ALIGNMENT));
+    fillWithStuff(derivatives, NumberOfDynamicRuptureFaces * DerivativesSize);
+    fillWithStuff(reinterpret_cast<real*>(godunovData), sizeof(DRGodunovData)/sizeof(real) * NumberOfDynamicRuptureFaces);
+
+    std::vector<DRFaceInformation> faceInformation(NumberOfDynamicRuptureFaces);
+    for (auto& face : faceInformation) {
+      face.plusSide = static_cast<unsigned>(lrand48() % 4);
+      face.minusSide = static_cast<unsigned>(lrand48() % 4);
+      face.faceRelation = static_cast<unsigned>(lrand48() % 3);
+    }
+
+    kernels::DynamicRupture dynamicRuptureKernel;
+    dynamicRuptureKernel.setHostGlobalData(globalData);
+    dynamicRuptureKernel.setTimeStepWidth(miniSeisSolTimeStep);
+
+    costs.dynamicRupture = measure([&]() {
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (unsigned face = 0; face < NumberOfDynamicRuptureFaces; ++face) {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        using QInterpolatedT = real[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+        auto* qInterpolatedPlus = reinterpret_cast<QInterpolatedT*>(qInterpolated + 2 * thread * QInterpolatedSize);
+        auto* qInterpolatedMinus = reinterpret_cast<QInterpolatedT*>(qInterpolated + (2 * thread + 1) * QInterpolatedSize);
+        const real* derivativesPlus = derivatives + face * DerivativesSize;
+        const real* derivativesMinus = derivatives + ((face + 1) % NumberOfDynamicRuptureFaces) * DerivativesSize;
+        dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
+                                                    globalData,
+                                                    &godunovData[face],
+                                                    nullptr,
+                                                    derivativesPlus,
+                                                    derivativesMinus,
+                                                    *qInterpolatedPlus,
+                                                    *qInterpolatedMinus,
+                                                    derivativesPlus,
+                                                    derivativesMinus);
+      }
+    }, NumberOfDynamicRuptureFaces);
+  }
+
+  return costs;
+}
@@ -42,20 +42,50 @@
 #define MINISEISSOL_H_
 
 #include <Initializer/MemoryManager.h>
+#include <Initializer/time_stepping/LtsWeights/CostModel.h>
 
 namespace seissol {
   void localIntegration(  struct GlobalData* globalData,
                           initializers::LTS& lts,
                           initializers::Layer& layer );
   
+  void neighboringIntegration( struct GlobalData* globalData,
+                               initializers::LTS& lts,
+                               initializers::Layer& layer );
+
+  void plasticity( struct GlobalData* globalData,
+                   initializers::LTS& lts,
+                   initializers::Layer& layer );
+
   void fillWithStuff( real* buffer,
                       unsigned nValues );
 
   void fakeData(  initializers::LTS& lts,
                   initializers::Layer& layer,
                   FaceType faceTp = FaceType::regular);
+
+  //! Points the boundary mapping to boundaryFaces (4 per cell)
+  void fakeBoundaryData( initializers::LTS& lts,
+                         initializers::Layer& layer,
+                         BoundaryFaceInformation* boundaryFaces );
+
+  void fakePlasticityData( initializers::LTS& lts,
+                           initializers::Layer& layer );
+
+  //! Creates a tree with a single interior layer of numberOfCells cells
+  initializers::Layer& initializeFakeTree( initializers::LTSTree& ltsTree,
+                                           initializers::LTS& lts,
+                                           bool usePlasticity,
+                                           unsigned numberOfCells );
   
   double miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity);
+
+  /**
+   * Measures the run time of the local, neighbor, plasticity, dynamic rupture
+   * and free surface with gravity kernels on fake data.
+   */
+  initializers::time_stepping::KernelCosts measureKernelCosts(initializers::MemoryManager& memoryManager,
+                                                              bool usePlasticity);
   const real miniSeisSolTimeStep = 1.0;
 }
 
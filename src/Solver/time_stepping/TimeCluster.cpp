@@ -80,19 +80,41 @@
 #include <Solver/Interoperability.h>
 #include <SourceTerm/PointSource.h>
 #include <Kernels/TimeCommon.h>
+#include <Kernels/MixedPrecision.h>
 #include <Kernels/DynamicRupture.h>
 #include <Kernels/Receiver.h>
+#include <Initializer/BatchRecorders/Recorders.h>
 #include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/instrumentation.fpp>
 
 #include <cassert>
 #include <cstring>
+#include <mutex>
 
 #include <generated_code/kernel.h>
 
 //! fortran interoperability
 extern seissol::Interoperability e_interoperability;
 
+namespace {
+  /**
+   * The friction solver and the fault output manager are shared by all clusters.
+   * With task-based scheduling, copy and interior actors (and different clusters) may
+   * correct concurrently; hence, dynamic rupture and fault output are serialized.
+   */
+  std::mutex dynamicRuptureMutex;
+
+  /**
+   * Flop counters are updated by concurrently running clusters with task-based scheduling.
+   */
+  void addFlops(long long& counter, long long flops) {
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    counter += flops;
+  }
+}
+
 seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsigned int i_globalClusterId,
                                                  bool usePlasticity,
                                                  LayerType layerType, double maxTimeStepSize,
@@ -155,6 +177,15 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
+
+  if (usePlasticity) {
+    numberOfYields.resize(m_clusterData->getNumberOfCells(), 0);
+  }
+
+#ifndef ACL_DEVICE
+  batchedNeighborIntegration = initializers::recording::useHostBatchedNeighborIntegration();
+  reducedPrecisionBuffers = kernels::mixed_precision::useReducedPrecisionBuffers();
+#endif
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -172,11 +203,22 @@ void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::CellToPoi
   m_pointSources = i_pointSources;
 }
 
-void seissol::time_stepping::TimeCluster::writeReceivers() {
+void seissol::time_stepping::TimeCluster::writeReceivers(bool afterLocalIntegration) {
   SCOREP_USER_REGION("writeReceivers", SCOREP_USER_REGION_TYPE_FUNCTION)
 
   if (m_receiverCluster != nullptr) {
-    m_receiverTime = m_receiverCluster->calcReceivers(m_receiverTime, ct.correctionTime, timeStepSize());
+    if (!afterLocalIntegration) {
+      // The DOFs are still unchanged, the receiver time is advanced in the second call
+      m_receiverCluster->calcReceivers(m_receiverTime,
+                                       ct.correctionTime,
+                                       timeStepSize(),
+                                       kernels::ReceiverSelection::WithoutStoredDerivatives);
+    } else {
+      m_receiverTime = m_receiverCluster->calcReceivers(m_receiverTime,
+                                                        ct.correctionTime,
+                                                        timeStepSize(),
+                                                        kernels::ReceiverSelection::WithStoredDerivatives);
+    }
   }
 
 }
@@ -190,10 +232,7 @@ void seissol::time_stepping::TimeCluster::computeSources() {
   // Return when point sources not initialised. This might happen if there
   // are no point sources on this rank.
   if (m_numberOfCellToPointSourcesMappings != 0) {
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-    for (unsigned mapping = 0; mapping < m_numberOfCellToPointSourcesMappings; ++mapping) {
+    parallel::forEach(m_numberOfCellToPointSourcesMappings, [&](unsigned mapping) {
       unsigned startSource = m_cellToPointSources[mapping].pointSourcesOffset;
       unsigned endSource =
           m_cellToPointSources[mapping].pointSourcesOffset + m_cellToPointSources[mapping].numberOfPointSources;
@@ -218,7 +257,7 @@ void seissol::time_stepping::TimeCluster::computeSources() {
                                                        *m_cellToPointSources[mapping].dofs);
         }
       }
-    }
+    });
   }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
@@ -230,7 +269,8 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   SCOREP_USER_REGION_DEFINE(myRegionHandle)
   SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureSpaceTimeInterpolation", SCOREP_USER_REGION_TYPE_COMMON )
 
-  m_loopStatistics->begin(m_regionComputeDynamicRupture);
+  timespec beginTime;
+  clock_gettime(CLOCK_MONOTONIC, &beginTime);
 
   DRFaceInformation* faceInformation = layerData.var(m_dynRup->faceInformation);
   DRGodunovData* godunovData = layerData.var(m_dynRup->godunovData);
@@ -247,10 +287,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   {
   LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
   }
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+  parallel::forEach(layerData.getNumberOfCells(), [&](unsigned face) {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
@@ -262,7 +299,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                   qInterpolatedMinus[face],
                                                   timeDerivativePlus[prefetchFace],
                                                   timeDerivativeMinus[prefetchFace]);
-  }
+  });
   SCOREP_USER_REGION_END(myRegionHandle)
 #pragma omp parallel 
   {
@@ -281,7 +318,10 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
   }
 
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_globalClusterId);
+  timespec endTime;
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  m_loopStatistics->addSample(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_globalClusterId, beginTime, endTime);
+  m_loopStatistics->addSkippedIterations(m_regionComputeDynamicRupture, frictionSolver->getNumberOfLockedFaces());
 }
 #else
 
@@ -335,13 +375,8 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
 void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
-
-  // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
-
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
+  timespec beginTime;
+  clock_gettime(CLOCK_MONOTONIC, &beginTime);
 
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
@@ -349,12 +384,16 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
 
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
-  kernels::LocalTmp tmp{};
 
-#ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer, tmp) schedule(static)
-#endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
+  parallel::forEach(i_layerData.getNumberOfCells(), [&](unsigned l_cell) {
+    // local integration buffer
+    alignas(ALIGNMENT) real l_integrationBuffer[tensor::I::size()];
+
+    // pointer for the call of the ADER-function
+    real* l_bufferPointer;
+
+    kernels::LocalTmp tmp{};
+
     auto data = loader.entry(l_cell);
 
     // We need to check, whether we can overwrite the buffer or if it is
@@ -364,7 +403,9 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
     const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
     const bool resetMyBuffers = buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
 
-    if (resetMyBuffers) {
+    // Buffers in reduced precision are always computed in the local buffer and
+    // converted on store.
+    if (resetMyBuffers && !reducedPrecisionBuffers) {
       // assert presence of the buffer
       assert(buffers[l_cell] != nullptr);
 
@@ -411,16 +452,27 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
     // TODO: Integrate this step into the kernel
     // We've used a temporary buffer -> need to accumulate update in
     // shared buffer.
-    if (!resetMyBuffers && buffersProvided) {
+    if (reducedPrecisionBuffers && buffersProvided) {
+      assert(buffers[l_cell] != nullptr);
+
+      auto* reducedBuffer = kernels::mixed_precision::reducedBuffer(buffers[l_cell]);
+      if (resetMyBuffers) {
+        kernels::mixed_precision::compress(l_integrationBuffer, reducedBuffer, tensor::I::size());
+      } else {
+        kernels::mixed_precision::accumulate(l_integrationBuffer, reducedBuffer, tensor::I::size());
+      }
+    } else if (!resetMyBuffers && buffersProvided) {
       assert(buffers[l_cell] != nullptr);
 
       for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
         buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
       }
     }
-  }
+  });
 
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
+  timespec endTime;
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  m_loopStatistics->addSample(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_globalClusterId, beginTime, endTime);
 }
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
@@ -486,12 +538,30 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializers::Layer& i_layerData,
                                                                         double subTimeStart) {
+  // Accumulate the energies in the last time step before a requested energy output time
+  const bool accumulateEnergy = energyAccumulator != nullptr && energyAccumulator->isActive()
+      && ct.stepsSinceLastSync + ct.timeStepRate >= ct.stepsUntilSync;
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
+    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart, accumulateEnergy);
   } else {
-    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
+    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart, accumulateEnergy);
   }
 }
+
+void seissol::time_stepping::TimeCluster::computeBatchedNeighboringFluxes(seissol::initializers::Layer& i_layerData,
+                                                                          double subTimeStart) {
+#ifdef USE_ELASTIC
+  ConditionalBatchTableT &table = i_layerData.getCondBatchTable();
+
+  seissol::kernels::TimeCommon::computeBatchedIntegrals(m_timeKernel,
+                                                        subTimeStart,
+                                                        timeStepSize(),
+                                                        table);
+  m_neighborKernel.computeBatchedNeighborsIntegral(table);
+#else
+  logError() << "The batched neighbor integration is only implemented for elastic materials.";
+#endif
+}
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData,
                                                                          double subTimeStart) {
@@ -638,12 +708,13 @@ void TimeCluster::predict() {
 
   // These methods compute the receivers/sources for both interior and copy cluster
   // and are called in actors for both copy AND interior.
-  writeReceivers();
+  writeReceivers(false);
   computeLocalIntegration(*m_clusterData, resetBuffers);
+  writeReceivers(true);
   computeSources();
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[static_cast<int>(ComputePart::Local)];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[static_cast<int>(ComputePart::Local)];
+  addFlops(g_SeisSolNonZeroFlopsLocal, m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
+  addFlops(g_SeisSolHardwareFlopsLocal, m_flops_hardware[static_cast<int>(ComputePart::Local)]);
 }
 void TimeCluster::correct() {
   assert(state == ActorState::Predicted);
@@ -671,34 +742,37 @@ void TimeCluster::correct() {
   // Otherwise, this is an interior layer actor, and we need only the FL_Int.
   // We need to avoid computing it twice.
   if (dynamicRuptureScheduler->hasDynamicRuptureFaces()) {
+    std::lock_guard<std::mutex> lock(dynamicRuptureMutex);
     if (dynamicRuptureScheduler->mayComputeInterior(ct.stepsSinceStart)) {
       computeDynamicRupture(*dynRupInteriorData);
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)];
+      addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
+      addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
       dynamicRuptureScheduler->setLastCorrectionStepsInterior(ct.stepsSinceStart);
     }
     if (layerType == Copy) {
       computeDynamicRupture(*dynRupCopyData);
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)];
+      addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+      addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
       dynamicRuptureScheduler->setLastCorrectionStepsCopy((ct.stepsSinceStart));
     }
 
   }
   computeNeighboringIntegration(*m_clusterData, subTimeStart);
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[static_cast<int>(ComputePart::Neighbor)];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)];
+  addFlops(g_SeisSolNonZeroFlopsNeighbor, m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)]);
+  addFlops(g_SeisSolHardwareFlopsNeighbor, m_flops_hardware[static_cast<int>(ComputePart::Neighbor)]);
+  addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)]);
+  addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)]);
 
   // First cluster calls fault receiver output
   // Call fault output only if both interior and copy parts of DR were computed
   // TODO: Change from iteration based to time based
-  if (m_clusterId == 0
-      && dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
-    faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
-    dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+  if (m_clusterId == 0) {
+    std::lock_guard<std::mutex> lock(dynamicRuptureMutex);
+    if (dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
+      faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
+      dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+    }
   }
 
   // TODO(Lukas) Adjust with time step rate? Relevant is maximum cluster is not on this node
@@ -748,6 +822,18 @@ unsigned int TimeCluster::getClusterId() const {
   return m_clusterId;
 }
 
+double TimeCluster::getPlasticYieldSurcharge() const {
+  const auto numberOfCells = m_clusterData->getNumberOfCells();
+  if (!usePlasticity || numberOfCells == 0) {
+    return 0.0;
+  }
+  const double flopsPerCell =
+      static_cast<double>(m_flops_nonZero[static_cast<int>(ComputePart::Local)] +
+                          m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)]) / numberOfCells +
+      m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)];
+  return m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)] / flopsPerCell;
+}
+
 unsigned int TimeCluster::getGlobalClusterId() const {
   return m_globalClusterId;
 }
@@ -76,6 +76,10 @@
 #include <list>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
 #include <utils/logger.h>
@@ -91,6 +95,8 @@
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <Monitoring/LoopStatistics.h>
 #include <Monitoring/ActorStateStatistics.h>
+#include <Parallel/TaskScheduling.h>
+#include <ResultWriter/VolumeEnergy.h>
 
 #include "AbstractTimeCluster.h"
 
@@ -202,10 +208,32 @@ private:
 
     kernels::ReceiverCluster* m_receiverCluster;
 
+    //! accumulates the volume energies at energy output times (nullptr if not used)
+    writer::VolumeEnergyAccumulator* energyAccumulator = nullptr;
+
+    //! number of time steps with plastic yielding per cell (only used with plasticity)
+    std::vector<unsigned> numberOfYields;
+
+    //! executes the time integration of the neighbors and the neighboring fluxes with the batch tables (CPU only)
+    bool batchedNeighborIntegration = false;
+
+    //! the time-integrated buffers are stored in reduced precision (CPU only)
+    bool reducedPrecisionBuffers = false;
+
+#ifndef ACL_DEVICE
+    /**
+     * Computes the time integrals of the neighbors and the neighboring fluxes of a layer
+     * with the recorded batch tables instead of the per-cell loop.
+     */
+    void computeBatchedNeighboringFluxes(seissol::initializers::Layer& i_layerData, double subTimeStart);
+#endif
+
     /**
      * Writes the receiver output if applicable (receivers present, receivers have to be written).
+     * Receivers in cells which store their time derivatives are evaluated with
+     * afterLocalIntegration = true, reusing the derivatives of the local integration.
      **/
-    void writeReceivers();
+    void writeReceivers(bool afterLocalIntegration);
 
     /**
      * Computes the source terms if applicable.
@@ -255,81 +283,97 @@ private:
 #ifndef ACL_DEVICE
     template<bool usePlasticity>
     std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData,
-                                                                      double subTimeStart) {
+                                                                      double subTimeStart,
+                                                                      bool accumulateEnergy) {
       SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+      timespec beginTime;
+      clock_gettime(CLOCK_MONOTONIC, &beginTime);
 
       real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
       CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
       CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
       PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
       real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
+      CellMaterialData* material = i_layerData.var(m_lts->material);
+      std::atomic<unsigned> numberOTetsWithPlasticYielding{0};
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
-      real *l_timeIntegrated[4];
-      real *l_faceNeighbors_prefetch[4];
+      if (batchedNeighborIntegration) {
+        computeBatchedNeighboringFluxes(i_layerData, subTimeStart);
+      }
+
+      parallel::forEach(i_layerData.getNumberOfCells(), [&](unsigned l_cell) {
+        real *l_timeIntegrated[4];
+        real *l_faceNeighbors_prefetch[4];
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
         auto data = loader.entry(l_cell);
-        seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
-                                                       data.cellInformation.ltsSetup,
-                                                       data.cellInformation.faceTypes,
-                                                       subTimeStart,
-                                                       timeStepSize(),
-                                                       faceNeighbors[l_cell],
+        if (!batchedNeighborIntegration) {
+          seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
+                                                         data.cellInformation.ltsSetup,
+                                                         data.cellInformation.faceTypes,
+                                                         subTimeStart,
+                                                         timeStepSize(),
+                                                         faceNeighbors[l_cell],
 #ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+                                                         *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
 #else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
+              *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost->integrationBufferLTS),
 #endif
-                                                       l_timeIntegrated);
+                                                         l_timeIntegrated,
+                                                         reducedPrecisionBuffers);
 
 #ifdef ENABLE_MATRIX_PREFETCH
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
-
-        // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
-          l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
-                                        faceNeighbors[l_cell+1][0] :
-                                        drMapping[l_cell+1][0].godunov;
-        } else {
-          l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
-        }
+          l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][1] :
+                                        drMapping[l_cell][1].godunov;
+          l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][2] :
+                                        drMapping[l_cell][2].godunov;
+          l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][3] :
+                                        drMapping[l_cell][3].godunov;
+
+          // fourth face's prefetches
+          if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
+            l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
+                                          faceNeighbors[l_cell+1][0] :
+                                          drMapping[l_cell+1][0].godunov;
+          } else {
+            l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
+          }
 #endif
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
+          m_neighborKernel.computeNeighborsIntegral( data,
+                                                     drMapping[l_cell],
 #ifdef ENABLE_MATRIX_PREFETCH
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
+                                                     l_timeIntegrated, l_faceNeighbors_prefetch
 #else
-            l_timeIntegrated
+              l_timeIntegrated
 #endif
-        );
+          );
+        }
 
         if constexpr (usePlasticity) {
           updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
+          const unsigned isYielding = seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
                                                                                              timeStepSize(),
                                                                                              m_tv,
                                                                                              m_globalDataOnHost,
                                                                                              &plasticity[l_cell],
                                                                                              data.dofs,
                                                                                              pstrain[l_cell] );
+          if (isYielding != 0) {
+            numberOTetsWithPlasticYielding.fetch_add(isYielding, std::memory_order_relaxed);
+            ++numberOfYields[l_cell];
+          }
+        }
+
+        // energy output: the updated DOFs are still in the cache
+        if (accumulateEnergy) {
+          energyAccumulator->addCell(data.dofs, usePlasticity ? static_cast<const real*>(pstrain[l_cell]) : nullptr, material[l_cell]);
         }
 #ifdef INTEGRATE_QUANTITIES
         seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
@@ -337,16 +381,23 @@ private:
                                                               l_cell,
                                                               dofs[l_cell] );
 #endif // INTEGRATE_QUANTITIES
+      });
+
+      if (accumulateEnergy) {
+        energyAccumulator->finishLayer(i_layerData.getNumberOfCells());
       }
 
+      const unsigned numberOfYieldingTets = numberOTetsWithPlasticYielding.load();
       const long long nonZeroFlopsPlasticity =
           i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
+          numberOfYieldingTets * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
       const long long hardwareFlopsPlasticity =
           i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
+          numberOfYieldingTets * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
+      timespec endTime;
+      clock_gettime(CLOCK_MONOTONIC, &endTime);
+      m_loopStatistics->addSample(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_globalClusterId, beginTime, endTime);
 
       return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
     }
@@ -432,6 +483,10 @@ public:
     faultOutputManager = outputManager;
   }
 
+  void setEnergyAccumulator(writer::VolumeEnergyAccumulator* accumulator) {
+    energyAccumulator = accumulator;
+  }
+
   /**
    * Set Tv constant for plasticity.
    */
@@ -443,6 +498,27 @@ public:
 
   void reset() override;
 
+  [[nodiscard]] seissol::initializers::Layer& getClusterData() {
+    return *m_clusterData;
+  }
+
+  /**
+   * Number of time steps with plastic yielding per cell, empty without plasticity.
+   */
+  [[nodiscard]] const std::vector<unsigned>& getNumberOfYields() const {
+    return numberOfYields;
+  }
+
+  void resetNumberOfYields() {
+    std::fill(numberOfYields.begin(), numberOfYields.end(), 0);
+  }
+
+  /**
+   * Additional cost of a cell update with plastic yielding relative to a cell update without
+   * yielding, estimated from the flops of the kernels.
+   */
+  [[nodiscard]] double getPlasticYieldSurcharge() const;
+
   [[nodiscard]] unsigned int getClusterId() const;
   [[nodiscard]] unsigned int getGlobalClusterId() const;
   [[nodiscard]] LayerType getLayerType() const;
@@ -46,11 +46,17 @@
 #include <Initializer/preProcessorMacros.fpp>
 #include <Initializer/time_stepping/common.hpp>
 #include "SeisSol.h"
+#include "Initializer/InputAux.hpp"
+#include "Parallel/TaskScheduling.h"
+#include "utils/env.h"
+
+#include <atomic>
 
 extern seissol::Interoperability e_interoperability;
 
 seissol::time_stepping::TimeManager::TimeManager():
-  m_logUpdates(std::numeric_limits<unsigned int>::max())
+  m_logUpdates(std::numeric_limits<unsigned int>::max()),
+  nonBlockingSync(utils::Env::get<int>("SEISSOL_NONBLOCKING_SYNC", 0) != 0)
 {
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
@@ -162,7 +168,8 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
           assert(otherGlobalClusterId >= std::max(globalClusterId - 1, 0));
           assert(otherGlobalClusterId < std::min(globalClusterId +2, static_cast<int>(m_timeStepping.numberOfGlobalClusters)));
         const auto otherTimeStepSize = m_timeStepping.globalCflTimeStepWidths[otherGlobalClusterId];
-        const auto otherTimeStepRate = ipow(2l, static_cast<long>(otherGlobalClusterId));
+        const auto otherTimeStepRate = ipow(static_cast<long>(m_timeStepping.globalTimeStepRates[0]),
+                                            static_cast<long>(otherGlobalClusterId));
 
         ghostClusters.push_back(
           std::make_unique<GhostTimeCluster>(
@@ -185,6 +192,18 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
   };
   std::sort(clusters.begin(), clusters.end(), rateSorter);
 
+#ifndef ACL_DEVICE
+  // The energy output initializes the accumulator if it is enabled
+  for (auto& cluster : clusters) {
+    cluster->setEnergyAccumulator(&energyAccumulator);
+  }
+#endif
+
+  const auto& meshParams = (*seissol::SeisSol::main.getInputParams())["meshnml"];
+  cellCostExporter.init(m_loopStatistics,
+                        initializers::getWithDefault(meshParams, "measuredcostsfile", std::string("")),
+                        initializers::getWithDefault(meshParams, "loadimbalancethreshold", 0.1));
+
   for (const auto& cluster : clusters) {
     if (cluster->getPriority() == ActorPriority::High) {
       highPrioClusters.emplace_back(cluster.get());
@@ -226,7 +245,8 @@ seissol::dr::output::OutputManager* seissol::time_stepping::TimeManager::getFaul
   return m_faultOutputManager;
 }
 
-void seissol::time_stepping::TimeManager::advanceInTime(const double &synchronizationTime) {
+void seissol::time_stepping::TimeManager::advanceInTime(const double &synchronizationTime,
+                                                        bool requiresGlobalSync) {
   SCOREP_USER_REGION( "advanceInTime", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   // We should always move forward in time
@@ -240,8 +260,13 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
   }
 
   communicationManager->reset(synchronizationTime);
+  energyAccumulator.beginInterval(synchronizationTime, getTimeTolerance());
 
-  seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+  // Ranks are coupled by the ghost layer messages only. A global barrier is
+  // required for checkpoints and the end of the simulation.
+  if (requiresGlobalSync || !nonBlockingSync) {
+    seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+  }
 #ifdef ACL_DEVICE
   device::DeviceInstance &device = device::DeviceInstance::getInstance();
   device.api->putProfilingMark("advanceInTime", device::ProfilingColors::Blue);
@@ -255,6 +280,17 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  if (parallel::useTaskBasedScheduling()) {
+    advanceClustersTaskBased();
+  } else {
+    advanceClusters();
+  }
+#ifdef ACL_DEVICE
+  device.api->popLastProfilingMark();
+#endif
+}
+
+void seissol::time_stepping::TimeManager::advanceClusters() {
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
@@ -299,11 +335,77 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     });
     finished &= communicationManager->checkIfFinished();
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersTaskBased() {
+#ifdef _OPENMP
+  // Copy layers first, such that MPI messages can be sent as early as possible.
+  std::vector<TimeCluster*> schedulingOrder(highPrioClusters);
+  schedulingOrder.insert(schedulingOrder.end(), lowPrioClusters.begin(), lowPrioClusters.end());
+
+  // A cluster is busy while its action runs in a task; it is not scheduled again until the task is done.
+  std::vector<std::atomic<bool>> isBusy(schedulingOrder.size());
+  for (auto& busy : isBusy) {
+    busy.store(false);
+  }
+
+  // The master thread polls the actors and spawns their actions as tasks.
+  // All other threads execute the tasks, i.e. predict/correct of different clusters
+  // may run concurrently. The actions split their cells into chunks (see parallel::forEach).
+  // Note: master instead of single, as the communication manager may call MPI.
+#pragma omp parallel
+  {
+#pragma omp master
+    {
+      bool finished = false;
+      while (!finished) {
+        communicationManager->progression();
+
+        bool spawnedTask = false;
+        for (std::size_t i = 0; i < schedulingOrder.size(); ++i) {
+          if (isBusy[i].load(std::memory_order_acquire)) {
+            continue;
+          }
+          auto* cluster = schedulingOrder[i];
+          // The state machine (mayPredict/mayCorrect) decides what may be executed
+          const auto nextAction = cluster->getNextLegalAction();
+          if (nextAction == ActorAction::Nothing) {
+            continue;
+          }
+          if (nextAction == ActorAction::Sync) {
+            // Does not involve any computations
+            cluster->act();
+            continue;
+          }
+          isBusy[i].store(true, std::memory_order_relaxed);
+          spawnedTask = true;
+#pragma omp task default(shared) firstprivate(cluster, i)
+          {
+            cluster->act();
+            isBusy[i].store(false, std::memory_order_release);
+          }
+        }
+
+        if (!spawnedTask) {
+#pragma omp taskyield
+        }
+
+        // Note: The cluster states may only be read if no task is running.
+        finished = std::none_of(isBusy.begin(), isBusy.end(), [](const auto& busy) {
+          return busy.load(std::memory_order_acquire);
+        }) && std::all_of(clusters.begin(), clusters.end(), [](auto& c) {
+          return c->synced();
+        }) && communicationManager->checkIfFinished();
+      }
+    }
+  }
 #endif
 }
 
+void seissol::time_stepping::TimeManager::exportCellCosts() {
+  cellCostExporter.check(clusters);
+}
+
 void seissol::time_stepping::TimeManager::printComputationTime()
 {
   actorStateStatisticsManager.addToLoopStatistics(m_loopStatistics);
@@ -311,6 +413,7 @@ void seissol::time_stepping::TimeManager::printComputationTime()
   m_loopStatistics.printSummary(MPI::mpi.comm());
 #endif
   m_loopStatistics.writeSamples();
+  communicationManager->printStatistics();
 }
 
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
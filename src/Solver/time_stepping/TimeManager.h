@@ -55,6 +55,8 @@
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <ResultWriter/ReceiverWriter.h>
 #include "TimeCluster.h"
+#include "ResultWriter/VolumeEnergy.h"
+#include "CellCostExporter.h"
 #include "Monitoring/Stopwatch.h"
 #include "GhostTimeCluster.h"
 
@@ -119,6 +121,26 @@ class seissol::time_stepping::TimeManager {
     //! c++ impl. of dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! skip the global barrier at synchronization points which are only used for output
+    const bool nonBlockingSync;
+
+    //! volume energies at the energy output times
+    writer::VolumeEnergyAccumulator energyAccumulator;
+
+    //! exports the measured costs of the cells for a later run if the ranks are imbalanced
+    CellCostExporter cellCostExporter;
+
+    /**
+     * Executes the actions of the clusters one at a time until all clusters are synced.
+     **/
+    void advanceClusters();
+
+    /**
+     * Executes the actions of all clusters as concurrent OpenMP tasks until all clusters are synced.
+     * Used instead of the one-cluster-at-a-time loop if SEISSOL_TASK_BASED_SCHEDULING is set.
+     **/
+    void advanceClustersTaskBased();
+
   public:
     /**
      * Construct a new time manager.
@@ -148,8 +170,27 @@ class seissol::time_stepping::TimeManager {
 
     /**
      * Advance in time until all clusters reach the next synchronization time.
+     *
+     * @param synchronizationTime next synchronization time.
+     * @param requiresGlobalSync true, if all ranks have to be synchronized with a barrier (e.g. for checkpoints).
+     *        Only relevant if SEISSOL_NONBLOCKING_SYNC is set; otherwise, there is always a barrier.
      **/
-    void advanceInTime( const double &synchronizationTime );
+    void advanceInTime( const double &synchronizationTime, bool requiresGlobalSync = true );
+
+    /**
+     * True, if output-only synchronization points skip the global barrier (SEISSOL_NONBLOCKING_SYNC).
+     * The wave field output is then evaluated from a staged copy while the time stepping continues.
+     **/
+    bool useNonBlockingSync() const {
+      return nonBlockingSync;
+    }
+
+    /**
+     * Accumulator of the volume energies, which is used by the energy output.
+     **/
+    writer::VolumeEnergyAccumulator& getEnergyAccumulator() {
+      return energyAccumulator;
+    }
 
     /**
      * Gets the time tolerance of the time manager (1E-5 of the CFL time step width).
@@ -184,6 +225,12 @@ class seissol::time_stepping::TimeManager {
      **/
     void setInitialTimes( double i_time = 0 );
 
+    /**
+     * Checks the load imbalance since the last call and exports the measured costs of the cells
+     * for the partitioning of a later run if the imbalance exceeds the threshold. Collective.
+     **/
+    void exportCellCosts();
+
     void printComputationTime();
 };
 
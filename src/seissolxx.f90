@@ -200,6 +200,11 @@ domain%IO%UNIT%maxThisDom              = 69999                        ! Obere Gr
        programTitle   = domain%programTitle        )
 domain%IO%MPIPickCleaningDone = 0
 
+  ! Memory dry run: stop after the initialization, SeisSol is finalized by the C++ main
+  IF (domain%IO%MemoryDryRun) THEN
+     RETURN
+  ENDIF
+
     logInfo0(*) '<--------------------------------------------------------->'  !
     logInfo0(*) '<     Start inioutput_SeisSol ...                         >'  !
     logInfo0(*) '<--------------------------------------------------------->'  !
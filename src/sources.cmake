@@ -6,9 +6,12 @@ src/Initializer/PointMapper.cpp
 src/Initializer/GlobalData.cpp
 src/Initializer/InternalState.cpp
 src/Initializer/MemoryAllocator.cpp
+src/Initializer/MemoryFootprint.cpp
 src/Initializer/CellLocalMatrices.cpp
 
 src/Initializer/time_stepping/LtsLayout.cpp
+src/Initializer/time_stepping/CellOrdering.cpp
+src/Initializer/time_stepping/LtsWeights/CostModel.cpp
 src/Initializer/tree/Lut.cpp
 src/Initializer/MemoryManager.cpp
 src/Initializer/InitialFieldProjection.cpp
@@ -18,6 +21,7 @@ src/Model/common.cpp
 src/Numerical_aux/Functions.cpp
 src/Numerical_aux/Transformation.cpp
 src/Numerical_aux/Statistics.cpp
+src/Numerical_aux/IIRFilter.cpp
 
 src/Solver/Simulator.cpp
 src/Solver/FreeSurfaceIntegrator.cpp
@@ -29,6 +33,7 @@ src/Solver/time_stepping/MiniSeisSol.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/GhostTimeCluster.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
+src/Solver/time_stepping/CellCostExporter.cpp
 
 src/Solver/time_stepping/TimeManager.cpp
 src/Solver/Pipeline/DrTuner.cpp
@@ -36,6 +41,7 @@ src/Kernels/DynamicRupture.cpp
 src/Kernels/Plasticity.cpp
 src/Kernels/TimeCommon.cpp
 src/Kernels/Receiver.cpp
+src/Kernels/MixedPrecision.cpp
 src/SeisSol.cpp
 src/SourceTerm/Manager.cpp
 
@@ -47,6 +53,7 @@ src/Geometry/GambitReader.cpp
 
 src/Geometry/MeshReaderFBinding.cpp
 src/Geometry/MeshTools.cpp
+src/Geometry/PointLocator.cpp
 src/Monitoring/FlopCounter.cpp
 src/Monitoring/LoopStatistics.cpp
 src/Reader/readparC.cpp
@@ -61,15 +68,23 @@ src/Checkpoint/Backend.cpp
 src/Checkpoint/Fault.cpp
 src/Checkpoint/posix/Wavefield.cpp
 src/Checkpoint/posix/Fault.cpp
+src/Checkpoint/compressed/BlockCodec.cpp
+src/Checkpoint/compressed/CheckPoint.cpp
+src/Checkpoint/compressed/Wavefield.cpp
+src/Checkpoint/compressed/Fault.cpp
 src/ResultWriter/AnalysisWriter.cpp
 src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverWriterExecutor.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
+src/ResultWriter/FaultReceiverWriterExecutor.cpp
+src/ResultWriter/FaultReceiverWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 src/ResultWriter/EnergyOutput.cpp
+src/ResultWriter/VolumeEnergy.cpp
 
 # Fortran:
 src/Geometry/allocate_mesh.f90
@@ -229,12 +244,14 @@ endif()
 target_include_directories(SeisSol-common-properties INTERFACE
         ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders)
 
+# Used by the GPU code and the batched neighbor integration on CPUs
+target_sources(SeisSol-lib PUBLIC
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/NeighIntegrationRecorder.cpp)
 
 # GPU code
 if (WITH_GPU)
   target_sources(SeisSol-lib PUBLIC
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/LocalIntegrationRecorder.cpp
-          ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/NeighIntegrationRecorder.cpp
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/PlasticityRecorder.cpp
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/DynamicRuptureRecorder.cpp)
 
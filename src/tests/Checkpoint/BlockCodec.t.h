@@ -0,0 +1,95 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Checkpoint/compressed/BlockCodec.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Byte shuffle") {
+  std::vector<double> values(101);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = std::sin(0.1 * i);
+  }
+  // Include a trailing partial element
+  const std::size_t size = values.size() * sizeof(double) - 3;
+
+  std::vector<std::uint8_t> shuffled(size);
+  std::vector<double> unshuffled(values.size(), 0.0);
+  checkpoint::compressed::shuffle(values.data(), shuffled.data(), size, sizeof(double));
+  checkpoint::compressed::unshuffle(shuffled.data(), unshuffled.data(), size, sizeof(double));
+  REQUIRE(std::memcmp(values.data(), unshuffled.data(), size) == 0);
+}
+
+TEST_CASE("Run-length encoding") {
+  std::vector<std::uint8_t> data;
+  data.insert(data.end(), 1000, 0);
+  for (int i = 0; i < 300; ++i) {
+    data.push_back(static_cast<std::uint8_t>(i * 7));
+  }
+  data.insert(data.end(), {5, 5, 6, 6, 6, 7});
+
+  std::vector<std::uint8_t> encoded;
+  checkpoint::compressed::rleEncode(data.data(), data.size(), encoded);
+  REQUIRE(encoded.size() < data.size());
+
+  std::vector<std::uint8_t> decoded(data.size());
+  REQUIRE(checkpoint::compressed::rleDecode(
+      encoded.data(), encoded.size(), decoded.data(), decoded.size()));
+  REQUIRE(decoded == data);
+
+  // Wrong sizes and truncated data are detected
+  REQUIRE(!checkpoint::compressed::rleDecode(
+      encoded.data(), encoded.size(), decoded.data(), decoded.size() - 1));
+  REQUIRE(!checkpoint::compressed::rleDecode(
+      encoded.data(), encoded.size() - 1, decoded.data(), decoded.size()));
+}
+
+TEST_CASE("Block compression") {
+  using checkpoint::compressed::BlockEncoding;
+
+  // Mostly quiescent wave field
+  std::vector<double> values(4096, 0.0);
+  for (std::size_t i = 0; i < 256; ++i) {
+    values[i] = std::exp(-0.01 * i) * std::cos(0.3 * i);
+  }
+  const std::size_t size = values.size() * sizeof(double);
+
+  std::vector<std::uint8_t> compressed;
+  const auto encoding =
+      checkpoint::compressed::compressBlock(values.data(), size, sizeof(double), compressed);
+  REQUIRE(encoding == BlockEncoding::ShuffleRle);
+  REQUIRE(compressed.size() < size / 4);
+
+  std::vector<double> decompressed(values.size());
+  REQUIRE(checkpoint::compressed::decompressBlock(
+      encoding, compressed.data(), compressed.size(), sizeof(double), decompressed.data(), size));
+  REQUIRE(decompressed == values);
+
+  // Random data is stored raw
+  std::vector<std::uint8_t> noise(1000);
+  std::uint32_t state = 12345;
+  for (auto& byte : noise) {
+    state = state * 1664525u + 1013904223u;
+    byte = static_cast<std::uint8_t>(state >> 24);
+  }
+  REQUIRE(checkpoint::compressed::compressBlock(noise.data(), noise.size(), 1, compressed) ==
+          BlockEncoding::Raw);
+  REQUIRE(compressed == noise);
+}
+
+TEST_CASE("Block hash") {
+  std::vector<double> values(1000, 1.0);
+  const auto hash = checkpoint::compressed::hashBlock(values.data(), values.size() * sizeof(double));
+  REQUIRE(hash == checkpoint::compressed::hashBlock(values.data(), values.size() * sizeof(double)));
+
+  // Any bit flip changes the hash
+  values[517] = std::nextafter(1.0, 2.0);
+  REQUIRE(hash != checkpoint::compressed::hashBlock(values.data(), values.size() * sizeof(double)));
+  values[517] = 1.0;
+  REQUIRE(hash !=
+          checkpoint::compressed::hashBlock(values.data(), values.size() * sizeof(double) - 1));
+}
+
+} // namespace seissol::unit_test
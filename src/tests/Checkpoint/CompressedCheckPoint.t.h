@@ -0,0 +1,129 @@
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Checkpoint/compressed/CheckPoint.h"
+#include "Kernels/precision.hpp"
+#include "Parallel/MPI.h"
+
+namespace seissol::unit_test {
+
+/**
+ * Exposes the segment interface of the compressed checkpoints
+ */
+class CompressedCheckPoint : public checkpoint::compressed::CheckPoint {
+  public:
+  CompressedCheckPoint()
+      : seissol::checkpoint::CheckPoint(Identifier),
+        checkpoint::compressed::CheckPoint(Identifier) {
+#ifdef USE_MPI
+    setComm(seissol::MPI::mpi.comm());
+#endif
+  }
+
+  using checkpoint::compressed::CheckPoint::createFiles;
+  using checkpoint::compressed::CheckPoint::exists;
+  using checkpoint::compressed::CheckPoint::loadSegments;
+  using checkpoint::compressed::CheckPoint::writeSegments;
+
+  static constexpr unsigned long Identifier = 0x7E57;
+};
+
+TEST_CASE("Incremental compressed checkpoints") {
+  // Chains of two checkpoints, 64 values per block
+  setenv("SEISSOL_CHECKPOINT_FULL_INTERVAL", "2", 1);
+  setenv("SEISSOL_CHECKPOINT_COMPRESSED_BLOCK_SIZE", std::to_string(64 * sizeof(real)).c_str(), 1);
+
+  // All ranks share the directory
+  const auto barrier = [] { seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm()); };
+  const auto directory = std::filesystem::path("Testing") / "compressed-checkpoint";
+  if (seissol::MPI::mpi.rank() == 0) {
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+  }
+  barrier();
+  const auto fileName = (directory / "cp").string();
+  const auto generationFile = [&](int generation) {
+    return directory / ("cp." + std::to_string(generation)) /
+           ("cp." + std::to_string(seissol::MPI::mpi.rank()));
+  };
+
+  std::vector<real> dofs(1000);
+  for (std::size_t i = 0; i < dofs.size(); ++i) {
+    dofs[i] = static_cast<real>(i % 17) - 8;
+  }
+  double time = 1.0;
+
+  {
+    CompressedCheckPoint checkPoint;
+    checkPoint.setFilename(fileName.c_str());
+    REQUIRE(!checkPoint.exists());
+    checkPoint.createFiles();
+
+    // Full checkpoint
+    checkPoint.writeSegments(&time, sizeof(time), {{dofs.data(), dofs.size() * sizeof(real)}});
+    checkPoint.updateLink();
+
+    // Incremental checkpoint, only one block changed
+    time = 2.0;
+    dofs[100] = 42;
+    checkPoint.writeSegments(&time, sizeof(time), {{dofs.data(), dofs.size() * sizeof(real)}});
+    checkPoint.updateLink();
+    checkPoint.close();
+  }
+  barrier();
+  REQUIRE(std::filesystem::is_symlink(directory / "cp"));
+  REQUIRE(std::filesystem::read_symlink(directory / "cp") == "cp.1");
+  REQUIRE(std::filesystem::file_size(generationFile(1)) <
+          std::filesystem::file_size(generationFile(0)));
+
+  {
+    // Restore from the chain: the changed block is in generation 1, all others in generation 0
+    CompressedCheckPoint checkPoint;
+    checkPoint.setFilename(fileName.c_str());
+    REQUIRE(checkPoint.exists());
+
+    double loadedTime = 0.0;
+    std::vector<real> loadedDofs(dofs.size());
+    checkPoint.loadSegments(
+        &loadedTime, sizeof(loadedTime), {{loadedDofs.data(), loadedDofs.size() * sizeof(real)}});
+    REQUIRE(loadedTime == 2.0);
+    REQUIRE(loadedDofs == dofs);
+
+    // Continuing the loaded chain starts a new one, which removes the previous chain
+    checkPoint.createFiles();
+    time = 3.0;
+    dofs[500] = -42;
+    checkPoint.writeSegments(&time, sizeof(time), {{dofs.data(), dofs.size() * sizeof(real)}});
+    REQUIRE(std::filesystem::exists(generationFile(0)));
+    checkPoint.updateLink();
+    checkPoint.close();
+  }
+  barrier();
+  REQUIRE(std::filesystem::read_symlink(directory / "cp") == "cp.2");
+  REQUIRE(!std::filesystem::exists(directory / "cp.0"));
+  REQUIRE(!std::filesystem::exists(directory / "cp.1"));
+
+  {
+    CompressedCheckPoint checkPoint;
+    checkPoint.setFilename(fileName.c_str());
+    REQUIRE(checkPoint.exists());
+
+    double loadedTime = 0.0;
+    std::vector<real> loadedDofs(dofs.size());
+    checkPoint.loadSegments(
+        &loadedTime, sizeof(loadedTime), {{loadedDofs.data(), loadedDofs.size() * sizeof(real)}});
+    REQUIRE(loadedTime == 3.0);
+    REQUIRE(loadedDofs == dofs);
+  }
+
+  unsetenv("SEISSOL_CHECKPOINT_FULL_INTERVAL");
+  unsetenv("SEISSOL_CHECKPOINT_COMPRESSED_BLOCK_SIZE");
+  barrier();
+  if (seissol::MPI::mpi.rank() == 0) {
+    std::filesystem::remove_all(directory);
+  }
+}
+
+} // namespace seissol::unit_test
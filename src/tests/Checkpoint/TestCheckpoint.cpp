@@ -0,0 +1,5 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "BlockCodec.t.h"
+#include "CompressedCheckPoint.t.h"
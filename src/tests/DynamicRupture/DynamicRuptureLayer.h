@@ -0,0 +1,55 @@
+#ifndef SEISSOL_DYNAMICRUPTURELAYER_H
+#define SEISSOL_DYNAMICRUPTURELAYER_H
+
+#include "DynamicRupture/FrictionLaws/BaseFrictionLaw.h"
+#include "Initializer/DynamicRupture.h"
+#include "Initializer/tree/LTSTree.hpp"
+
+namespace seissol::unit_test::dr {
+
+/**
+ * Dynamic rupture tree with a single layer of faces. The friction laws read their data from the
+ * layer in the same way as in evaluate.
+ */
+template <typename LtsT>
+class DynamicRuptureLayer {
+  public:
+  explicit DynamicRuptureLayer(unsigned numberOfFaces) {
+    lts.addTo(tree);
+    tree.setNumberOfTimeClusters(1);
+    tree.fixate();
+    auto& cluster = tree.child(0);
+    cluster.child<Ghost>().setNumberOfCells(0);
+    cluster.child<Copy>().setNumberOfCells(0);
+    cluster.child<Interior>().setNumberOfCells(numberOfFaces);
+    tree.allocateVariables();
+    tree.touchVariables();
+  }
+
+  initializers::Layer& layer() { return tree.child(0).child<Interior>(); }
+
+  template <typename T>
+  T* var(initializers::Variable<T> const& handle) {
+    return layer().var(handle);
+  }
+
+  LtsT lts;
+
+  private:
+  initializers::LTSTree tree;
+};
+
+/**
+ * Points the friction law to the data of the layer (see BaseFrictionLaw::evaluate).
+ */
+template <typename Derived, typename LtsT>
+void copyLtsTreeToLocal(seissol::dr::friction_law::BaseFrictionLaw<Derived>& frictionLaw,
+                        DynamicRuptureLayer<LtsT>& layer,
+                        real fullUpdateTime) {
+  frictionLaw.FrictionSolver::copyLtsTreeToLocal(layer.layer(), &layer.lts, fullUpdateTime);
+  static_cast<Derived&>(frictionLaw).copyLtsTreeToLocal(layer.layer(), &layer.lts, fullUpdateTime);
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_DYNAMICRUPTURELAYER_H
@@ -0,0 +1,136 @@
+#ifndef SEISSOL_LINEARSLIPWEAKENING_T_H
+#define SEISSOL_LINEARSLIPWEAKENING_T_H
+
+#include <algorithm>
+#include <array>
+
+#include "DynamicRupture/FrictionLaws/LinearSlipWeakening.h"
+#include "DynamicRupture/Misc.h"
+#include "tests/DynamicRupture/DynamicRuptureLayer.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+using LinearSlipWeakeningLayer = DynamicRuptureLayer<initializers::LTSLinearSlipWeakening>;
+
+inline void requireEqualFaces(LinearSlipWeakeningLayer& a, LinearSlipWeakeningLayer& b) {
+  auto& lts = a.lts;
+  for (unsigned p = 0; p < misc::numberOfBoundaryGaussPoints; p++) {
+    for (auto* variable : {&lts.mu,
+                           &lts.accumulatedSlipMagnitude,
+                           &lts.slip1,
+                           &lts.slip2,
+                           &lts.slipRateMagnitude,
+                           &lts.slipRate1,
+                           &lts.slipRate2,
+                           &lts.traction1,
+                           &lts.traction2}) {
+      REQUIRE(a.var(*variable)[0][p] == doctest::Approx(b.var(*variable)[0][p]));
+    }
+  }
+}
+
+/**
+ * A face on which all points are below the static friction strength.
+ */
+inline void initializeLockedFace(LinearSlipWeakeningLayer& face) {
+  auto& lts = face.lts;
+  auto* impAndEta = face.var(lts.impAndEta);
+  impAndEta[0].etaS = 4.0;
+  impAndEta[0].invEtaS = 1.0 / impAndEta[0].etaS;
+  for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+    face.var(lts.initialStressInFaultCS)[0][p][0] = -10.0;
+    face.var(lts.initialStressInFaultCS)[0][p][3] = 3.0;
+    face.var(lts.initialStressInFaultCS)[0][p][5] = 1.0;
+    face.var(lts.muS)[0][p] = 0.6;
+    face.var(lts.muD)[0][p] = 0.1;
+    face.var(lts.dC)[0][p] = 0.4;
+    face.var(lts.cohesion)[0][p] = -1.0;
+    face.var(lts.accumulatedSlipMagnitude)[0][p] = 0.001 * p;
+    face.var(lts.slip1)[0][p] = 0.001 * p;
+    // friction coefficient of the accumulated slip
+    face.var(lts.mu)[0][p] = 0.6 - 0.5 * std::min(0.001 * p / 0.4, 1.0);
+    face.var(lts.forcedRuptureTime)[0][p] = 1.0e10;
+  }
+}
+
+TEST_CASE("Linear slip weakening locked faces") {
+  DRParameters drParameters;
+
+  FaultStresses faultStresses;
+  for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+    for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+      faultStresses.normalStress[o][p] = -1.0 + 0.1 * o;
+      faultStresses.traction1[o][p] = 0.01 * (o + p);
+      faultStresses.traction2[o][p] = -0.005 * (o + p);
+    }
+  }
+
+  friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> frictionLaw(&drParameters);
+  double timePoints[CONVERGENCE_ORDER];
+  for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+    timePoints[o] = 0.01 * (o + 1);
+  }
+  frictionLaw.computeDeltaT(timePoints);
+
+  SUBCASE("Locked face matches the full kernel") {
+    LinearSlipWeakeningLayer full(1);
+    LinearSlipWeakeningLayer locked(1);
+    initializeLockedFace(full);
+    initializeLockedFace(locked);
+    TractionResults fullTractions;
+    TractionResults lockedTractions;
+    std::array<real, misc::numPaddedPoints> stateVariableBuffer{};
+    std::array<real, misc::numPaddedPoints> strengthBuffer{};
+
+    copyLtsTreeToLocal(frictionLaw, locked, 1.0);
+    REQUIRE(frictionLaw.mayBeLocked(0));
+    for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+      REQUIRE(frictionLaw.updateLockedFace(faultStresses, lockedTractions, strengthBuffer, 0, o));
+    }
+
+    copyLtsTreeToLocal(frictionLaw, full, 1.0);
+    for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+      frictionLaw.updateFrictionAndSlip(
+          faultStresses, fullTractions, stateVariableBuffer, strengthBuffer, 0, o);
+    }
+
+    requireEqualFaces(full, locked);
+    for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+      for (unsigned p = 0; p < misc::numberOfBoundaryGaussPoints; p++) {
+        REQUIRE(lockedTractions.traction1[o][p] == doctest::Approx(fullTractions.traction1[o][p]));
+        REQUIRE(lockedTractions.traction2[o][p] == doctest::Approx(fullTractions.traction2[o][p]));
+      }
+    }
+  }
+
+  SUBCASE("Slipping face is not modified") {
+    LinearSlipWeakeningLayer face(1);
+    LinearSlipWeakeningLayer slipping(1);
+    for (auto* layer : {&face, &slipping}) {
+      initializeLockedFace(*layer);
+      auto* initialStress = layer->var(layer->lts.initialStressInFaultCS);
+      initialStress[0][misc::numberOfBoundaryGaussPoints - 1][3] = 20.0;
+    }
+    TractionResults tractions;
+    std::array<real, misc::numPaddedPoints> strengthBuffer{};
+
+    copyLtsTreeToLocal(frictionLaw, slipping, 1.0);
+    REQUIRE(!frictionLaw.updateLockedFace(faultStresses, tractions, strengthBuffer, 0, 0));
+    requireEqualFaces(face, slipping);
+  }
+
+  SUBCASE("Forced rupture unlocks the face") {
+    LinearSlipWeakeningLayer face(1);
+    initializeLockedFace(face);
+    face.var(face.lts.forcedRuptureTime)[0][0] = 1.0;
+    copyLtsTreeToLocal(frictionLaw, face, 1.0);
+    REQUIRE(!frictionLaw.mayBeLocked(0));
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_LINEARSLIPWEAKENING_T_H
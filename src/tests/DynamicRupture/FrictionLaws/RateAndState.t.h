@@ -0,0 +1,170 @@
+#ifndef SEISSOL_RATEANDSTATE_T_H
+#define SEISSOL_RATEANDSTATE_T_H
+
+#include <array>
+
+#include "DynamicRupture/FrictionLaws/FastVelocityWeakeningLaw.h"
+#include "DynamicRupture/FrictionLaws/ThermalPressurization/NoTP.h"
+#include "DynamicRupture/Misc.h"
+#include "tests/DynamicRupture/DynamicRuptureLayer.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+constexpr unsigned NumberOfRateAndStateFaces = 5;
+
+using RateAndStateLayer = DynamicRuptureLayer<initializers::LTSRateAndStateFastVelocityWeakening>;
+
+inline void initializeRateAndStateFaces(RateAndStateLayer& faces) {
+  auto& lts = faces.lts;
+  for (unsigned face = 0; face < NumberOfRateAndStateFaces; face++) {
+    auto& impAndEta = faces.var(lts.impAndEta)[face];
+    impAndEta.etaS = 4.7e6;
+    impAndEta.invEtaS = 1.0 / impAndEta.etaS;
+    for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+      faces.var(lts.initialStressInFaultCS)[face][p][0] = -50.0e6;
+      faces.var(lts.initialStressInFaultCS)[face][p][3] = 30.0e6 + 1.0e5 * (p % 7) + 3.0e5 * face;
+      faces.var(lts.rsA)[face][p] = 0.01;
+      faces.var(lts.rsSl0)[face][p] = 0.4;
+      faces.var(lts.rsSrW)[face][p] = 0.1;
+      faces.var(lts.stateVariable)[face][p] = 0.53 + 0.001 * (p % 5);
+      faces.var(lts.slipRate1)[face][p] = 1.0e-3 * (1 + face);
+      faces.var(lts.slipRateMagnitude)[face][p] = faces.var(lts.slipRate1)[face][p];
+    }
+  }
+}
+
+TEST_CASE("Rate and state Newton solver for blocks of faces") {
+  DRParameters drParameters;
+  drParameters.rsF0 = 0.6;
+  drParameters.rsB = 0.014;
+  drParameters.rsSr0 = 1.0e-6;
+  drParameters.muW = 0.1;
+
+  RateAndStateLayer faces(NumberOfRateAndStateFaces);
+  initializeRateAndStateFaces(faces);
+  auto& lts = faces.lts;
+
+  FaultStresses faultStresses;
+  for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+    for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+      faultStresses.normalStress[o][p] = 1.0e4 * o;
+      faultStresses.traction1[o][p] = 2.0e4 * p;
+      faultStresses.traction2[o][p] = -1.0e4 * o;
+    }
+  }
+
+  friction_law::FastVelocityWeakeningLaw<friction_law::NoTP> frictionLaw(&drParameters);
+  double timePoints[CONVERGENCE_ORDER];
+  for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+    timePoints[o] = 1.0e-3 * (o + 1);
+  }
+  frictionLaw.computeDeltaT(timePoints);
+
+  constexpr auto FaceBlockSize = decltype(frictionLaw)::FaceBlockSize;
+  static_assert(NumberOfRateAndStateFaces <= FaceBlockSize);
+  using BlockArray = std::array<std::array<real, misc::numPaddedPoints>, FaceBlockSize>;
+
+  SUBCASE("Newton iteration matches the iteration per face") {
+    copyLtsTreeToLocal(frictionLaw, faces, 0.0);
+
+    BlockArray stateVariable{};
+    BlockArray normalStress{};
+    BlockArray absoluteShearStress{};
+    for (unsigned face = 0; face < NumberOfRateAndStateFaces; face++) {
+      for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+        stateVariable[face][p] = faces.var(lts.stateVariable)[face][p];
+        normalStress[face][p] = faces.var(lts.initialStressInFaultCS)[face][p][0];
+        absoluteShearStress[face][p] = faces.var(lts.initialStressInFaultCS)[face][p][3];
+      }
+    }
+
+    BlockArray blockSlipRate{};
+    std::array<bool, FaceBlockSize> blockHasConverged{};
+    frictionLaw.invertSlipRateBlock(0,
+                                    NumberOfRateAndStateFaces,
+                                    stateVariable,
+                                    normalStress,
+                                    absoluteShearStress,
+                                    blockSlipRate,
+                                    blockHasConverged);
+
+    for (unsigned face = 0; face < NumberOfRateAndStateFaces; face++) {
+      std::array<real, misc::numPaddedPoints> slipRate{};
+      const bool hasConverged = frictionLaw.invertSlipRateIterative(
+          face, stateVariable[face], normalStress[face], absoluteShearStress[face], slipRate);
+      REQUIRE(hasConverged == blockHasConverged[face]);
+      for (unsigned p = 0; p < misc::numberOfBoundaryGaussPoints; p++) {
+        REQUIRE(blockSlipRate[face][p] == doctest::Approx(slipRate[p]));
+      }
+
+      // Each point stops iterating once it has converged, so all points fulfill the tolerance
+      const friction_law::rs::Settings settings;
+      const double invEtaS = faces.var(lts.impAndEta)[face].invEtaS;
+      for (unsigned p = 0; blockHasConverged[face] && p < misc::numPaddedPoints; p++) {
+        const double mu =
+            frictionLaw.updateMu(face, p, blockSlipRate[face][p], stateVariable[face][p]);
+        const double g =
+            -invEtaS * (std::fabs(normalStress[face][p]) * mu - absoluteShearStress[face][p]) -
+            blockSlipRate[face][p];
+        REQUIRE(std::fabs(g) < settings.newtonTolerance);
+      }
+    }
+  }
+
+  SUBCASE("Friction and slip match the update per face") {
+    RateAndStateLayer blockFaces(NumberOfRateAndStateFaces);
+    initializeRateAndStateFaces(blockFaces);
+
+    std::array<FaultStresses, FaceBlockSize> blockFaultStresses{};
+    std::array<TractionResults, FaceBlockSize> blockTractionResults{};
+    BlockArray blockStateVariableBuffer{};
+    BlockArray blockStrengthBuffer{};
+    copyLtsTreeToLocal(frictionLaw, blockFaces, 0.0);
+    for (unsigned face = 0; face < NumberOfRateAndStateFaces; face++) {
+      blockFaultStresses[face] = faultStresses;
+      frictionLaw.preHook(blockStateVariableBuffer[face], face);
+    }
+    for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+      frictionLaw.updateFrictionAndSlipBlock(blockFaultStresses,
+                                             blockTractionResults,
+                                             blockStateVariableBuffer,
+                                             blockStrengthBuffer,
+                                             0,
+                                             NumberOfRateAndStateFaces,
+                                             o);
+    }
+
+    copyLtsTreeToLocal(frictionLaw, faces, 0.0);
+    for (unsigned face = 0; face < NumberOfRateAndStateFaces; face++) {
+      TractionResults tractionResults{};
+      std::array<real, misc::numPaddedPoints> stateVariableBuffer{};
+      std::array<real, misc::numPaddedPoints> strengthBuffer{};
+      frictionLaw.preHook(stateVariableBuffer, face);
+      for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+        frictionLaw.updateFrictionAndSlip(
+            faultStresses, tractionResults, stateVariableBuffer, strengthBuffer, face, o);
+      }
+
+      for (unsigned p = 0; p < misc::numberOfBoundaryGaussPoints; p++) {
+        REQUIRE(blockStateVariableBuffer[face][p] == doctest::Approx(stateVariableBuffer[p]));
+        for (auto* variable : {&lts.slipRateMagnitude, &lts.mu, &lts.slip1}) {
+          REQUIRE(blockFaces.var(*variable)[face][p] ==
+                  doctest::Approx(faces.var(*variable)[face][p]));
+        }
+        for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+          REQUIRE(blockTractionResults[face].traction1[o][p] ==
+                  doctest::Approx(tractionResults.traction1[o][p]));
+          REQUIRE(blockTractionResults[face].traction2[o][p] ==
+                  doctest::Approx(tractionResults.traction2[o][p]));
+        }
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_RATEANDSTATE_T_H
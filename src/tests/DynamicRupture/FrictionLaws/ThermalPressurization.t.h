@@ -0,0 +1,130 @@
+#ifndef SEISSOL_THERMALPRESSURIZATION_T_H
+#define SEISSOL_THERMALPRESSURIZATION_T_H
+
+#include <array>
+
+#include "DynamicRupture/FrictionLaws/ThermalPressurization/ThermalPressurization.h"
+#include "DynamicRupture/Misc.h"
+#include "tests/DynamicRupture/DynamicRuptureLayer.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+constexpr unsigned NumberOfTPFaces = 3;
+
+using TPLayer = DynamicRuptureLayer<initializers::LTSRateAndStateThermalPressurization>;
+
+inline void initializeTPFaces(TPLayer& faces, unsigned numberOfFaces) {
+  auto& lts = faces.lts;
+  for (unsigned face = 0; face < numberOfFaces; face++) {
+    for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+      faces.var(lts.halfWidthShearZone)[face][p] = 0.01;
+      faces.var(lts.hydraulicDiffusivity)[face][p] = 1.0e-4;
+      faces.var(lts.mu)[face][p] = 0.6 - 0.01 * face;
+    }
+  }
+}
+
+TEST_CASE("Thermal pressurization grid") {
+  const friction_law::TPGrid defaultGrid(misc::numberOfTPGridPoints);
+  const friction_law::TPGrid reducedGrid(30);
+  const friction_law::TPGrid coarseGrid(10);
+
+  REQUIRE(defaultGrid.size() == misc::numberOfTPGridPoints);
+  REQUIRE(reducedGrid.size() == 30);
+  // all grids cover the same range of wave numbers
+  REQUIRE(reducedGrid.gridPoint(29) == doctest::Approx(misc::tpMaxWaveNumber));
+  REQUIRE(reducedGrid.gridPoint(0) == doctest::Approx(defaultGrid.gridPoint(0)));
+  REQUIRE(defaultGrid.gridPoint(misc::numberOfTPGridPoints - 2) ==
+          doctest::Approx(misc::tpMaxWaveNumber * std::exp(-misc::tpLogDz)));
+
+  REQUIRE(defaultGrid.estimateError() < 1.0e-4);
+  REQUIRE(defaultGrid.estimateError() < reducedGrid.estimateError());
+  REQUIRE(reducedGrid.estimateError() < coarseGrid.estimateError());
+  REQUIRE(coarseGrid.estimateError() > 1.0e-2);
+}
+
+TEST_CASE("Thermal pressurization with cached decay factors") {
+  DRParameters drParameters;
+  drParameters.thermalDiffusivity = 1.0e-6;
+  drParameters.heatCapacity = 2.7e6;
+  drParameters.undrainedTPResponse = 0.1e6;
+  drParameters.initialTemperature = 483.15;
+  drParameters.initialPressure = -80.0e6;
+
+  TPLayer cachedFaces(NumberOfTPFaces);
+  initializeTPFaces(cachedFaces, NumberOfTPFaces);
+  // the additional face has other parameters, hence the decay factors are not cached
+  TPLayer faces(NumberOfTPFaces + 1);
+  initializeTPFaces(faces, NumberOfTPFaces + 1);
+  faces.var(faces.lts.halfWidthShearZone)[NumberOfTPFaces][0] = 0.02;
+  auto& lts = faces.lts;
+
+  std::array<real, misc::numPaddedPoints> normalStress{};
+  std::array<real, misc::numPaddedPoints> slipRateMagnitude{};
+  for (unsigned p = 0; p < misc::numPaddedPoints; p++) {
+    normalStress[p] = -50.0e6 + 1.0e5 * p;
+    slipRateMagnitude[p] = 1.0 + 0.01 * p;
+  }
+
+  real deltaT[CONVERGENCE_ORDER];
+  for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+    deltaT[o] = 1.0e-3 * (o + 1);
+  }
+
+  friction_law::ThermalPressurization tp(&drParameters);
+
+  tp.copyLtsTreeToLocal(cachedFaces.layer(), &cachedFaces.lts, 0.0);
+  tp.precomputeDecayFactors(deltaT);
+  REQUIRE(tp.hasCachedDecayFactors());
+  for (unsigned step = 0; step < 3; step++) {
+    for (unsigned face = 0; face < NumberOfTPFaces; face++) {
+      for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+        tp.calcFluidPressure(normalStress,
+                             cachedFaces.var(lts.mu),
+                             slipRateMagnitude,
+                             deltaT[o],
+                             true,
+                             o,
+                             face);
+      }
+    }
+  }
+
+  tp.copyLtsTreeToLocal(faces.layer(), &faces.lts, 0.0);
+  tp.precomputeDecayFactors(deltaT);
+  REQUIRE(!tp.hasCachedDecayFactors());
+  for (unsigned step = 0; step < 3; step++) {
+    for (unsigned face = 0; face < NumberOfTPFaces; face++) {
+      for (unsigned o = 0; o < CONVERGENCE_ORDER; o++) {
+        tp.calcFluidPressure(
+            normalStress, faces.var(lts.mu), slipRateMagnitude, deltaT[o], true, o, face);
+      }
+    }
+  }
+
+  for (unsigned face = 0; face < NumberOfTPFaces; face++) {
+    for (unsigned p = 0; p < misc::numberOfBoundaryGaussPoints; p++) {
+      const real temperatureChange =
+          faces.var(lts.temperature)[face][p] - drParameters.initialTemperature;
+      const real pressureChange = faces.var(lts.pressure)[face][p] - drParameters.initialPressure;
+      REQUIRE(temperatureChange > 0.0);
+      REQUIRE(cachedFaces.var(lts.temperature)[face][p] - drParameters.initialTemperature ==
+              doctest::Approx(temperatureChange));
+      REQUIRE(cachedFaces.var(lts.pressure)[face][p] - drParameters.initialPressure ==
+              doctest::Approx(pressureChange));
+      for (unsigned i = 0; i < misc::numberOfTPGridPoints; i++) {
+        REQUIRE(cachedFaces.var(lts.theta)[face][i][p] ==
+                doctest::Approx(faces.var(lts.theta)[face][i][p]));
+        REQUIRE(cachedFaces.var(lts.sigma)[face][i][p] ==
+                doctest::Approx(faces.var(lts.sigma)[face][i][p]));
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_THERMALPRESSURIZATION_T_H
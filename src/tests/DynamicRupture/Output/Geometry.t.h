@@ -7,6 +7,7 @@
 #include "Numerical_aux/Transformation.h"
 #include "Initializer/PointMapper.h"
 #include "Geometry/MeshReader.h"
+#include "generated_code/init.h"
 #include "tests/Geometry/MockReader.h"
 #include <iostream>
 #include <Eigen/Dense>
@@ -147,6 +148,29 @@ TEST_CASE("DR Geometry") {
     }
   }
 
+  SUBCASE("ProjectedGradient") {
+    // the projection reproduces a linear function, hence its gradient is exact everywhere
+    auto chiTau2dPoints =
+        init::quadpoints::view::create(const_cast<real*>(init::quadpoints::Values));
+    std::array<double, TriangleQuadratureData::size> linearFunction{};
+    for (unsigned i = 0; i < TriangleQuadratureData::size; ++i) {
+      linearFunction[i] = 1.0 + 2.0 * chiTau2dPoints(i, 0) - 3.0 * chiTau2dPoints(i, 1);
+    }
+
+    constexpr double epsilon = 1e-4;
+    for (unsigned gp = 0; gp < TriangleQuadratureData::size; ++gp) {
+      const auto coefficients = getProjectedGradientCoefficients(gp);
+      double dChi = 0.0;
+      double dTau = 0.0;
+      for (unsigned i = 0; i < TriangleQuadratureData::size; ++i) {
+        dChi += coefficients[0][i] * linearFunction[i];
+        dTau += coefficients[1][i] * linearFunction[i];
+      }
+      REQUIRE(dChi == AbsApprox(2.0).epsilon(epsilon));
+      REQUIRE(dTau == AbsApprox(-3.0).epsilon(epsilon));
+    }
+  }
+
   SUBCASE("StrikeAndDipVectors") {
     VrtxCoords testNormal{-1.0 / std::sqrt(3.0), 1.0 / std::sqrt(3.0), 1.0 / std::sqrt(3.0)};
     VrtxCoords testStrike{0.0, 0.0, 0.0};
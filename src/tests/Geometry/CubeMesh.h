@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "Geometry/MeshDefinition.h"
+#include "Geometry/MeshTools.h"
+
+namespace seissol {
+/**
+ * Structured tetrahedral mesh of the unit cube with n^3 hexahedra,
+ * each of which is split into 6 positively oriented tetrahedra.
+ */
+class CubeMesh {
+  public:
+  explicit CubeMesh(unsigned n) {
+    const auto vertexId = [n](unsigned i, unsigned j, unsigned k) {
+      return static_cast<int>((k * (n + 1) + j) * (n + 1) + i);
+    };
+
+    vertices.resize((n + 1) * (n + 1) * (n + 1));
+    for (unsigned k = 0; k <= n; ++k) {
+      for (unsigned j = 0; j <= n; ++j) {
+        for (unsigned i = 0; i <= n; ++i) {
+          auto& coords = vertices[vertexId(i, j, k)].coords;
+          coords[0] = static_cast<double>(i) / n;
+          coords[1] = static_cast<double>(j) / n;
+          coords[2] = static_cast<double>(k) / n;
+        }
+      }
+    }
+
+    // Each tetrahedron walks from corner (0,0,0) to corner (1,1,1) along a permutation of the axes
+    constexpr std::array<std::array<int, 3>, 6> Permutations = {
+        {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+    elements.reserve(6 * n * n * n);
+    for (unsigned k = 0; k < n; ++k) {
+      for (unsigned j = 0; j < n; ++j) {
+        for (unsigned i = 0; i < n; ++i) {
+          for (const auto& permutation : Permutations) {
+            Element element{};
+            element.localId = static_cast<int>(elements.size());
+            std::array<unsigned, 3> corner = {i, j, k};
+            element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+            for (int v = 0; v < 3; ++v) {
+              ++corner[permutation[v]];
+              element.vertices[v + 1] = vertexId(corner[0], corner[1], corner[2]);
+            }
+            if (signedVolume(element) < 0.0) {
+              std::swap(element.vertices[1], element.vertices[2]);
+            }
+            elements.push_back(element);
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<Vertex> vertices;
+  std::vector<Element> elements;
+
+  private:
+  [[nodiscard]] double signedVolume(Element const& element) const {
+    VrtxCoords a, b, c, bc;
+    MeshTools::sub(vertices[element.vertices[1]].coords, vertices[element.vertices[0]].coords, a);
+    MeshTools::sub(vertices[element.vertices[2]].coords, vertices[element.vertices[0]].coords, b);
+    MeshTools::sub(vertices[element.vertices[3]].coords, vertices[element.vertices[0]].coords, c);
+    MeshTools::cross(b, c, bc);
+    return MeshTools::dot(a, bc);
+  }
+};
+} // namespace seissol
@@ -1,4 +1,6 @@
 #include <array>
+#include <limits>
+#include <vector>
 #include <iostream>
 #include <iomanip>
 
@@ -51,6 +53,38 @@ TEST_CASE("Variable Subsampler") {
       REQUIRE(outDofs[i] == AbsApprox(expectedDOFs[i]).epsilon(epsilon));
     }
   };
+
+  SUBCASE("Multiple variables") {
+    seissol::refinement::DivideTetrahedronBy8<double> refineBy8;
+    constexpr unsigned numCells = 3;
+    seissol::refinement::VariableSubsampler<double> subsampler(numCells, refineBy8, 3, 9, 12);
+
+    std::array<real, numCells * 108> dofs;
+    for (auto& dof : dofs) {
+      dof = (real)std::rand() / RAND_MAX;
+    }
+    unsigned int cellMap[numCells] = {2, 0, 1};
+
+    const std::vector<unsigned int> variables = {0, 4, 8};
+    std::array<std::array<real, numCells * 8>, 3> expected;
+    std::array<std::array<real, numCells * 8>, 3> outDofs;
+    real* outBuffers[3] = {outDofs[0].data(), outDofs[1].data(), outDofs[2].data()};
+    for (unsigned v = 0; v < variables.size(); v++) {
+      subsampler.get(dofs.data(), cellMap, variables[v], expected[v].data());
+    }
+
+    // The summation order differs from get
+    constexpr double multipleEpsilon = 100 * epsilon;
+    REQUIRE(subsampler.getMultiple(dofs.data(), cellMap, variables, outBuffers));
+    for (unsigned v = 0; v < variables.size(); v++) {
+      for (unsigned i = 0; i < numCells * 8; i++) {
+        REQUIRE(outDofs[v][i] == AbsApprox(expected[v][i]).epsilon(multipleEpsilon));
+      }
+    }
+
+    dofs[108 + 4 * 12] = std::numeric_limits<real>::quiet_NaN();
+    REQUIRE(!subsampler.getMultiple(dofs.data(), cellMap, variables, outBuffers));
+  };
 }
 
 } // namespace seissol::unit_test
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "Initializer/MemoryAllocator.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Host memkinds") {
+  constexpr std::size_t Size = 3 * 1024 * 1024 + 17;
+  constexpr std::size_t Alignment = 2 * 1024 * 1024;
+
+  for (const auto memkind : {memory::TransparentHugePages,
+                             memory::HugePages2M,
+                             memory::HugePages1G,
+                             memory::NumaInterleave,
+                             memory::NumaPreferred}) {
+    auto* data = static_cast<char*>(memory::allocate(Size, Alignment, memkind));
+    REQUIRE(data != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(data) % Alignment == 0);
+    std::memset(data, 1, Size);
+    REQUIRE(data[Size - 1] == 1);
+
+#ifdef __linux__
+    const auto distribution = memory::numaPageDistribution(data, Size, 64);
+    if (distribution.sampled > 0) {
+      std::size_t pages = distribution.notPresent;
+      for (const auto pagesOnNode : distribution.pagesPerNode) {
+        pages += pagesOnNode;
+      }
+      REQUIRE(pages == distribution.sampled);
+      REQUIRE(distribution.notPresent == 0);
+    }
+#endif
+
+    memory::free(data, memkind);
+  }
+}
+
+TEST_CASE("Host memkinds for small allocations") {
+  // Explicit huge pages are only used for allocations of at least one huge page
+  constexpr std::size_t Size = 1000;
+  constexpr std::size_t Alignment = 64;
+
+  for (const auto memkind : {memory::HugePages2M, memory::HugePages1G}) {
+    auto* data = static_cast<char*>(memory::allocate(Size, Alignment, memkind));
+    REQUIRE(data != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(data) % Alignment == 0);
+    std::memset(data, 1, Size);
+    REQUIRE(data[Size - 1] == 1);
+    memory::free(data, memkind);
+  }
+}
+
+TEST_CASE("Host memkind selection") {
+  REQUIRE(memory::hostMemkind(memory::Standard, "SEISSOL_TEST_UNSET_MEMKIND") == memory::Standard);
+  REQUIRE(memory::hostMemkind(memory::HighBandwidth, "SEISSOL_TEST_UNSET_MEMKIND") ==
+          memory::HighBandwidth);
+
+  setenv("SEISSOL_TEST_MEMKIND", "preferred", 1);
+  REQUIRE(memory::hostMemkind(memory::Standard, "SEISSOL_TEST_MEMKIND") == memory::NumaPreferred);
+  setenv("SEISSOL_TEST_MEMKIND", "huge1g", 1);
+  REQUIRE(memory::hostMemkind(memory::Standard, "SEISSOL_TEST_MEMKIND") == memory::HugePages1G);
+  unsetenv("SEISSOL_TEST_MEMKIND");
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,97 @@
+#include "Initializer/MemoryFootprint.h"
+#include "Initializer/tree/LTSTree.hpp"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Memory footprint of a tree") {
+  using namespace seissol::initializers;
+
+  LTSTree tree;
+  Variable<double[4]> dofs;
+  Variable<int> info;
+  Bucket buffers;
+  tree.addVar(dofs, LayerMask(Ghost), 1, memory::Standard, "dofs");
+  tree.addVar(info, LayerMask(), 1, memory::Standard, "info");
+  tree.addBucket(buffers, 1, memory::Standard, "buffers");
+  tree.setNumberOfTimeClusters(2);
+  tree.fixate();
+
+  for (unsigned tc = 0; tc < 2; ++tc) {
+    auto& cluster = tree.child(tc);
+    cluster.child<Ghost>().setNumberOfCells(1 + tc);
+    cluster.child<Copy>().setNumberOfCells(2 + tc);
+    cluster.child<Interior>().setNumberOfCells(10 + tc);
+    cluster.child<Ghost>().setBucketSize(buffers, 100);
+    cluster.child<Copy>().setBucketSize(buffers, 200);
+    cluster.child<Interior>().setBucketSize(buffers, 300);
+  }
+
+  MemoryFootprint footprint;
+  footprint.setTree("lts", tree);
+  const auto& entries = footprint.entries();
+  REQUIRE(entries.size() == 3);
+
+  // The ghost layer is masked for the dofs
+  REQUIRE(entries[0].name == "dofs");
+  REQUIRE(entries[0].kind == "variable");
+  REQUIRE(entries[0].bytesPerLayer.size() == 2);
+  REQUIRE(entries[0].bytesPerLayer[1][0] == 0);
+  REQUIRE(entries[0].bytesPerLayer[1][1] == 3 * 4 * sizeof(double));
+  REQUIRE(entries[0].bytes == (2 + 3 + 10 + 11) * 4 * sizeof(double));
+
+  REQUIRE(entries[1].bytes == (1 + 2 + 10 + 2 + 3 + 11) * sizeof(int));
+
+  REQUIRE(entries[2].kind == "bucket");
+  REQUIRE(entries[2].bytesPerLayer[0][2] == 300);
+  REQUIRE(entries[2].bytes == 2 * 600);
+
+  const auto treeBytes = footprint.hostBytes();
+  REQUIRE(treeBytes == entries[0].bytes + entries[1].bytes + entries[2].bytes);
+
+  // Buffers are replaced, not accumulated
+  footprint.setBuffer("output", "staging", 1000);
+  footprint.setBuffer("output", "staging", 2000);
+  footprint.setBuffer("output", "device", 4000, memory::DeviceGlobalMemory);
+  footprint.setTree("lts", tree);
+  REQUIRE(footprint.entries().size() == 5);
+  REQUIRE(footprint.hostBytes() == treeBytes + 2000);
+  REQUIRE(footprint.deviceBytes() == 4000);
+}
+
+TEST_CASE("Memory footprints with different registrations") {
+  using namespace seissol::initializers;
+
+  // Only the first rank has receivers, only the second one a fault output
+  MemoryFootprint first;
+  first.setBuffer("async I/O", "wave field", 100);
+  first.setBuffer("async I/O", "receivers", 50);
+  MemoryFootprint second;
+  second.setBuffer("async I/O", "fault", 300);
+  second.setBuffer("async I/O", "wave field", 200);
+
+  auto keys = first.keys();
+  mergeFootprintKeys(keys, second.keys());
+  REQUIRE(keys.size() == 3);
+  REQUIRE(keys[0] == "async I/O\tbuffer\twave field");
+  REQUIRE(keys[2] == "async I/O\tbuffer\tfault");
+
+  const auto firstBytes = first.bytesOf(keys);
+  const auto secondBytes = second.bytesOf(keys);
+  REQUIRE(firstBytes == std::vector<unsigned long long>{100, 50, 0});
+  REQUIRE(secondBytes == std::vector<unsigned long long>{200, 0, 300});
+}
+
+TEST_CASE("Memory size parsing") {
+  using seissol::initializers::parseMemorySize;
+  REQUIRE(parseMemorySize("1048576") == 1048576);
+  REQUIRE(parseMemorySize("512K") == 512 * 1024);
+  REQUIRE(parseMemorySize("64G") == 64ULL * 1024 * 1024 * 1024);
+  REQUIRE(parseMemorySize("1.5GiB") == 3ULL * 512 * 1024 * 1024);
+  REQUIRE(parseMemorySize("2 mb") == 2 * 1024 * 1024);
+  REQUIRE(parseMemorySize("") == 0);
+  REQUIRE(parseMemorySize("a lot") == 0);
+  REQUIRE(parseMemorySize("10X") == 0);
+  REQUIRE(parseMemorySize("-1G") == 0);
+}
+
+} // namespace seissol::unit_test
@@ -1,5 +1,11 @@
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
 #include <Eigen/Dense>
 
+#include "tests/Geometry/CubeMesh.h"
 #include "tests/Geometry/MockReader.h"
 #include "Initializer/PointMapper.h"
 
@@ -41,4 +47,41 @@ TEST_CASE("Point mapper") {
   }
 }
 
+TEST_CASE("Point locator matches brute force search") {
+  const seissol::CubeMesh mesh(4);
+
+  // Random points in and around the unit cube as well as all vertices,
+  // which lie on the boundary of many elements
+  std::srand(123);
+  std::vector<Eigen::Vector3d> points;
+  for (int i = 0; i < 500; ++i) {
+    points.emplace_back(1.2 * std::rand() / RAND_MAX - 0.1,
+                        1.2 * std::rand() / RAND_MAX - 0.1,
+                        1.2 * std::rand() / RAND_MAX - 0.1);
+  }
+  for (const auto& vertex : mesh.vertices) {
+    points.emplace_back(vertex.coords[0], vertex.coords[1], vertex.coords[2]);
+  }
+  const auto numPoints = static_cast<unsigned>(points.size());
+
+  std::vector<short> contained(numPoints);
+  std::vector<unsigned> meshIds(numPoints, std::numeric_limits<unsigned>::max());
+  std::vector<short> expectedContained(numPoints);
+  std::vector<unsigned> expectedMeshIds(numPoints, std::numeric_limits<unsigned>::max());
+
+  seissol::initializers::findMeshIds(
+      points.data(), mesh.vertices, mesh.elements, numPoints, contained.data(), meshIds.data());
+  seissol::initializers::findMeshIdsBruteForce(points.data(),
+                                               mesh.vertices,
+                                               mesh.elements,
+                                               numPoints,
+                                               expectedContained.data(),
+                                               expectedMeshIds.data());
+
+  for (unsigned i = 0; i < numPoints; ++i) {
+    REQUIRE(contained[i] == expectedContained[i]);
+    REQUIRE(meshIds[i] == expectedMeshIds[i]);
+  }
+}
+
 } // namespace seissol::unit_test
\ No newline at end of file
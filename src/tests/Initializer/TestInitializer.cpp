@@ -2,4 +2,9 @@
 #include "tests/TestHelper.h"
 
 #include "time_stepping/LTSWeights.t.h"
-#include "PointMapper.t.h"
\ No newline at end of file
+#include "time_stepping/CostModel.t.h"
+#include "time_stepping/MultiRate.t.h"
+#include "time_stepping/CellOrdering.t.h"
+#include "PointMapper.t.h"
+#include "MemoryAllocator.t.h"
+#include "MemoryFootprint.t.h"
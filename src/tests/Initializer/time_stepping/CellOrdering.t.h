@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "Initializer/time_stepping/CellOrdering.h"
+
+namespace seissol::unit_test {
+
+using namespace seissol::initializers::time_stepping;
+
+TEST_CASE("Morton key") {
+  REQUIRE(mortonKey(0, 0, 0) == 0);
+  REQUIRE(mortonKey(0, 0, 1) == 1);
+  REQUIRE(mortonKey(0, 1, 0) == 2);
+  REQUIRE(mortonKey(1, 0, 0) == 4);
+  REQUIRE(mortonKey(3, 0, 0) == 4 + 32);
+  const std::uint32_t maxCoordinate = (1u << CurveBits) - 1;
+  REQUIRE(mortonKey(maxCoordinate, maxCoordinate, maxCoordinate) == (1ULL << (3 * CurveBits)) - 1);
+}
+
+TEST_CASE("Hilbert curve") {
+  // The first 8^3 points of the curve fill the cube at the origin,
+  // and consecutive points are face neighbors
+  constexpr unsigned N = 8;
+  std::vector<std::array<double, 3>> barycenters;
+  std::vector<unsigned> cells;
+  std::set<std::uint64_t> keys;
+  for (unsigned x = 0; x < N; ++x) {
+    for (unsigned y = 0; y < N; ++y) {
+      for (unsigned z = 0; z < N; ++z) {
+        keys.insert(hilbertKey(x, y, z));
+        cells.push_back(barycenters.size());
+        barycenters.push_back({static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)});
+      }
+    }
+  }
+  REQUIRE(keys.size() == N * N * N);
+  REQUIRE(*keys.rbegin() == N * N * N - 1);
+
+  // Sort by the raw keys (sortCells would scale the bounding box to the full curve)
+  std::vector<std::pair<std::uint64_t, unsigned>> sorted;
+  for (const auto cell : cells) {
+    const auto& b = barycenters[cell];
+    sorted.emplace_back(hilbertKey(b[0], b[1], b[2]), cell);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t i = 1; i < sorted.size(); ++i) {
+    const auto& a = barycenters[sorted[i - 1].second];
+    const auto& b = barycenters[sorted[i].second];
+    const double distance =
+        std::abs(a[0] - b[0]) + std::abs(a[1] - b[1]) + std::abs(a[2] - b[2]);
+    REQUIRE(distance == 1.0);
+  }
+}
+
+TEST_CASE("Cell sorting and locality") {
+  // Regular grid of cells, numbered such that neighbors in x are far apart in memory
+  constexpr unsigned N = 16;
+  auto id = [](unsigned x, unsigned y, unsigned z) { return (z * N + y) * N + x; };
+  std::vector<std::array<double, 3>> barycenters(N * N * N);
+  std::vector<unsigned> cells(N * N * N);
+  for (unsigned x = 0; x < N; ++x) {
+    for (unsigned y = 0; y < N; ++y) {
+      for (unsigned z = 0; z < N; ++z) {
+        barycenters[id(x, y, z)] = {x + 0.5, y + 0.5, z + 0.5};
+        cells[id(x, y, z)] = id(x, y, z);
+      }
+    }
+  }
+
+  auto neighborsInOrder = [&](const std::vector<unsigned>& order) {
+    std::vector<unsigned> position(order.size());
+    for (unsigned i = 0; i < order.size(); ++i) {
+      position[order[i]] = i;
+    }
+    std::vector<std::array<unsigned, 4>> neighbors(order.size());
+    for (unsigned i = 0; i < order.size(); ++i) {
+      const unsigned cell = order[i];
+      const unsigned x = cell % N;
+      const unsigned y = (cell / N) % N;
+      const unsigned z = cell / (N * N);
+      neighbors[i] = {x > 0 ? position[id(x - 1, y, z)] : std::numeric_limits<unsigned>::max(),
+                      y > 0 ? position[id(x, y - 1, z)] : std::numeric_limits<unsigned>::max(),
+                      z > 0 ? position[id(x, y, z - 1)] : std::numeric_limits<unsigned>::max(),
+                      z + 1 < N ? position[id(x, y, z + 1)] : std::numeric_limits<unsigned>::max()};
+    }
+    return neighbors;
+  };
+
+  const auto before = analyzeLocality(neighborsInOrder(cells), 64, 512);
+
+  std::vector<unsigned> hilbert = cells;
+  sortCells(hilbert, barycenters, CellOrdering::Hilbert);
+  REQUIRE(std::set<unsigned>(hilbert.begin(), hilbert.end()).size() == cells.size());
+  const auto after = analyzeLocality(neighborsInOrder(hilbert), 64, 512);
+
+  REQUIRE(after.neighborAccesses == before.neighborAccesses);
+  REQUIRE(after.averageNeighborDistance() < before.averageNeighborDistance());
+  REQUIRE(after.l2Misses < before.l2Misses);
+
+  std::vector<unsigned> meshIds = cells;
+  sortCells(meshIds, barycenters, CellOrdering::MeshId);
+  REQUIRE(meshIds == cells);
+}
+
+} // namespace seissol::unit_test
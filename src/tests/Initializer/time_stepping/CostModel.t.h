@@ -0,0 +1,61 @@
+#include "Initializer/time_stepping/LtsWeights/CostModel.h"
+
+#include <cstdio>
+#include <string>
+
+namespace seissol::unit_test {
+
+TEST_CASE("LTS cost model") {
+  using namespace seissol::initializers::time_stepping;
+
+  const KernelCosts costs{1.0e-6, 2.0e-6, 1.0e-6, 2.0e-6, 1.0e-6};
+
+  SUBCASE("Vertex weights are relative to an element") {
+    const auto weights = computeVertexWeights(costs, 100);
+    REQUIRE(weights.element == 100);
+    REQUIRE(weights.dynamicRupture == 50);
+    REQUIRE(weights.freeSurfaceWithGravity == 25);
+  }
+
+  SUBCASE("Friction laws scale the dynamic rupture cost") {
+    using seissol::dr::FrictionLawType;
+    REQUIRE(frictionLawCostFactor(FrictionLawType::NoFault, false) == 1.0);
+    REQUIRE(frictionLawCostFactor(FrictionLawType::LinearSlipWeakening, false) <
+            frictionLawCostFactor(FrictionLawType::RateAndStateAgingLaw, false));
+    REQUIRE(frictionLawCostFactor(FrictionLawType::RateAndStateFastVelocityWeakening, false) <
+            frictionLawCostFactor(FrictionLawType::RateAndStateFastVelocityWeakening, true));
+  }
+
+  SUBCASE("Costs are cached per key") {
+    const std::string fileName = "cost-model-test.txt";
+    std::remove(fileName.c_str());
+
+    REQUIRE(!loadKernelCosts(fileName, "a").has_value());
+
+    storeKernelCosts(fileName, "a", costs);
+    storeKernelCosts(fileName, "b", KernelCosts{3.0, 4.0, 5.0, 6.0, 7.0});
+
+    const auto cachedA = loadKernelCosts(fileName, "a");
+    REQUIRE(cachedA.has_value());
+    REQUIRE(cachedA->local == costs.local);
+    REQUIRE(cachedA->neighbor == costs.neighbor);
+    REQUIRE(cachedA->plasticity == costs.plasticity);
+    REQUIRE(cachedA->dynamicRupture == costs.dynamicRupture);
+    REQUIRE(cachedA->freeSurfaceWithGravity == costs.freeSurfaceWithGravity);
+
+    const auto cachedB = loadKernelCosts(fileName, "b");
+    REQUIRE(cachedB.has_value());
+    REQUIRE(cachedB->local == 3.0);
+    REQUIRE(!loadKernelCosts(fileName, "c").has_value());
+
+    std::remove(fileName.c_str());
+  }
+
+  SUBCASE("Keys contain no white space") {
+    const auto key = costModelKey(false);
+    REQUIRE(key.find(' ') == std::string::npos);
+    REQUIRE(key.find('\t') == std::string::npos);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,40 @@
+#include "Initializer/time_stepping/MultiRate.hpp"
+
+#include <array>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Multi-rate clustering with a non-power-of-two rate") {
+  using namespace seissol::initializers::time_stepping;
+
+  std::array<double, 5> timeStepWidths = {1.0, 2.9, 3.1, 9.5, 10.0};
+  std::array<unsigned int, 5> cellClusterIds{};
+  unsigned int numberOfGlobalClusters = 0;
+  double* globalTimeStepWidths = nullptr;
+  unsigned int* globalTimeStepRates = nullptr;
+
+  MultiRate::deriveClusterIds(timeStepWidths.size(),
+                              3,
+                              timeStepWidths.data(),
+                              cellClusterIds.data(),
+                              numberOfGlobalClusters,
+                              globalTimeStepWidths,
+                              globalTimeStepRates);
+
+  REQUIRE(numberOfGlobalClusters == 3);
+  const std::array<unsigned int, 5> expectedClusterIds = {0, 0, 1, 2, 2};
+  for (unsigned int cell = 0; cell < timeStepWidths.size(); ++cell) {
+    REQUIRE(cellClusterIds[cell] == expectedClusterIds[cell]);
+  }
+  REQUIRE(globalTimeStepWidths[0] == doctest::Approx(1.0));
+  REQUIRE(globalTimeStepWidths[1] == doctest::Approx(3.0));
+  REQUIRE(globalTimeStepWidths[2] == doctest::Approx(9.0));
+  REQUIRE(globalTimeStepRates[0] == 3);
+  REQUIRE(globalTimeStepRates[1] == 3);
+  REQUIRE(globalTimeStepRates[2] == 1);
+
+  delete[] globalTimeStepWidths;
+  delete[] globalTimeStepRates;
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,71 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "Kernels/MixedPrecision.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Mixed precision buffers") {
+  constexpr std::size_t Size = 37;
+  std::vector<real> values(Size);
+  for (std::size_t i = 0; i < Size; ++i) {
+    values[i] = std::sin(0.3 * i);
+  }
+  // Two roundings to reduced precision
+  const double tolerance =
+      2.0 * std::numeric_limits<kernels::mixed_precision::ReducedReal>::epsilon();
+
+  std::vector<real> slot(Size, 0.0);
+  auto* buffer = kernels::mixed_precision::reducedBuffer(slot.data());
+  kernels::mixed_precision::compress(values.data(), buffer, Size);
+  kernels::mixed_precision::accumulate(values.data(), buffer, Size);
+
+  std::vector<real> result(Size);
+  kernels::mixed_precision::decompress(buffer, result.data(), Size);
+  for (std::size_t i = 0; i < Size; ++i) {
+    REQUIRE(result[i] == AbsApprox(2.0 * values[i]).epsilon(tolerance));
+  }
+}
+
+TEST_CASE("Mixed precision buffer packing") {
+  constexpr std::size_t BufferSize = 8;
+  constexpr std::size_t DerivativesSize = 24;
+  constexpr unsigned NumberOfBuffers = 3;
+  constexpr unsigned NumberOfDerivatives = 2;
+  const std::size_t regionSize = NumberOfBuffers * BufferSize + NumberOfDerivatives * DerivativesSize;
+  const double tolerance = std::numeric_limits<kernels::mixed_precision::ReducedReal>::epsilon();
+
+  // Copy region: buffers in reduced precision followed by derivatives in full precision
+  std::vector<real> copy(regionSize, 0.0);
+  std::vector<real> expected(regionSize);
+  for (std::size_t i = 0; i < regionSize; ++i) {
+    expected[i] = std::cos(0.7 * i) + 0.1;
+  }
+  for (unsigned buffer = 0; buffer < NumberOfBuffers; ++buffer) {
+    kernels::mixed_precision::compress(&expected[buffer * BufferSize],
+                                       kernels::mixed_precision::reducedBuffer(&copy[buffer * BufferSize]),
+                                       BufferSize);
+  }
+
+  std::vector<kernels::mixed_precision::ReducedReal> packed(NumberOfBuffers * BufferSize);
+  kernels::mixed_precision::packBuffers(copy.data(), NumberOfBuffers, BufferSize, packed.data());
+
+  // The derivatives are exchanged in full precision and not touched by the unpacking
+  std::vector<real> ghost(regionSize, -1.0);
+  kernels::mixed_precision::unpackBuffers(packed.data(), NumberOfBuffers, BufferSize, ghost.data());
+
+  for (unsigned buffer = 0; buffer < NumberOfBuffers; ++buffer) {
+    std::vector<real> values(BufferSize);
+    kernels::mixed_precision::decompress(
+        kernels::mixed_precision::reducedBuffer(&ghost[buffer * BufferSize]), values.data(), BufferSize);
+    for (std::size_t i = 0; i < BufferSize; ++i) {
+      REQUIRE(values[i] == AbsApprox(expected[buffer * BufferSize + i]).epsilon(tolerance));
+    }
+  }
+  for (std::size_t i = NumberOfBuffers * BufferSize; i < regionSize; ++i) {
+    REQUIRE(ghost[i] == -1.0);
+  }
+}
+
+} // namespace seissol::unit_test
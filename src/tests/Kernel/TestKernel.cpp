@@ -1,5 +1,8 @@
 #include "doctest.h"
+#include "tests/TestHelper.h"
 
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
-#endif // USE_POROELASTIC
\ No newline at end of file
+#endif // USE_POROELASTIC
+
+#include "MixedPrecision.t.h"
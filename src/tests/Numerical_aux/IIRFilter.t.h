@@ -0,0 +1,70 @@
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "Numerical_aux/IIRFilter.h"
+
+namespace seissol::unit_test {
+
+namespace {
+//! Magnitude of the frequency response at the frequency f (relative to the sampling frequency)
+double gain(const std::vector<filter::Biquad>& sections, double f) {
+  const auto z = std::polar(1.0, -2.0 * M_PI * f);
+  std::complex<double> response = 1.0;
+  for (const auto& s : sections) {
+    response *= (s.b0 + s.b1 * z + s.b2 * z * z) / (1.0 + s.a1 * z + s.a2 * z * z);
+  }
+  return std::abs(response);
+}
+} // namespace
+
+TEST_CASE("Butterworth low-pass filter") {
+  constexpr double Cutoff = 0.04;
+  const auto sections = filter::designButterworthLowPass(8, Cutoff);
+  REQUIRE(sections.size() == 4);
+
+  // Unit gain at zero frequency, -3 dB at the cutoff and strong attenuation beyond
+  REQUIRE(gain(sections, 0.0) == doctest::Approx(1.0));
+  REQUIRE(gain(sections, Cutoff) == doctest::Approx(1.0 / std::sqrt(2.0)));
+  REQUIRE(gain(sections, 0.5 * Cutoff) == doctest::Approx(1.0).epsilon(1.0e-3));
+  REQUIRE(gain(sections, 2.0 * Cutoff) < 1.0e-2);
+
+  SUBCASE("Streaming with external state") {
+    const filter::IIRCascade cascade(sections);
+    REQUIRE(cascade.stateSize() == 8);
+
+    std::vector<double> signal(500);
+    for (unsigned i = 0; i < signal.size(); ++i) {
+      signal[i] = std::sin(0.01 * i) + 0.5 * std::sin(1.3 * i);
+    }
+
+    // Filtering in one pass and in two chunks with the state carried over (as with a
+    // checkpoint) gives the same result
+    std::vector<double> state(cascade.stateSize(), 0.0);
+    std::vector<double> filtered;
+    for (auto x : signal) {
+      filtered.push_back(cascade.apply(x, state.data()));
+    }
+
+    std::vector<double> firstState(cascade.stateSize(), 0.0);
+    for (unsigned i = 0; i < 200; ++i) {
+      cascade.apply(signal[i], firstState.data());
+    }
+    std::vector<double> secondState(firstState);
+    for (unsigned i = 200; i < signal.size(); ++i) {
+      REQUIRE(cascade.apply(signal[i], secondState.data()) == filtered[i]);
+    }
+
+    // The high frequency component is removed after the transient, i.e. the output matches
+    // the filtered low frequency component (which is delayed by the filter)
+    std::vector<double> lowState(cascade.stateSize(), 0.0);
+    for (unsigned i = 0; i < signal.size(); ++i) {
+      const double low = cascade.apply(std::sin(0.01 * i), lowState.data());
+      if (i >= 200) {
+        REQUIRE(std::abs(filtered[i] - low) < 1.0e-3);
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
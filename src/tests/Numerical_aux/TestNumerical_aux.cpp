@@ -4,6 +4,7 @@
 #include "Eigenvalues.t.h"
 #include "Functions.t.h"
 #include "GaussianNucleation.t.h"
+#include "IIRFilter.t.h"
 #include "ODEInt.t.h"
 #include "Quadrature.t.h"
 #include "RegularizedYoffe.t.h"
@@ -0,0 +1,56 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ResultWriter/OutputPrecision.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Mantissa rounding") {
+  using seissol::writer::roundMantissa;
+
+  // All bits are kept by default
+  REQUIRE(roundMantissa(0.1f, 0) == 0.1f);
+  REQUIRE(roundMantissa(0.1f, 23) == 0.1f);
+
+  // 1 + 2^-3 + 2^-4 rounds up to 1 + 2^-2 with two significant bits
+  REQUIRE(roundMantissa(1.1875f, 2) == 1.25f);
+  // Ties are rounded to even
+  REQUIRE(roundMantissa(1.125f, 2) == 1.0f);
+  REQUIRE(roundMantissa(1.375f, 2) == 1.5f);
+  REQUIRE(roundMantissa(-1.1875f, 2) == -1.25f);
+
+  // Non-finite values and the largest floats are preserved
+  REQUIRE(std::isinf(roundMantissa(INFINITY, 4)));
+  REQUIRE(std::isfinite(roundMantissa(std::numeric_limits<float>::max(), 4)));
+}
+
+TEST_CASE("Conversion to float with error bound") {
+  constexpr unsigned SignificantBits = 10;
+
+  std::vector<double> values(1000);
+  for (unsigned i = 0; i < values.size(); i++) {
+    values[i] = std::sin(0.1 * i) * std::pow(10.0, static_cast<int>(i % 7) - 3);
+  }
+  std::vector<float> converted(values.size());
+
+  seissol::writer::ConversionStatistics statistics;
+  seissol::writer::convertToFloat(
+      values.data(), converted.data(), values.size(), SignificantBits, statistics);
+
+  double maxError = 0.0;
+  for (unsigned i = 0; i < values.size(); i++) {
+    const double error = std::abs(values[i] - converted[i]);
+    REQUIRE(error <= std::ldexp(std::abs(values[i]), -static_cast<int>(SignificantBits) - 1) *
+                         (1.0 + 1.0e-6));
+    maxError = std::max(maxError, error);
+  }
+
+  REQUIRE(statistics.maxError == maxError);
+  REQUIRE(statistics.maxValue == doctest::Approx(1.0e3).epsilon(1.0e-2));
+  REQUIRE(statistics.nativeBytes == values.size() * sizeof(double));
+  REQUIRE(statistics.storedBytes == values.size() * sizeof(float));
+  REQUIRE(statistics.sizeReduction() == 2.0);
+}
+
+} // namespace seissol::unit_test
@@ -1,5 +1,6 @@
 #include "doctest.h"
 #include "tests/TestHelper.h"
 
+#include "OutputPrecision.t.h"
 #include "ReceiverWriter.t.h"
 
@@ -0,0 +1,37 @@
+#include "Solver/time_stepping/CellCostExporter.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Measured cluster costs") {
+  using namespace seissol::time_stepping;
+
+  ClusterCosts costs;
+  costs.cells = 10.0;
+  costs.cellUpdates = 40.0;
+  costs.yieldingUpdates = 8.0;
+  costs.yieldSurcharge = 0.5;
+  costs.computeTime = (40.0 + 0.5 * 8.0) * 1.0e-3;
+  costs.dynamicRuptureTime = 2.0e-2;
+  costs.faceUpdates = 10.0;
+
+  SUBCASE("Yielding is removed from the cost of a cell update") {
+    REQUIRE(costs.costPerCellUpdate() == doctest::Approx(1.0e-3));
+    REQUIRE(costs.costPerFaceUpdate() == doctest::Approx(2.0e-3));
+  }
+
+  SUBCASE("Cells are charged for yielding and their share of the fault") {
+    REQUIRE(costs.cellCost(0, 0) == doctest::Approx(1.0e-3));
+    // The cell yields in each of its 4 updates
+    REQUIRE(costs.cellCost(4, 0) == doctest::Approx(1.5e-3));
+    REQUIRE(costs.cellCost(0, 2) == doctest::Approx(3.0e-3));
+  }
+
+  SUBCASE("Clusters without samples have no costs") {
+    const ClusterCosts empty;
+    REQUIRE(empty.costPerCellUpdate() == 0.0);
+    REQUIRE(empty.costPerFaceUpdate() == 0.0);
+    REQUIRE(empty.cellCost(1, 1) == 0.0);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,3 +2,4 @@
 #include <doctest/trompeloeil.hpp>
 
 #include "AbstractTimeCluster.t.h"
+#include "CellCostExporter.t.h"